@@ -0,0 +1,56 @@
+#pragma once
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+// Tiny benchmark harness: no dependency, each benchmark prints its own numbers.
+//
+//   ENGINE_BENCHMARK(MyThing) {
+//       double ms = bench::BestOfMs(5, [&] { ... });
+//       bench::Report("MyThing", "scalar", ms, items, "MPix");
+//   }
+//
+// Run EngineBenchmarks [filter] to only run benchmarks whose name contains filter.
+namespace bench {
+
+    struct Registration {
+        std::string name;
+        std::function<void()> fn;
+    };
+
+    inline std::vector<Registration>& Registry() {
+        static std::vector<Registration> registry;
+        return registry;
+    }
+
+    inline bool Register(const char* name, std::function<void()> fn) {
+        Registry().push_back({ name, std::move(fn) });
+        return true;
+    }
+
+    // Fastest of repeats runs, in milliseconds (the minimum is the least noisy estimate)
+    template <typename Fn>
+    double BestOfMs(int repeats, Fn&& fn) {
+        double best = 1e30;
+        for (int i = 0; i < repeats; i++) {
+            const auto start = std::chrono::high_resolution_clock::now();
+            fn();
+            const auto end = std::chrono::high_resolution_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return best;
+    }
+
+    // One line: name, variant, time and throughput in millions of unit per second
+    void Report(const std::string& name, const std::string& variant, double ms, double items, const char* unit);
+
+    // Keeps the optimizer from deleting work whose result is otherwise unused
+    void DoNotOptimize(const void* p);
+}
+
+#define ENGINE_BENCHMARK(name) \
+    static void name##_Benchmark(); \
+    static const bool name##_Registered = bench::Register(#name, name##_Benchmark); \
+    static void name##_Benchmark()
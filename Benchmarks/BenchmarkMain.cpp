@@ -0,0 +1,37 @@
+#include "Benchmark.hpp"
+#include <iostream>
+#include <iomanip>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace bench {
+    void Report(const std::string& name, const std::string& variant, double ms, double items, const char* unit) {
+        std::cout << std::left << std::setw(28) << name << std::setw(14) << variant << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(10) << ms << " ms"
+                  << std::setprecision(1) << std::setw(10) << items / 1e6 / (ms / 1000.0) << " M" << unit << "/s"
+                  << std::endl;
+    }
+
+    void DoNotOptimize(const void* p) {
+#if defined(_MSC_VER)
+        // No inline asm on x64 MSVC: a volatile store plus a compiler barrier
+        static const void* volatile sink;
+        sink = p;
+        _ReadWriteBarrier();
+#else
+        // p escapes into an empty asm block that may read any memory
+        asm volatile("" : : "g"(p) : "memory");
+#endif
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::string filter = argc > 1 ? argv[1] : "";
+    for (const auto& benchmark : bench::Registry()) {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) continue;
+        std::cout << "--- " << benchmark.name << " ---" << std::endl;
+        benchmark.fn();
+    }
+    return 0;
+}
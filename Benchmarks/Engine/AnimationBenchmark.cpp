@@ -0,0 +1,66 @@
+#include "../Benchmark.hpp"
+#include <Engine/Animation/AnimationSystem.hpp>
+#include <Engine/Jobs/JobSystem.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <OPENGL/glm/gtc/quaternion.hpp>
+#include <cmath>
+#include <memory>
+#include <string>
+
+// One AnimationSystem::Update (advance clocks, sample the compressed clip, build the skinning
+// palette) for thousands of characters sharing a 64 joint skeleton, on the JobSystem.
+// The budget is 2 ms per frame for a few thousand characters.
+namespace {
+    constexpr size_t kJoints = 64;
+    constexpr size_t kFrames = 60;
+
+    std::shared_ptr<Skeleton> MakeSkeleton() {
+        // A spine with limbs hanging off every fourth joint, parents first
+        auto skeleton = std::make_shared<Skeleton>();
+        for (size_t i = 0; i < kJoints; i++) {
+            const int parent = i == 0 ? -1 : (i % 4 == 0 ? static_cast<int>(i) - 4 : static_cast<int>(i) - 1);
+            skeleton->joints.push_back({ "joint" + std::to_string(i), parent });
+            JointPose bind;
+            bind.translation[1] = 0.1f;
+            skeleton->bindPose.push_back(bind);
+            skeleton->boneJoints.push_back(static_cast<int>(i));
+            skeleton->inverseBind.push_back(glm::mat4(1.0f));
+        }
+        return skeleton;
+    }
+
+    std::shared_ptr<AnimationClip> MakeClip() {
+        // Every joint swings on its own phase, so curve fitting keeps most keys
+        std::vector<RawJointTrack> tracks(kJoints);
+        for (size_t j = 0; j < kJoints; j++) {
+            for (size_t f = 0; f < kFrames; f++) {
+                const float angle = std::sin(f * 0.2f + j * 0.7f) * 0.8f;
+                tracks[j].rotations.push_back(glm::angleAxis(angle, glm::normalize(glm::vec3(1.0f, float(j % 3), 0.5f))));
+                tracks[j].translations.push_back(glm::vec3(0.0f, 0.1f + 0.01f * std::sin(f * 0.1f), 0.0f));
+            }
+        }
+        return std::make_shared<AnimationClip>(AnimationClip::Compress("swing", 30.0f, kFrames, tracks));
+    }
+}
+
+ENGINE_BENCHMARK(Animation) {
+    const std::shared_ptr<const Skeleton> skeleton = MakeSkeleton();
+    const std::shared_ptr<const AnimationClip> clip = MakeClip();
+    std::shared_ptr<JobSystem> jobs = ServiceLocator::Get().Create<JobSystem>();
+
+    for (size_t count : { size_t(1000), size_t(2000), size_t(5000) }) {
+        const std::string name = "Animate/" + std::to_string(count / 1000) + "k x 64";
+
+        std::shared_ptr<AnimationSystem> animation = ServiceLocator::Get().Create<AnimationSystem>();
+        for (size_t i = 0; i < count; i++) {
+            const AnimationSystem::InstanceId id = animation->AddInstance(skeleton, clip);
+            // Spread the clocks so the characters don't all sample the same keys
+            animation->Play(id, clip, 0.8f + 0.4f * float(i % 7) / 7.0f);
+        }
+        animation->Update(0.0);   // lays out the palette once
+
+        const double updateMs = bench::BestOfMs(20, [&] { animation->Update(1.0 / 60.0); });
+        bench::DoNotOptimize(animation->GetPalette(0));
+        bench::Report(name, "update", updateMs, double(count), "Char");
+    }
+}
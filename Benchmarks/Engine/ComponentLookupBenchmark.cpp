@@ -0,0 +1,71 @@
+#include "../Benchmark.hpp"
+#include <Engine/GameObject.hpp>
+#include <Engine/Managers/GameObjectManager.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+
+// GetComponent<T>() on objects with 8 components, looking up the first, the last and a missing type.
+// "dynamic_cast" is the previous implementation (walk the components, dynamic_cast each one),
+// "type id" is the current mask + slot table.
+namespace {
+    template <int N>
+    struct Part : Component { int value = N; };
+
+    struct Missing : Component {};
+
+    class LookupObject : public GameObject {
+    public:
+        template <typename T>
+        T* FindByDynamicCast() {
+            for (auto& component : components) {
+                if (T* found = dynamic_cast<T*>(component.get())) return found;
+            }
+            return nullptr;
+        }
+    };
+
+    constexpr size_t kObjectCount = 1000;
+    constexpr int kLookupRounds = 1000;
+
+    template <typename T>
+    void Compare(const std::string& name, std::vector<std::unique_ptr<LookupObject>>& objects) {
+        const double lookups = double(kObjectCount) * kLookupRounds;
+        uintptr_t sink = 0;
+
+        const double castMs = bench::BestOfMs(3, [&] {
+            for (int round = 0; round < kLookupRounds; round++) {
+                for (auto& object : objects) sink += reinterpret_cast<uintptr_t>(object->FindByDynamicCast<T>());
+            }
+        });
+        bench::Report(name, "dynamic_cast", castMs, lookups, "Lookup");
+
+        const double idMs = bench::BestOfMs(3, [&] {
+            for (int round = 0; round < kLookupRounds; round++) {
+                for (auto& object : objects) sink += reinterpret_cast<uintptr_t>(object->GetComponent<T>());
+            }
+        });
+        bench::Report(name, "type id", idMs, lookups, "Lookup");
+        bench::DoNotOptimize(&sink);
+    }
+}
+
+ENGINE_BENCHMARK(ComponentLookup) {
+    ServiceLocator::Get().Create<GameObjectManager>();
+
+    std::vector<std::unique_ptr<LookupObject>> objects;
+    for (size_t i = 0; i < kObjectCount; i++) {
+        objects.push_back(std::make_unique<LookupObject>());
+        LookupObject& object = *objects.back();
+        object.AddComponent<Part<0>>();
+        object.AddComponent<Part<1>>();
+        object.AddComponent<Part<2>>();
+        object.AddComponent<Part<3>>();
+        object.AddComponent<Part<4>>();
+        object.AddComponent<Part<5>>();
+        object.AddComponent<Part<6>>();
+        object.AddComponent<Part<7>>();
+    }
+
+    Compare<Part<0>>("GetComponent/first", objects);
+    Compare<Part<7>>("GetComponent/last", objects);
+    Compare<Missing>("GetComponent/missing", objects);
+}
@@ -0,0 +1,79 @@
+#include "../Benchmark.hpp"
+#include <Engine/ECS/EcsWorld.hpp>
+#include <Engine/GameObject.hpp>
+#include <Engine/Managers/GameObjectManager.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+
+// Same work both ways: position += velocity * dt for N entities.
+//  - GameObject: one heap GameObject + one heap Mover component each, virtual Update per object
+//    and per component. "UpdateAll" goes through GameObjectManager, "GameObject" calls Update directly.
+//  - ECS: Position and Velocity arrays in archetype chunks, one linear pass.
+// The GameObjects are allocated back to back, which is the best case for them; in a real level
+// they're interleaved with everything else on the heap.
+namespace {
+    class Mover : public Component {
+    public:
+        explicit Mover(const glm::vec3& velocity) : velocity(velocity) {}
+        void Update(double deltaTime) override {
+            Transform& transform = owner->GetTransform();
+            transform.SetLocalPosition(transform.GetLocalPosition() + velocity * static_cast<float>(deltaTime));
+        }
+    private:
+        glm::vec3 velocity;
+    };
+
+    struct Position { glm::vec3 value; };
+    struct Velocity { glm::vec3 value; };
+
+    glm::vec3 StartVelocity(size_t i) {
+        return glm::vec3(float(i % 7), float(i % 11), float(i % 13)) * 0.1f;
+    }
+}
+
+ENGINE_BENCHMARK(EcsVsGameObject) {
+    const double dt = 1.0 / 60.0;
+
+    for (size_t count : { size_t(10000), size_t(100000), size_t(1000000) }) {
+        const std::string name = "Update/" + std::to_string(count / 1000) + "k";
+
+        // --- GameObject ---
+        {
+            std::shared_ptr<GameObjectManager> manager = ServiceLocator::Get().Create<GameObjectManager>();
+            std::vector<std::unique_ptr<GameObject>> objects;
+            objects.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                objects.push_back(std::make_unique<GameObject>());
+                objects.back()->AddComponent<Mover>(StartVelocity(i));
+            }
+
+            const double updateAllMs = bench::BestOfMs(5, [&] { manager->UpdateAll(dt); });
+            bench::Report(name, "UpdateAll", updateAllMs, double(count), "Ent");
+
+            const double ms = bench::BestOfMs(5, [&] {
+                for (auto& object : objects) object->Update(dt);
+            });
+            bench::Report(name, "GameObject", ms, double(count), "Ent");
+            bench::DoNotOptimize(&objects.back()->GetTransform().GetLocalPosition());
+        }
+
+        // --- ECS ---
+        {
+            EcsWorld world;
+            for (size_t i = 0; i < count; i++) {
+                world.Create(Position{ glm::vec3(0.0f) }, Velocity{ StartVelocity(i) });
+            }
+
+            const float step = static_cast<float>(dt);
+            const double ms = bench::BestOfMs(5, [&] {
+                world.Each<Position, const Velocity>([step](Position& position, const Velocity& velocity) {
+                    position.value += velocity.value * step;
+                });
+            });
+            bench::Report(name, "EcsWorld", ms, double(count), "Ent");
+
+            world.EachChunk<Position>([](uint32_t, const Entity*, Position* positions) {
+                bench::DoNotOptimize(positions);
+            });
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#include "../Benchmark.hpp"
+#include <Engine/GameObject.hpp>
+#include <Engine/Managers/GameObjectManager.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <memory>
+
+// One GameObjectManager::UpdateAll frame from 1k to 100k objects, each with one small component.
+// Linear scaling shows up as a flat MObj/s column. "churn" also destroys and respawns 1% of the
+// objects from inside the update every frame.
+namespace {
+    class Spin : public Component {
+    public:
+        void Update(double deltaTime) override { angle += static_cast<float>(deltaTime); }
+        float angle = 0.0f;
+    };
+
+    class Churner : public GameObject {
+    public:
+        std::vector<std::unique_ptr<GameObject>>* pool = nullptr;
+        size_t victim = 0;
+
+        void Update(double deltaTime) override {
+            GameObject::Update(deltaTime);
+            if (!pool) return;
+            (*pool)[victim] = std::make_unique<GameObject>();   // destroys the old one mid-update
+            (*pool)[victim]->AddComponent<Spin>();
+        }
+    };
+}
+
+ENGINE_BENCHMARK(GameObjectManager) {
+    for (size_t count : { size_t(1000), size_t(10000), size_t(100000) }) {
+        const std::string name = "UpdateAll/" + std::to_string(count / 1000) + "k";
+        std::shared_ptr<GameObjectManager> manager = ServiceLocator::Get().Create<GameObjectManager>();
+
+        std::vector<std::unique_ptr<GameObject>> objects;
+        objects.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            objects.push_back(std::make_unique<GameObject>());
+            objects.back()->AddComponent<Spin>();
+        }
+        const double ms = bench::BestOfMs(10, [&] { manager->UpdateAll(1.0 / 60.0); });
+        bench::Report(name, "steady", ms, double(count), "Obj");
+
+        // Every 100th object is a Churner that replaces another object while the loop runs
+        std::vector<std::unique_ptr<GameObject>> churners;
+        for (size_t i = 0; i < count / 100; i++) {
+            auto churner = std::make_unique<Churner>();
+            churner->pool = &objects;
+            churner->victim = i * 97 % count;
+            churners.push_back(std::move(churner));
+        }
+        const double churnMs = bench::BestOfMs(10, [&] { manager->UpdateAll(1.0 / 60.0); });
+        bench::Report(name, "churn", churnMs, double(count + churners.size()), "Obj");
+    }
+}
@@ -0,0 +1,60 @@
+#include "../Benchmark.hpp"
+#include <Engine/GameObject.hpp>
+#include <Engine/Managers/GameObjectManager.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <memory>
+#include <vector>
+
+// Spawning 100k objects with two components (one sharing an asset), then clearing the manager:
+// one at a time (constructor, service lookup, AddComponent x2, Adopt) against one
+// GameObjectManager::Instantiate from a prototype with all storage reserved up front.
+namespace {
+    struct Asset {
+        float data[16] = {};
+    };
+
+    class Visual : public Component {
+    public:
+        std::shared_ptr<const Asset> asset;
+    };
+
+    class Drift : public Component {
+    public:
+        void Update(double deltaTime) override { offset += static_cast<float>(deltaTime); }
+        float offset = 0.0f;
+    };
+
+    constexpr size_t kCount = 100000;
+}
+
+ENGINE_BENCHMARK(Instantiate) {
+    const std::shared_ptr<const Asset> asset = std::make_shared<Asset>();
+    TransformBatch poses;
+    poses.Reserve(kCount);
+    for (size_t i = 0; i < kCount; i++) {
+        poses.Add(glm::vec3(float(i % 316), 0.0f, float(i / 316)), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+    }
+
+    const double singleMs = bench::BestOfMs(5, [&] {
+        std::shared_ptr<GameObjectManager> manager = ServiceLocator::Get().Create<GameObjectManager>();
+        for (size_t i = 0; i < kCount; i++) {
+            GameObject* object = manager->Adopt(std::unique_ptr<GameObject>(ObjectPool::New<GameObject>()));
+            object->GetTransform().SetLocalPosition(glm::vec3(poses.positionX[i], poses.positionY[i], poses.positionZ[i]));
+            object->AddComponent<Visual>()->asset = asset;
+            object->AddComponent<Drift>();
+        }
+        bench::DoNotOptimize(manager.get());
+        ServiceLocator::Get().Create<GameObjectManager>();
+    });
+    bench::Report("Spawn/100k", "one by one", singleMs, double(kCount), "Obj");
+
+    GameObject prototype{ GameObject::Unregistered{} };
+    prototype.AddComponent<Visual>()->asset = asset;
+    prototype.AddComponent<Drift>();
+    const double batchMs = bench::BestOfMs(5, [&] {
+        std::shared_ptr<GameObjectManager> manager = ServiceLocator::Get().Create<GameObjectManager>();
+        bench::DoNotOptimize(manager->Instantiate(prototype, poses).data());
+        ServiceLocator::Get().Create<GameObjectManager>();
+    });
+    bench::Report("Spawn/100k", "instantiate", batchMs, double(kCount), "Obj");
+}
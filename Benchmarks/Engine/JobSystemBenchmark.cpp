@@ -0,0 +1,101 @@
+#include "../Benchmark.hpp"
+#include <Engine/Jobs/JobSystem.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cmath>
+#include <memory>
+
+// JobSystem against a serial loop and against what ParallelFor did before the job system
+// (spawn hardware_concurrency threads per call, hand out one index at a time).
+//  - ParallelFor/*: embarrassingly parallel, cheap items; "frame" is a small per-frame sized batch
+//    where creating threads costs more than the work
+//  - Graph/layers: 16 layers of 64 jobs, every layer waiting on the one before (a frame's systems)
+//  - Graph/chain: 10k jobs each depending on the previous one, i.e. pure scheduling overhead
+namespace {
+    float Work(size_t i) {
+        float x = static_cast<float>(i) * 0.001f;
+        for (int k = 0; k < 16; k++) x = std::sqrt(x * x + 1.0f) * 0.999f;
+        return x;
+    }
+
+    template <typename Fn>
+    void SpawnParallelFor(size_t count, Fn&& fn) {
+        const size_t threadCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), count);
+        std::atomic<size_t> next{ 0 };
+        auto worker = [&] {
+            for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) fn(i);
+        };
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < threadCount; t++) threads.emplace_back(worker);
+        worker();
+        for (auto& thread : threads) thread.join();
+    }
+}
+
+ENGINE_BENCHMARK(JobSystem) {
+    std::shared_ptr<JobSystem> jobs = ServiceLocator::Get().Create<JobSystem>();
+
+    // --- Embarrassingly parallel ---
+    for (size_t count : { size_t(1000), size_t(1000000) }) {
+        const std::string name = count < 10000 ? "ParallelFor/frame" : "ParallelFor/1M";
+        std::vector<float> out(count);
+
+        const double serialMs = bench::BestOfMs(5, [&] {
+            for (size_t i = 0; i < count; i++) out[i] = Work(i);
+        });
+        bench::Report(name, "serial", serialMs, double(count), "Item");
+
+        const double spawnMs = bench::BestOfMs(5, [&] { SpawnParallelFor(count, [&](size_t i) { out[i] = Work(i); }); });
+        bench::Report(name, "spawn", spawnMs, double(count), "Item");
+
+        const double jobMs = bench::BestOfMs(5, [&] { jobs->ParallelFor(count, [&](size_t i) { out[i] = Work(i); }); });
+        bench::Report(name, "JobSystem", jobMs, double(count), "Item");
+        bench::DoNotOptimize(out.data());
+    }
+
+    // --- Dependency graphs ---
+    {
+        constexpr size_t kLayers = 16, kWidth = 64, kItems = 256;
+        std::vector<float> out(kLayers * kWidth);
+        auto node = [&](size_t layer, size_t index) {
+            float sum = 0.0f;
+            for (size_t i = 0; i < kItems; i++) sum += Work(layer * 7 + index + i);
+            out[layer * kWidth + index] = sum;
+        };
+
+        const double serialMs = bench::BestOfMs(5, [&] {
+            for (size_t layer = 0; layer < kLayers; layer++) {
+                for (size_t index = 0; index < kWidth; index++) node(layer, index);
+            }
+        });
+        bench::Report("Graph/layers", "serial", serialMs, double(kLayers * kWidth), "Job");
+
+        const double jobMs = bench::BestOfMs(5, [&] {
+            std::vector<JobCounter> layers(kLayers);
+            for (size_t layer = 0; layer < kLayers; layer++) {
+                JobCounter* previous = layer > 0 ? &layers[layer - 1] : nullptr;
+                for (size_t index = 0; index < kWidth; index++) {
+                    jobs->Schedule([&node, layer, index] { node(layer, index); }, { previous }, &layers[layer]);
+                }
+            }
+            jobs->Wait(layers.back());
+        });
+        bench::Report("Graph/layers", "JobSystem", jobMs, double(kLayers * kWidth), "Job");
+        bench::DoNotOptimize(out.data());
+    }
+    {
+        constexpr size_t kJobs = 10000;
+        size_t visited = 0;
+        const double chainMs = bench::BestOfMs(5, [&] {
+            std::vector<JobCounter> links(kJobs);
+            for (size_t i = 0; i < kJobs; i++) {
+                jobs->Schedule([&visited] { visited++; }, { i > 0 ? &links[i - 1] : nullptr }, &links[i]);
+            }
+            jobs->Wait(links.back());
+        });
+        bench::Report("Graph/chain", "JobSystem", chainMs, double(kJobs), "Job");
+        bench::DoNotOptimize(&visited);
+    }
+}
@@ -0,0 +1,49 @@
+#include "../Benchmark.hpp"
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+
+// One service lookup per iteration (each followed by an opaque call, so nothing is hoisted out
+// of the loop). "hash map" is the previous implementation (type_index -> shared_ptr, copied out),
+// "GetService" the shared_ptr accessor on typed slots, "GetServiceRef" the hot path reference.
+namespace {
+    class Clock : public IService {
+        friend class ::ServiceLocator;
+    public:
+        double time = 0.0;
+    private:
+        Clock() = default;
+    };
+
+    constexpr size_t kLookups = 10000000;
+}
+
+ENGINE_BENCHMARK(ServiceLocator) {
+    std::shared_ptr<Clock> clock = ServiceLocator::Get().Create<Clock>();
+    std::unordered_map<std::type_index, std::shared_ptr<IService>> map;
+    map[std::type_index(typeid(Clock))] = clock;
+
+    const double mapMs = bench::BestOfMs(3, [&] {
+        for (size_t i = 0; i < kLookups; i++) {
+            std::shared_ptr<Clock> found = std::static_pointer_cast<Clock>(map.find(std::type_index(typeid(Clock)))->second);
+            bench::DoNotOptimize(found.get());
+        }
+    });
+    bench::Report("Lookup", "hash map", mapMs, double(kLookups), "Op");
+
+    const double sharedMs = bench::BestOfMs(3, [&] {
+        for (size_t i = 0; i < kLookups; i++) {
+            std::shared_ptr<Clock> found = ServiceLocator::Get().GetService<Clock>();
+            bench::DoNotOptimize(found.get());
+        }
+    });
+    bench::Report("Lookup", "GetService", sharedMs, double(kLookups), "Op");
+
+    const double refMs = bench::BestOfMs(3, [&] {
+        for (size_t i = 0; i < kLookups; i++) {
+            bench::DoNotOptimize(&ServiceLocator::GetServiceRef<Clock>());
+        }
+    });
+    bench::Report("Lookup", "GetServiceRef", refMs, double(kLookups), "Op");
+}
@@ -0,0 +1,62 @@
+#include "../Benchmark.hpp"
+#include <Engine/GameObject.hpp>
+#include <Engine/Managers/GameObjectManager.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <OPENGL/glm/gtc/matrix_transform.hpp>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+// UpdateAll over 100k objects scattered on a 1 km square around a viewer looking down -z, each
+// with a little float math in its Update: every object every frame, then with update LOD (full
+// rate within 25 m, at most every 8th frame). Printed below: updates per frame and how even the
+// throttled frames are (busiest / quietest frame of the cycle).
+namespace {
+    class Wobble : public Component {
+    public:
+        void Update(double deltaTime) override {
+            phase += static_cast<float>(deltaTime);
+            for (int i = 0; i < 8; i++) value = std::sin(phase + value * 0.5f);
+        }
+        float phase = 0.0f;
+        float value = 0.0f;
+    };
+}
+
+ENGINE_BENCHMARK(UpdateLod) {
+    constexpr size_t kCount = 100000;
+    std::shared_ptr<GameObjectManager> manager = ServiceLocator::Get().Create<GameObjectManager>();
+    manager->SetParallelUpdate(false);
+
+    std::vector<std::unique_ptr<GameObject>> objects;
+    objects.reserve(kCount);
+    uint32_t seed = 12345;
+    auto random = [&seed] {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / float(1 << 24);
+    };
+    for (size_t i = 0; i < kCount; i++) {
+        objects.push_back(std::make_unique<GameObject>());
+        objects.back()->GetTransform().SetLocalPosition(glm::vec3(random() * 1000.0f - 500.0f, 0.0f, random() * 1000.0f - 500.0f));
+        objects.back()->AddComponent<Wobble>();
+    }
+    manager->UpdateTransforms();
+
+    const double fullMs = bench::BestOfMs(10, [&] { manager->UpdateAll(1.0 / 60.0); });
+    bench::Report("UpdateAll/100k", "every frame", fullMs, double(kCount), "Obj");
+
+    UpdateLodSettings settings;
+    settings.enabled = true;
+    manager->SetUpdateLod(settings);
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(0.0f, 2.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    manager->SetUpdateViewer(glm::vec3(0.0f, 2.0f, 0.0f), glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f) * view);
+    // Let every object get its bucket
+    for (uint32_t i = 0; i < settings.rebucketFrames; i++) manager->UpdateAll(1.0 / 60.0);
+
+    const double lodMs = bench::BestOfMs(10, [&] { manager->UpdateAll(1.0 / 60.0); });
+    bench::Report("UpdateAll/100k", "lod", lodMs, double(kCount), "Obj");
+
+    const UpdateLod::Stats& stats = manager->GetUpdateLodStats();
+    std::printf("    updated %zu / frame, hidden %zu, frames of the cycle: %zu .. %zu updates\n",
+        stats.updated, stats.hidden, stats.quietestFrame, stats.busiestFrame);
+}
@@ -0,0 +1,62 @@
+#include "../Benchmark.hpp"
+#include <Engine/GameObject.hpp>
+#include <Engine/Jobs/JobSystem.hpp>
+#include <Engine/Managers/GameObjectManager.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+// GameObjectManager::UpdateAll over 10k / 100k objects with two declared components each
+// (a little float math, and a transform write), serial loop against the UpdateScheduler.
+// The scheduled variant is tagged with the parallelism it reached (CPU time / wall time).
+namespace {
+    class Oscillator : public Component {
+    public:
+        static UpdateAccess GetUpdateAccess() { return UpdateAccess(); }
+        void Update(double deltaTime) override {
+            phase += static_cast<float>(deltaTime);
+            for (int i = 0; i < 8; i++) value = std::sin(phase + value * 0.5f);
+        }
+        float phase = 0.0f;
+        float value = 0.0f;
+    };
+
+    class Follower : public Component {
+    public:
+        static UpdateAccess GetUpdateAccess() { return UpdateAccess().Reads<Oscillator>().Writes<Transform>(); }
+        void Update(double) override {
+            const float value = owner->GetComponent<Oscillator>()->value;
+            owner->GetTransform().SetLocalPosition(glm::vec3(value, 0.0f, 0.0f));
+        }
+    };
+}
+
+ENGINE_BENCHMARK(UpdateScheduler) {
+    std::shared_ptr<JobSystem> jobs = ServiceLocator::Get().Create<JobSystem>();
+
+    for (size_t count : { size_t(10000), size_t(100000) }) {
+        const std::string name = "UpdateAll/" + std::to_string(count / 1000) + "k";
+        std::shared_ptr<GameObjectManager> manager = ServiceLocator::Get().Create<GameObjectManager>();
+
+        std::vector<std::unique_ptr<GameObject>> objects;
+        objects.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            objects.push_back(std::make_unique<GameObject>());
+            objects.back()->AddComponent<Oscillator>();
+            objects.back()->AddComponent<Follower>();
+        }
+
+        manager->SetParallelUpdate(false);
+        const double serialMs = bench::BestOfMs(10, [&] { manager->UpdateAll(1.0 / 60.0); });
+        bench::Report(name, "serial", serialMs, double(count), "Obj");
+
+        manager->SetParallelUpdate(true);
+        const double scheduledMs = bench::BestOfMs(10, [&] { manager->UpdateAll(1.0 / 60.0); });
+        char variant[32];
+        std::snprintf(variant, sizeof(variant), "sched x%.1f", manager->GetUpdateStats().parallelism);
+        bench::Report(name, variant, scheduledMs, double(count), "Obj");
+
+        objects.clear();
+    }
+}
@@ -0,0 +1,31 @@
+#include "../Benchmark.hpp"
+#include <Texture/MipGenerator.hpp>
+
+// Full mip chain of a 2K RGBA texture: scalar reference vs SSE/AVX2 kernels, per filter.
+// Throughput counts source megapixels (base level) per second.
+ENGINE_BENCHMARK(MipGenerator) {
+    Image image;
+    image.width = 2048;
+    image.height = 2048;
+    image.channels = 4;
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * 4);
+    for (size_t i = 0; i < image.pixels.size(); i++) {
+        image.pixels[i] = static_cast<unsigned char>((i * 2654435761u) >> 13);
+    }
+    const double pixels = static_cast<double>(image.width) * image.height;
+
+    struct Variant { const char* name; MipFilter filter; };
+    for (const Variant& variant : { Variant{ "box", MipFilter::Box }, Variant{ "kaiser", MipFilter::Kaiser },
+                                    Variant{ "lanczos", MipFilter::Lanczos } }) {
+        for (bool useSimd : { false, true }) {
+            MipSettings settings;
+            settings.filter = variant.filter;
+            settings.useSimd = useSimd;
+            const double ms = bench::BestOfMs(3, [&] {
+                std::vector<Image> mips = GenerateMipChain(image, settings);
+                bench::DoNotOptimize(mips.data());
+            });
+            bench::Report(std::string("MipChain/") + variant.name, useSimd ? "simd" : "scalar", ms, pixels, "Pix");
+        }
+    }
+}
@@ -16,13 +16,15 @@ public:
 
     void Update(double deltaTime) override;
 
-    void SetPosition(const glm::vec3& pos) { position = pos; }
-    glm::vec3 GetPosition() const { return position; }
+    void SetPosition(const glm::vec3& pos) { transform.SetLocalPosition(pos); }
+    glm::vec3 GetPosition() const { return transform.GetWorldPosition(); }
+    const MeshRenderer& GetMeshRenderer() const { return *meshRenderer; }
 
 private:
     // The Cube now OWNS a MeshRenderer component to do the heavy lifting
     std::unique_ptr<MeshRenderer> meshRenderer;
 
     std::unique_ptr<Shader> shader;
-    std::unique_ptr<Texture> texture;
+    std::unique_ptr<Shader> skinnedShader;   // only for models with a skeleton
+    std::shared_ptr<Texture> texture; // shared through TextureCache
 };
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+#include <Engine/Animation/Skeleton.hpp>
+#include <OPENGL/glm/glm.hpp>
+#include <OPENGL/glm/gtc/quaternion.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Per-joint animation curves, uniformly sampled at the clip's sample rate.
+// An empty vector means "not animated, use the bind pose".
+struct RawJointTrack {
+    std::vector<glm::vec3> translations;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> scales;
+};
+
+struct ClipCompressionSettings {
+    float translationTolerance = 1e-3f; // model units
+    float rotationTolerance = 1e-3f;    // max quaternion component error
+    float scaleTolerance = 1e-3f;
+};
+
+// Compressed animation clip.
+// Keys are curve-fitted (a key is dropped when interpolating its neighbours reproduces it within
+// tolerance), rotations are stored as 48-bit "smallest three" quaternions, translation/scale as
+// 16-bit values inside a per-channel range, and key times as 16-bit frame numbers (so clips are cut
+// after 65535 frames).
+class AnimationClip {
+public:
+    static AnimationClip Compress(const std::string& name, float sampleRate, size_t frameCount,
+                                  const std::vector<RawJointTrack>& tracks,
+                                  const ClipCompressionSettings& settings = ClipCompressionSettings{});
+
+    // Writes the local pose of every joint (joints without curves keep bindPose)
+    void SamplePose(float timeSeconds, const JointPose* bindPose, JointPose* outPose) const;
+
+    const std::string& GetName() const { return name; }
+    float GetDuration() const { return duration; }
+    size_t GetJointCount() const { return channels.size(); }
+    size_t GetKeyCount() const { return vecFrames.size() + rotFrames.size(); }
+    size_t GetRawKeyCount() const { return rawKeyCount; }
+    size_t GetCompressedBytes() const;
+
+    // Exposed for tests: quantization helpers
+    struct PackedQuat { uint16_t a, b, c; };
+    static PackedQuat PackQuat(const glm::quat& q);
+    static void UnpackQuat(const PackedQuat& packed, float* outXYZW);
+
+private:
+    struct PackedVec3 { uint16_t x, y, z; };
+
+    // One curve (translation, rotation or scale of one joint)
+    struct Channel {
+        uint32_t firstKey = 0;
+        uint32_t keyCount = 0; // 0 = not animated
+        float rangeMin[3] = { 0.0f, 0.0f, 0.0f };
+        float rangeExtent[3] = { 0.0f, 0.0f, 0.0f };
+    };
+
+    struct JointChannels {
+        Channel translation, rotation, scale;
+    };
+
+    std::string name;
+    float sampleRate = 30.0f;
+    float duration = 0.0f;
+    size_t rawKeyCount = 0;
+
+    std::vector<JointChannels> channels;
+
+    // Translation and scale keys share one pool, rotations have their own
+    std::vector<uint16_t> vecFrames;
+    std::vector<PackedVec3> vecValues;
+    std::vector<uint16_t> rotFrames;
+    std::vector<PackedQuat> rotValues;
+
+    Channel CompressVec3(const glm::vec3* samples, size_t count, float tolerance);
+    Channel CompressQuat(const glm::quat* samples, size_t count, float tolerance);
+
+    void SampleVec3(const Channel& channel, float frame, float* out) const;
+    void SampleQuat(const Channel& channel, float frame, float* out) const;
+};
@@ -0,0 +1,14 @@
+#pragma once
+#include <Engine/Animation/Skeleton.hpp>
+#include <Engine/Animation/AnimationClip.hpp>
+#include <assimp/scene.h>
+#include <memory>
+
+// Builds the joint hierarchy from the node tree and the bone palette from every mesh's aiBones.
+// Returns nullptr when no mesh in the scene is skinned.
+std::shared_ptr<Skeleton> ImportSkeleton(const aiScene* scene);
+
+// Resamples an assimp animation at a fixed rate and compresses it for the skeleton's joints
+std::shared_ptr<AnimationClip> ImportAnimationClip(const aiAnimation* animation, const Skeleton& skeleton,
+                                                   float sampleRate = 30.0f,
+                                                   const ClipCompressionSettings& settings = ClipCompressionSettings{});
@@ -0,0 +1,76 @@
+#pragma once
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <Engine/Animation/Skeleton.hpp>
+#include <Engine/Animation/AnimationClip.hpp>
+#include <OPENGL/glm/glm.hpp>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+class Shader;
+
+// Evaluates every animated character in one batch.
+// Update() samples poses and builds skinning matrices on worker threads,
+// Upload() pushes all palettes to the GPU as a single texture buffer (one mat4 = 4 RGBA32F texels).
+class AnimationSystem : public IService {
+    friend class ServiceLocator;
+public:
+    using InstanceId = uint32_t;
+    static constexpr InstanceId kInvalidInstance = ~0u;
+    static constexpr unsigned int kPaletteTextureSlot = 3;
+
+    struct Stats {
+        size_t activeInstances = 0;
+        size_t paletteMatrices = 0;
+        double updateMs = 0.0;   // CPU time of the last Update()
+        size_t uploadBytes = 0;  // size of the last Upload()
+    };
+
+    ~AnimationSystem();
+
+    InstanceId AddInstance(std::shared_ptr<const Skeleton> skeleton, std::shared_ptr<const AnimationClip> clip);
+    void RemoveInstance(InstanceId id);
+    void Play(InstanceId id, std::shared_ptr<const AnimationClip> clip, float speed = 1.0f, bool loop = true);
+
+    // CPU side: advance clocks, sample poses, concatenate matrices
+    void Update(double deltaTime);
+
+    // GL thread: upload every palette in one buffer
+    void Upload();
+
+    // Sets the palette sampler and this instance's offset on a skinned shader
+    void BindPalette(const Shader& shader, InstanceId id) const;
+
+    const glm::mat4* GetPalette(InstanceId id) const;
+    const Stats& GetStats() const { return stats; }
+
+private:
+    AnimationSystem() = default;
+
+    struct Instance {
+        std::shared_ptr<const Skeleton> skeleton;
+        std::shared_ptr<const AnimationClip> clip;
+        float time = 0.0f;
+        float speed = 1.0f;
+        bool loop = true;
+        bool active = false;
+        uint32_t paletteOffset = 0;
+    };
+
+    // Characters evaluated per work item; big enough to amortize the hand-off
+    static constexpr size_t kBatchSize = 64;
+
+    std::vector<Instance> instances;
+    std::vector<InstanceId> freeList;
+    std::vector<glm::mat4> palette;
+    bool layoutDirty = false;
+
+    unsigned int paletteBuffer = 0;
+    unsigned int paletteTexture = 0;
+    size_t paletteCapacityBytes = 0;
+
+    Stats stats;
+
+    void RebuildLayout();
+    void EvaluateInstance(Instance& instance);
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include <OPENGL/glm/glm.hpp>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+// Bone indices are stored as 8 bits per influence in the skinned vertex
+constexpr size_t kMaxSkinBones = 256;
+
+// Local transform of one joint. 16-byte aligned so the SIMD code can load each part directly.
+struct alignas(16) JointPose {
+    float translation[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    float rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f }; // quaternion x, y, z, w
+    float scale[4] = { 1.0f, 1.0f, 1.0f, 0.0f };
+};
+
+struct Joint {
+    std::string name;
+    int parent = -1;
+};
+
+// Joint hierarchy plus the skinning palette used by the meshes.
+// Joints are stored parents-first, so model space matrices can be built in one linear pass.
+struct Skeleton {
+    std::vector<Joint> joints;
+    std::vector<JointPose> bindPose;          // local bind transform per joint
+    std::vector<int> boneJoints;              // palette entry -> joint index
+    std::vector<glm::mat4> inverseBind;       // palette entry -> mesh space to bone space
+    glm::mat4 globalInverse{ 1.0f };
+    std::unordered_map<std::string, int> jointByName;
+    std::unordered_map<std::string, int> boneByName;
+
+    size_t JointCount() const { return joints.size(); }
+    size_t BoneCount() const { return boneJoints.size(); }
+    int FindJoint(const std::string& name) const;
+    int FindBone(const std::string& name) const;
+};
+
+// Vertex skinning data: 4 bone palette indices + 4 weights in unorm8 (8 bytes per vertex)
+struct PackedSkinWeights {
+    uint8_t bones[4] = { 0, 0, 0, 0 };
+    uint8_t weights[4] = { 0, 0, 0, 0 };
+};
+
+// Keeps the 4 strongest influences, renormalizes them and quantizes so the weights sum to exactly 255
+PackedSkinWeights PackSkinWeights(const int* bones, const float* weights, size_t count);
+
+// Column-major TRS matrix of a local pose
+void PoseToMatrix(const JointPose& pose, float* outMatrix);
+
+// Local pose -> final skinning matrices (one per palette entry).
+// modelScratch must hold JointCount() matrices.
+void BuildSkinningMatrices(const Skeleton& skeleton, const JointPose* pose,
+                           glm::mat4* modelScratch, glm::mat4* outPalette);
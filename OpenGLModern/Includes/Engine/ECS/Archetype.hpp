@@ -0,0 +1,78 @@
+#pragma once
+#include <Engine/ECS/Entity.hpp>
+#include <Engine/ECS/ComponentType.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Storage for every entity with exactly one component set.
+// Entities live in fixed size chunks (16 KB, cache-line aligned). Inside a chunk each component
+// type has its own array (SoA) next to an array of the owning Entity ids, so a system reading two
+// components streams through two dense arrays instead of chasing one heap object per component.
+// Rows stay packed: removing one moves the archetype's last row into the hole, so every chunk
+// but the last is full.
+class Archetype {
+public:
+    static constexpr size_t kChunkBytes = 16 * 1024;
+    static constexpr size_t kChunkAlignment = 64;
+
+    struct Chunk {
+        std::byte* data = nullptr;
+        uint32_t count = 0;
+    };
+
+    struct Row {
+        uint32_t chunk = 0;
+        uint32_t row = 0;
+    };
+
+    explicit Archetype(ComponentMask mask);
+    ~Archetype();
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    ComponentMask GetMask() const { return mask; }
+    bool Has(ComponentTypeId type) const { return (mask >> type) & 1; }
+    const std::vector<ComponentTypeId>& GetTypes() const { return types; }
+
+    uint32_t GetChunkCapacity() const { return capacity; }
+    size_t GetChunkCount() const { return chunks.size(); }
+    uint32_t GetChunkSize(size_t chunk) const { return chunks[chunk].count; }
+    size_t GetEntityCount() const { return entityCount; }
+
+    // Arrays of one chunk; the type must be part of the archetype
+    Entity* GetEntities(size_t chunk) const { return reinterpret_cast<Entity*>(chunks[chunk].data); }
+    void* GetColumn(size_t chunk, ComponentTypeId type) const { return chunks[chunk].data + columnOffsets[type]; }
+    void* GetComponent(Row row, ComponentTypeId type) const {
+        return chunks[row.chunk].data + columnOffsets[type] + static_cast<size_t>(row.row) * componentSizes[type];
+    }
+
+    template <typename T>
+    T* GetColumn(size_t chunk) const { return static_cast<T*>(GetColumn(chunk, ComponentType<T>())); }
+
+    // Appends a row for entity. Its components are left unconstructed: the caller builds them in place.
+    Row AddRow(Entity entity);
+
+    // Removes a row whose components were already destroyed or relocated elsewhere.
+    // The last row moves into the hole; its entity is returned (invalid if the removed row was the last).
+    Entity RemoveRow(Row row);
+
+    // Destroys the row's components, then RemoveRow
+    Entity DestroyRow(Row row);
+
+private:
+    ComponentMask mask;
+    std::vector<ComponentTypeId> types;
+    uint32_t columnOffsets[kMaxComponentTypes] = {};
+    uint32_t componentSizes[kMaxComponentTypes] = {};
+    uint32_t capacity = 0;
+    size_t chunkBytes = kChunkBytes;
+
+    std::vector<Chunk> chunks;
+    std::byte* spareChunk = nullptr;
+    size_t entityCount = 0;
+
+    size_t LayoutBytes(uint32_t rows) const;
+    void Layout();
+};
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Dense ids for ECS component types (0, 1, 2, ... in first-use order) and what the type-erased
+// archetype storage needs to know to move and destroy them.
+// ECS components are plain structs: no base class, no virtual calls, no owner pointer.
+
+using ComponentTypeId = uint32_t;
+using ComponentMask = uint64_t;    // bit i set = has the component with id i
+
+constexpr ComponentTypeId kMaxComponentTypes = 64;
+
+struct ComponentTypeInfo {
+    size_t size = 0;
+    size_t alignment = 0;
+    void (*relocate)(void* destination, void* source) = nullptr;  // move-construct, then destroy source
+    void (*destroy)(void* object) = nullptr;
+};
+
+// Called once per type by ComponentType<T>(); thread safe
+ComponentTypeId RegisterComponentType(const ComponentTypeInfo& info);
+const ComponentTypeInfo& GetComponentTypeInfo(ComponentTypeId id);
+ComponentTypeId GetComponentTypeCount();
+
+template <typename T>
+ComponentTypeId ComponentType() {
+    using Type = std::remove_cv_t<std::remove_reference_t<T>>;
+    if constexpr (!std::is_same_v<T, Type>) {
+        return ComponentType<Type>();
+    } else {
+        static_assert(std::is_move_constructible_v<Type>, "ECS components must be movable");
+        static const ComponentTypeId id = RegisterComponentType({
+            sizeof(Type),
+            alignof(Type),
+            [](void* destination, void* source) {
+                Type* from = static_cast<Type*>(source);
+                new (destination) Type(std::move(*from));
+                from->~Type();
+            },
+            [](void* object) { static_cast<Type*>(object)->~Type(); }
+        });
+        return id;
+    }
+}
+
+template <typename... Ts>
+ComponentMask ComponentMaskOf() {
+    return (ComponentMask(0) | ... | (ComponentMask(1) << ComponentType<Ts>()));
+}
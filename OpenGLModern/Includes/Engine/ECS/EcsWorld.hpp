@@ -0,0 +1,160 @@
+#pragma once
+#include <Engine/ECS/Entity.hpp>
+#include <Engine/ECS/ComponentType.hpp>
+#include <Engine/ECS/Archetype.hpp>
+#include <unordered_map>
+#include <memory>
+#include <vector>
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+
+// Archetype ECS, for things there are a lot of (projectiles, crowds, debris) where a GameObject
+// per instance costs a heap object and a virtual call per component per frame.
+// Components are plain structs grouped by archetype (see Archetype); systems are just loops:
+//
+//     world.Each<Position, const Velocity>([&](Position& p, const Velocity& v) { p.value += v.value * dt; });
+//
+// Create/Destroy/Add/Remove move rows between chunks, so they must not be called from inside
+// Each/EachChunk, and component pointers from Get() are only valid until the next such call.
+// Lives alongside GameObject/GameObjectManager; the two don't know about each other.
+class EcsWorld {
+public:
+    EcsWorld() = default;
+    ~EcsWorld() = default;
+
+    EcsWorld(const EcsWorld&) = delete;
+    EcsWorld& operator=(const EcsWorld&) = delete;
+
+    // New entity with the given components (moved or copied in)
+    template <typename... Ts>
+    Entity Create(Ts&&... components);
+
+    void Destroy(Entity entity);
+    bool IsAlive(Entity entity) const;
+
+    // nullptr if the entity is stale or doesn't have a T
+    template <typename T>
+    T* Get(Entity entity);
+
+    template <typename T>
+    bool Has(Entity entity) const;
+
+    // Adds a T built from args (replaces an existing one). Moves the entity to another archetype.
+    template <typename T, typename... Args>
+    T* Add(Entity entity, Args&&... args);
+
+    template <typename T>
+    void Remove(Entity entity);
+
+    // fn(Ts&...) or fn(Entity, Ts&...) for every entity that has all of Ts (and maybe more).
+    // Mark read-only components const: Each<Position, const Velocity>.
+    template <typename... Ts, typename Fn>
+    void Each(Fn&& fn);
+
+    // fn(count, const Entity* entities, Ts*... columns) once per matching chunk: plain arrays
+    // for loops the compiler can vectorize
+    template <typename... Ts, typename Fn>
+    void EachChunk(Fn&& fn);
+
+    size_t GetEntityCount() const { return entityCount; }
+    size_t GetArchetypeCount() const { return archetypeList.size(); }
+
+private:
+    struct Record {
+        Archetype* archetype = nullptr;  // nullptr = free slot
+        Archetype::Row row;
+        uint32_t generation = 0;
+    };
+
+    std::vector<Record> records;
+    std::vector<uint32_t> freeIndices;
+    std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> archetypes;
+    std::vector<Archetype*> archetypeList;   // creation order, for queries
+    size_t entityCount = 0;
+
+    Archetype& GetArchetype(ComponentMask mask);
+    const Record* Find(Entity entity) const;
+    Entity AllocateEntity(Archetype& archetype);
+
+    // Moves the entity's shared components into a row of the archetype for newMask and destroys
+    // the ones it loses. Returns the new row (components not in the old set are unconstructed).
+    Archetype::Row ChangeArchetype(Entity entity, ComponentMask newMask);
+
+    // Updates the record of the entity RemoveRow moved into a hole
+    void Relocated(Entity moved, Archetype::Row row);
+};
+
+// --- Template implementation ---
+
+template <typename... Ts>
+Entity EcsWorld::Create(Ts&&... components) {
+    Archetype& archetype = GetArchetype(ComponentMaskOf<std::decay_t<Ts>...>());
+    const Entity entity = AllocateEntity(archetype);
+    const Archetype::Row row = records[entity.index].row;
+    (new (archetype.GetComponent(row, ComponentType<Ts>())) std::decay_t<Ts>(std::forward<Ts>(components)), ...);
+    return entity;
+}
+
+template <typename T>
+T* EcsWorld::Get(Entity entity) {
+    const Record* record = Find(entity);
+    const ComponentTypeId type = ComponentType<T>();
+    if (!record || !record->archetype->Has(type)) return nullptr;
+    return static_cast<T*>(record->archetype->GetComponent(record->row, type));
+}
+
+template <typename T>
+bool EcsWorld::Has(Entity entity) const {
+    const Record* record = Find(entity);
+    return record && record->archetype->Has(ComponentType<T>());
+}
+
+template <typename T, typename... Args>
+T* EcsWorld::Add(Entity entity, Args&&... args) {
+    using Type = std::remove_cv_t<T>;
+    const Record* record = Find(entity);
+    if (!record) return nullptr;
+
+    if (T* existing = Get<Type>(entity)) {
+        *existing = Type(std::forward<Args>(args)...);
+        return existing;
+    }
+
+    const ComponentTypeId type = ComponentType<Type>();
+    const Archetype::Row row = ChangeArchetype(entity, record->archetype->GetMask() | ComponentMask(1) << type);
+    return new (records[entity.index].archetype->GetComponent(row, type)) Type(std::forward<Args>(args)...);
+}
+
+template <typename T>
+void EcsWorld::Remove(Entity entity) {
+    const Record* record = Find(entity);
+    const ComponentTypeId type = ComponentType<T>();
+    if (!record || !record->archetype->Has(type)) return;
+    ChangeArchetype(entity, record->archetype->GetMask() & ~(ComponentMask(1) << type));
+}
+
+template <typename... Ts, typename Fn>
+void EcsWorld::EachChunk(Fn&& fn) {
+    const ComponentMask query = ComponentMaskOf<Ts...>();
+    for (Archetype* archetype : archetypeList) {
+        if ((archetype->GetMask() & query) != query) continue;
+        for (size_t chunk = 0; chunk < archetype->GetChunkCount(); chunk++) {
+            fn(archetype->GetChunkSize(chunk), const_cast<const Entity*>(archetype->GetEntities(chunk)),
+               archetype->template GetColumn<Ts>(chunk)...);
+        }
+    }
+}
+
+template <typename... Ts, typename Fn>
+void EcsWorld::Each(Fn&& fn) {
+    EachChunk<Ts...>([&](uint32_t count, const Entity* entities, Ts*... columns) {
+        for (uint32_t i = 0; i < count; i++) {
+            if constexpr (std::is_invocable_v<Fn&, Entity, Ts&...>) {
+                fn(entities[i], columns[i]...);
+            } else {
+                fn(columns[i]...);
+            }
+        }
+    });
+}
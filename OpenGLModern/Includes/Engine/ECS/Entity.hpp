@@ -0,0 +1,15 @@
+#pragma once
+#include <cstdint>
+
+// An ECS entity: slot index + generation. The generation changes every time the slot is reused,
+// so a copy kept after Destroy() is detected as stale instead of silently naming a new entity.
+struct Entity {
+    static constexpr uint32_t kInvalidIndex = ~0u;
+
+    uint32_t index = kInvalidIndex;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != kInvalidIndex; }
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
@@ -6,68 +6,190 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <bit>
+#include <type_traits>
+#include <cstdint>
+#include <atomic>
+#include <limits>
 
 // Include the Component definition because template methods (AddComponent) need it
 #include <Engine/GameObjectComponents/Component.hpp> 
+#include <Engine/GameObjectComponents/Transform.hpp>
 
 // Forward Declaration for Shader to fix "syntax error: identifier 'Shader'"
 class Shader; 
 
 class GameObject {
+    friend class GameObjectManager;
+    friend class GameObjectCommandBuffer;
+    friend class UpdateScheduler;
+
+    // Set by GameObjectManager::Register: index in its list, -1 while unregistered
+    GameObjectManager* manager = nullptr;
+    int32_t managerSlot = -1;
+    // Index in the manager's owned list if it owns this object (spawned by command), else -1
+    int32_t ownedSlot = -1;
+    // First GameObjectCommandBuffer::Destroy wins
+    std::atomic<bool> destroyQueued{ false };
+    // Set by GameObjectManager::Register
+    GameObjectHandle handle;
+
+    float updateImportance = 1.0f;
+    float boundingRadius = 1.0f;
+
 protected:
-    std::vector<std::unique_ptr<Component>> components;
+    std::vector<std::unique_ptr<Component>> components;   // in AddComponent order (= Update/Draw order)
+    // The ones that override Update / Draw, same order
+    std::vector<Component*> updateComponents;
+    std::vector<Component*> drawComponents;
 
-public:
-    glm::vec3 position{0.0f, 0.0f, 0.0f};
-    glm::vec3 rotation{0.0f, 0.0f, 0.0f};
-    glm::vec3 scale{1.0f, 1.0f, 1.0f}; 
+    // Lookup by Component::TypeId: bit i of componentMask is set if a component of type i is
+    // attached, and componentSlots holds one pointer per set bit, ordered by type id, so the
+    // slot of type i is the number of set bits below i
+    uint64_t componentMask = 0;
+    std::vector<Component*> componentSlots;
 
+    // Not in the component list: it has no Update/Draw and every object has one
+    Transform transform;
+
+public:
     GameObject() {
-        auto manager = ServiceLocator::Get().GetService<GameObjectManager>();
-        manager->Register(this);
+        transform.SetOwner(this);
+        ServiceLocator::GetServiceRef<GameObjectManager>().Register(this);
+    }
+
+    // Not registered with the GameObjectManager: never updated, handles stay invalid.
+    // Prototypes for GameObjectManager::Instantiate are built this way.
+    struct Unregistered {};
+    explicit GameObject(Unregistered) {
+        transform.SetOwner(this);
     }
 
+    // Unregisters from the manager it registered with (no lookup, works while services shut down)
     virtual ~GameObject() {
-        try {
-             auto manager = ServiceLocator::Get().GetService<GameObjectManager>();
-             manager->Unregister(this);
-        } catch(...) {}
+        if (manager) manager->Unregister(this);
     }
 
+    GameObject(const GameObject&) = delete;
+    GameObject& operator=(const GameObject&) = delete;
+
+    // Heap objects live in ObjectPools: one per type through ObjectPool::New (GameObjectCommandBuffer::Spawn uses it), shared by size for a plain new
+    static void* operator new(size_t size) { return ObjectPool::ForSize(size).Allocate(); }
+    static void* operator new(size_t size, std::align_val_t alignment) { return ObjectPool::ForSize(size, size_t(alignment)).Allocate(); }
+    static void operator delete(void* object) { ObjectPool::Free(object); }
+    static void operator delete(void* object, std::align_val_t) { ObjectPool::Free(object); }
+
     // --- Component System ---
     template <typename T, typename... Args>
     T* AddComponent(Args&&... args) {
-        auto component = std::make_unique<T>(std::forward<Args>(args)...);
+        std::unique_ptr<T> component(ObjectPool::New<T>(std::forward<Args>(args)...));
         
         // This works because Component is fully defined by the include above
         component->SetOwner(this);
+        component->typeId = Component::GetTypeId<T>();
+        Component::RegisterType<T>();
         component->Start();
         
         T* rawPtr = component.get();
         components.push_back(std::move(component));
+        if constexpr (Component::PhasesOf<T>() & Component::PhaseBit(TickGroup::Update)) updateComponents.push_back(rawPtr);
+        if constexpr (Component::PhasesOf<T>() & Component::kDrawPhase) drawComponents.push_back(rawPtr);
+        if (manager) manager->RegisterComponent(rawPtr);
+
+        // A second component of the same type is updated and drawn, but GetComponent keeps returning the first
+        const uint64_t bit = uint64_t(1) << Component::GetTypeId<T>();
+        if (!(componentMask & bit)) {
+            componentSlots.insert(componentSlots.begin() + std::popcount(componentMask & (bit - 1)), rawPtr);
+            componentMask |= bit;
+        }
         return rawPtr;
     }
 
+    // Removes (and deletes) the component GetComponent<T>() returns. Not while this object's
+    // components are being updated: use GameObjectCommandBuffer::RemoveComponent from in there.
     template <typename T>
-    T* GetComponent() {
-        for (auto& comp : components) {
-            if (T* ptr = dynamic_cast<T*>(comp.get())) {
-                return ptr;
-            }
+    bool RemoveComponent() {
+        const Component::TypeId type = Component::GetTypeId<T>();
+        const uint64_t bit = uint64_t(1) << type;
+        if (!(componentMask & bit)) return false;
+
+        const size_t slot = std::popcount(componentMask & (bit - 1));
+        Component* removed = componentSlots[slot];
+        if (manager) manager->UnregisterComponent(removed);
+        std::erase(updateComponents, removed);
+        std::erase(drawComponents, removed);
+        components.erase(std::find_if(components.begin(), components.end(),
+            [removed](const std::unique_ptr<Component>& component) { return component.get() == removed; }));
+
+        // Another component of the same type takes over the slot
+        auto next = std::find_if(components.begin(), components.end(),
+            [type](const std::unique_ptr<Component>& component) { return component->typeId == type; });
+        if (next != components.end()) {
+            componentSlots[slot] = next->get();
+        } else {
+            componentSlots.erase(componentSlots.begin() + slot);
+            componentMask &= ~bit;
         }
-        return nullptr;
+        return true;
+    }
+
+    // Resolve with GameObjectManager::Resolve; invalid while unregistered
+    GameObjectHandle GetHandle() const { return handle; }
+
+    // --- Update LOD (see UpdateLod) ---
+    static constexpr float kAlwaysUpdate = std::numeric_limits<float>::infinity();
+    // Multiplies the distances at which the update rate drops: 2 = full rate twice as far,
+    // kAlwaysUpdate = every frame, even off-screen
+    void SetUpdateImportance(float importance) { updateImportance = importance; }
+    float GetUpdateImportance() const { return updateImportance; }
+    // World-space bounding sphere radius around the transform's position, for visibility tests
+    void SetBoundingRadius(float radius) { boundingRadius = radius; }
+    float GetBoundingRadius() const { return boundingRadius; }
+
+    Transform& GetTransform() { return transform; }
+    const Transform& GetTransform() const { return transform; }
+
+    // O(1), no RTTI: matches the exact class T was added as (not base classes of it)
+    template <typename T>
+    T* GetComponent() {
+        if constexpr (std::is_same_v<T, Transform>) return &transform;
+        const uint64_t bit = uint64_t(1) << Component::GetTypeId<T>();
+        if (!(componentMask & bit)) return nullptr;
+        return static_cast<T*>(componentSlots[std::popcount(componentMask & (bit - 1))]);
+    }
+
+    template <typename T>
+    bool HasComponent() const {
+        if constexpr (std::is_same_v<T, Transform>) return true;
+        return (componentMask >> Component::GetTypeId<T>()) & 1;
     }
 
+    // Only the components that override Update (PreUpdate, PostUpdate and PreRender run from the
+    // GameObjectManager's per-group lists)
     virtual void Update(double deltaTime) {
-        for (auto& comp : components) {
+        for (Component* comp : updateComponents) {
             comp->Update(deltaTime);
         }
     }
     
     // Shader is now known via forward declaration
     void Draw(Shader& shader) {
-         for (auto& comp : components) {
+         for (Component* comp : drawComponents) {
             comp->Draw(shader);
         }
     }
-};
\ No newline at end of file
+};
+
+// --- GameObjectCommandBuffer templates (need the full GameObject) ---
+
+template <typename T, typename... Args>
+void GameObjectCommandBuffer::AddComponent(GameObject* object, Args&&... args) {
+    Record([object, ... args = std::forward<Args>(args)]() mutable {
+        object->AddComponent<T>(std::move(args)...);
+    });
+}
+
+template <typename T>
+void GameObjectCommandBuffer::RemoveComponent(GameObject* object) {
+    Record([object]() { object->RemoveComponent<T>(); });
+}
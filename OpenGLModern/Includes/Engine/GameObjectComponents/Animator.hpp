@@ -0,0 +1,29 @@
+#pragma once
+#include "Component.hpp"
+#include <Engine/Animation/AnimationSystem.hpp>
+#include <memory>
+
+// Plays a clip on a skinned MeshRenderer.
+// The actual pose evaluation is batched in AnimationSystem; this component only owns the instance.
+class Animator : public Component {
+public:
+    Animator(std::shared_ptr<const Skeleton> skeleton, std::shared_ptr<const AnimationClip> clip = nullptr);
+    ~Animator() override;
+
+    // Owns its AnimationSystem instance: not copyable (can't be part of an Instantiate prototype)
+    Animator(const Animator&) = delete;
+    Animator& operator=(const Animator&) = delete;
+
+    void Play(std::shared_ptr<const AnimationClip> clip, float speed = 1.0f, bool loop = true);
+
+    // No Update (AnimationSystem does the work): never holds up the parallel update
+    static UpdateAccess GetUpdateAccess() { return UpdateAccess(); }
+
+    // Called by MeshRenderer before drawing skinned submeshes
+    void BindPalette(const Shader& shader) const;
+    // For render packets, which bind the palette through AnimationSystem directly
+    AnimationSystem::InstanceId GetInstance() const { return instance; }
+
+private:
+    AnimationSystem::InstanceId instance = AnimationSystem::kInvalidInstance;
+};
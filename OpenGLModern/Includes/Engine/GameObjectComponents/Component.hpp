@@ -2,19 +2,97 @@
 // REMOVE THIS: #include <Engine/GameObject.hpp> 
 
 #include <iostream>
+#include <atomic>
+#include <cstdlib>
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+#include <array>
+#include <concepts>
+#include <Engine/Utils/Handle.hpp>
+#include <Engine/Utils/ObjectPool.hpp>
 // Keep this if Component uses Shader methods, otherwise forward declare Shader too
 #include <Shader/Shader.hpp> 
 
 // Forward Declaration breaks the circle
 class GameObject; 
+class GameObjectManager;
+class Component;
+
+using GameObjectHandle = Handle<GameObject>;
+using ComponentHandle = Handle<Component>;
+
+// Phases of GameObjectManager::UpdateAll, in order. A component takes part in the phases whose
+// hook it overrides (PreUpdate, Update, PostUpdate, PreRender), found at compile time when its type
+// is first added: no call at all for the hooks it leaves empty.
+enum class TickGroup : uint8_t {
+    PreUpdate,
+    Update,
+    PostUpdate,
+    PreRender,
+};
+constexpr size_t kTickGroupCount = 4;
+
+// What a component type's Update reads and writes, for the parallel update (UpdateScheduler).
+// A component declares it with a static member function:
+//
+//     static UpdateAccess GetUpdateAccess() { return UpdateAccess().Reads<Transform>().Writes<Health>(); }
+//
+// Declaring is a promise: Update only touches the listed components of its own GameObject (it
+// always writes itself), doesn't call GL, and makes structural changes through the command
+// buffer. Such updates may run on worker threads. Components that don't declare anything are
+// assumed to touch anything: their objects are updated serially, in order.
+struct UpdateAccess {
+    uint64_t reads = 0;     // bit per Component::TypeId
+    uint64_t writes = 0;
+    bool declared = true;
+
+    template <typename T> UpdateAccess& Reads();
+    template <typename T> UpdateAccess& Writes();
+
+    static UpdateAccess Undeclared() {
+        UpdateAccess access;
+        access.reads = access.writes = ~uint64_t(0);
+        access.declared = false;
+        return access;
+    }
+
+    // Running the two in either order could give different results
+    bool ConflictsWith(const UpdateAccess& other) const {
+        return (writes & (other.reads | other.writes)) != 0 || (other.writes & reads) != 0;
+    }
+};
 
 class Component {
+    friend class GameObject;
+    friend class GameObjectManager;
+
 protected:
     GameObject* owner = nullptr;
 
 public:
+    // Dense id per concrete component class (0, 1, 2, ... in first-use order), so GameObject can
+    // find a component with a bit test instead of a dynamic_cast per attached component
+    using TypeId = uint32_t;
+    static constexpr TypeId kMaxTypes = 64;
+    static constexpr TypeId kInvalidType = ~0u;
+
+    template <typename T>
+    static TypeId GetTypeId() {
+        static_assert(std::is_base_of_v<Component, T>, "GetTypeId is for Component subclasses");
+        static const TypeId id = NextTypeId();
+        return id;
+    }
+
+    Component() = default;
     virtual ~Component() = default;
 
+    // Heap components live in ObjectPools: one per type through GameObject::AddComponent, shared by size for a plain new
+    static void* operator new(size_t size) { return ObjectPool::ForSize(size).Allocate(); }
+    static void* operator new(size_t size, std::align_val_t alignment) { return ObjectPool::ForSize(size, size_t(alignment)).Allocate(); }
+    static void operator delete(void* object) { ObjectPool::Free(object); }
+    static void operator delete(void* object, std::align_val_t) { ObjectPool::Free(object); }
+
     // We can keep the implementation here ONLY if we don't access members of GameObject.
     // Since we only store the pointer, this is valid.
     void SetOwner(GameObject* entity) {
@@ -23,7 +101,108 @@ public:
 
     GameObject* GetOwner() const { return owner; }
 
+    // Resolve with GameObjectManager::Resolve; invalid until the owner is registered
+    ComponentHandle GetHandle() const { return handle; }
+
     virtual void Start() {} 
+    virtual void PreUpdate(double deltaTime) {}
     virtual void Update(double deltaTime) {}
+    virtual void PostUpdate(double deltaTime) {}
+    virtual void PreRender(double deltaTime) {}
     virtual void Draw(Shader& shader) {} 
-};
\ No newline at end of file
+
+    TypeId GetTypeId() const { return typeId; }
+
+    // Registered by the first AddComponent of each type
+    static const UpdateAccess& GetUpdateAccess(TypeId type) { return TypeTable()[type].access; }
+    static const char* GetTypeName(TypeId type) { return TypeTable()[type].name; }
+    // Copyable types can be instantiated from a prototype (GameObjectManager::Instantiate)
+    static bool IsCopyable(TypeId type) { return TypeTable()[type].copy != nullptr; }
+
+    // Bit per TickGroup, plus kDrawPhase: which hooks the type overrides
+    static constexpr uint32_t kDrawPhase = 1u << kTickGroupCount;
+    static constexpr uint32_t PhaseBit(TickGroup group) { return 1u << static_cast<uint32_t>(group); }
+    static uint32_t GetPhases(TypeId type) { return TypeTable()[type].phases; }
+    bool HasPhase(uint32_t phase) const { return (TypeTable()[typeId].phases & phase) != 0; }
+
+    // A hook not overridden anywhere between T and Component still has type void (Component::*)(...)
+    template <typename T>
+    static constexpr uint32_t PhasesOf() {
+        uint32_t phases = 0;
+        if constexpr (!std::is_same_v<decltype(&T::PreUpdate), void (Component::*)(double)>) phases |= PhaseBit(TickGroup::PreUpdate);
+        if constexpr (!std::is_same_v<decltype(&T::Update), void (Component::*)(double)>) phases |= PhaseBit(TickGroup::Update);
+        if constexpr (!std::is_same_v<decltype(&T::PostUpdate), void (Component::*)(double)>) phases |= PhaseBit(TickGroup::PostUpdate);
+        if constexpr (!std::is_same_v<decltype(&T::PreRender), void (Component::*)(double)>) phases |= PhaseBit(TickGroup::PreRender);
+        if constexpr (!std::is_same_v<decltype(&T::Draw), void (Component::*)(Shader&)>) phases |= kDrawPhase;
+        return phases;
+    }
+
+protected:
+    // Copies start out detached (no owner, handle or tick slots), as AddComponent would leave them
+    Component(const Component& other) : typeId(other.typeId) {}
+    Component& operator=(const Component&) { return *this; }
+
+private:
+    TypeId typeId = kInvalidType;   // set by GameObject::AddComponent
+    ComponentHandle handle;         // set by GameObjectManager
+    // Position in the manager's list of each tick group this type is in, -1 if not listed
+    std::array<int32_t, kTickGroupCount> tickSlots{ -1, -1, -1, -1 };
+
+    struct TypeInfo {
+        UpdateAccess access = UpdateAccess::Undeclared();
+        const char* name = "";
+        uint32_t phases = 0;
+        ObjectPool* pool = nullptr;
+        // Copy constructs into pool, null if the type isn't copyable
+        Component* (*copy)(const Component& source) = nullptr;
+    };
+
+    static std::array<TypeInfo, kMaxTypes>& TypeTable() {
+        static std::array<TypeInfo, kMaxTypes> table;
+        return table;
+    }
+
+    template <typename T>
+    static void RegisterType() {
+        static const bool registered = [] {
+            TypeInfo& info = TypeTable()[GetTypeId<T>()];
+            info.name = typeid(T).name();
+            info.phases = PhasesOf<T>();
+            info.pool = &ObjectPool::For<T>();
+            if constexpr (std::is_copy_constructible_v<T>) {
+                info.copy = [](const Component& source) -> Component* {
+                    return ObjectPool::New<T>(static_cast<const T&>(source));
+                };
+            }
+            if constexpr (requires { { T::GetUpdateAccess() } -> std::convertible_to<UpdateAccess>; }) {
+                info.access = T::GetUpdateAccess();
+                info.access.writes |= uint64_t(1) << GetTypeId<T>();
+            }
+            return true;
+        }();
+        (void)registered;
+    }
+
+    static TypeId NextTypeId() {
+        static std::atomic<TypeId> next{ 0 };
+        const TypeId id = next.fetch_add(1);
+        if (id >= kMaxTypes) {
+            // GameObject keeps a 64-bit mask of its component types
+            std::cerr << "ERROR::COMPONENT::TOO_MANY_TYPES (max " << kMaxTypes << ")" << std::endl;
+            std::abort();
+        }
+        return id;
+    }
+};
+
+template <typename T>
+UpdateAccess& UpdateAccess::Reads() {
+    reads |= uint64_t(1) << Component::GetTypeId<T>();
+    return *this;
+}
+
+template <typename T>
+UpdateAccess& UpdateAccess::Writes() {
+    writes |= uint64_t(1) << Component::GetTypeId<T>();
+    return *this;
+}
@@ -2,6 +2,12 @@
 #include "Component.hpp"
 #include <Shader/Shader.hpp>
 #include <Texture/Texture.hpp>
+#include <Engine/Mesh/VertexWelder.hpp>
+#include <Engine/Material.hpp>
+#include <Texture/TextureArrayBuilder.hpp>
+#include <Engine/Animation/Skeleton.hpp>
+#include <Engine/Animation/AnimationClip.hpp>
+#include <Engine/Utils/RenderQueue.hpp>
 
 #include <assimp/importer.hpp>
 #include <assimp/scene.h>
@@ -15,22 +21,106 @@
 struct SubMesh {
     unsigned int VAO, VBO, EBO;
     unsigned int indexCount;
-    // We can store a material index here later if handling multiple textures
+    unsigned int materialIndex;
+    bool skinned;
+    glm::vec4 bounds;   // local bounding sphere: xyz = center, w = radius
+    MeshHandle handle;  // in the Renderer, if there is one
 };
 
+// Skinned vertices append PackedSkinWeights (8 bytes = 2 floats) after the uv
+constexpr size_t kSkinnedVertexFloats = kWeldBaseFloats + 2;
+
+// CPU side copy of a sub-mesh, built on worker threads before the GL upload
+struct MeshData {
+    std::vector<float> vertices;
+    std::vector<unsigned int> indices;
+    unsigned int materialIndex = 0;
+    size_t floatsPerVertex = kWeldBaseFloats;
+    glm::vec4 bounds{ 0.0f };
+    WeldStats weld;
+};
+
+class Renderer;
+
+// What loading the model did (weld, texture packing), shared by the copies
+struct MeshLoadStats {
+    WeldStats weld;                        // summed over the submeshes
+    size_t uniqueTextures = 0;             // images decoded for the materials
+    TextureArrayBuilder::Stats packing;    // diffuse maps packed into arrays / atlases
+};
+
+// Loads a model and draws it with the owner's Transform.
+// With a Renderer service the submeshes are also registered there: once SetShader is called the
+// model is drawn from render packets (Renderer::Extract / Draw) and Draw(Shader&) isn't needed.
+// Copies (GameObjectManager::Instantiate) share the loaded model and the registered materials
+// instead of loading again; the last one to go frees the GL objects.
 class MeshRenderer : public Component {
+    friend class Renderer;
 public:
-    MeshRenderer(const std::string& path);
+    MeshRenderer(const std::string& path, const WeldSettings& weldSettings = WeldSettings{});
+    MeshRenderer(const MeshRenderer& other);
+    MeshRenderer& operator=(const MeshRenderer&) = delete;
     ~MeshRenderer();
 
     void Draw(Shader& shader) override;
 
+    // No Update: never holds up the parallel update
+    static UpdateAccess GetUpdateAccess() { return UpdateAccess(); }
+
+    const std::vector<Material>& GetMaterials() const { return model->materials; }
+    size_t GetSubMeshCount() const { return model->meshes.size(); }
+    const MeshLoadStats& GetLoadStats() const { return model->loadStats; }
+
+    // --- Render packets ---
+    // Shader (and an optional texture bound at unit 0 under the materials) the Renderer draws
+    // the submeshes with; until then nothing is extracted. Skinned submeshes of an owner with an
+    // Animator are drawn with skinnedShader (Skinned.vert) instead, if one is given; without it
+    // (or without an Animator) they're drawn in the bind pose with shader.
+    void SetShader(Shader* shader, std::shared_ptr<Texture> baseTexture = nullptr, Shader* skinnedShader = nullptr);
+    // 0 without a shader, or on a GameObject that isn't registered (an Instantiate prototype)
+    size_t GetPacketCount() const;
+    // One packet per submesh into out[0, GetPacketCount()); reads only the owner's Transform and
+    // Animator, so different MeshRenderers can be extracted in parallel
+    void ExtractPackets(RenderPacket* out, const RenderView& view) const;
+
+    // Null / empty for static models
+    std::shared_ptr<const Skeleton> GetSkeleton() const { return model->skeleton; }
+    const std::vector<std::shared_ptr<AnimationClip>>& GetAnimations() const { return model->animations; }
+
 private:
-    std::vector<SubMesh> meshes;
+    // Everything loaded from the file
+    struct Model {
+        std::vector<SubMesh> meshes;
+        std::vector<Material> materials;
+        std::shared_ptr<Skeleton> skeleton;
+        std::vector<std::shared_ptr<AnimationClip>> animations;
+        Renderer* renderer = nullptr;   // the submeshes are registered with, if any
+        MeshLoadStats loadStats;
+        ~Model();
+    };
+    // The model's materials registered with the Renderer (SetShader)
+    struct RenderMaterials {
+        Renderer* renderer = nullptr;
+        std::vector<MaterialHandle> handles;          // per material, plus one last for submeshes without one
+        std::vector<MaterialHandle> skinnedHandles;   // same for the skinned shader, empty without one
+        uint32_t shaderId = 0;
+        uint32_t skinnedShaderId = 0;
+        ~RenderMaterials();
+    };
+
+    std::shared_ptr<Model> model;
+    std::shared_ptr<const RenderMaterials> renderMaterials;
     std::string directory;
+    WeldSettings weldSettings;
+
+    Renderer* renderer = nullptr;
+    int32_t renderSlot = -1;
 
     // Helper functions for Assimp
     void LoadModel(const std::string& path);
-    void ProcessNode(aiNode* node, const aiScene* scene);
-    void ProcessMesh(aiMesh* mesh, const aiScene* scene);
+    void ProcessNode(aiNode* node, const aiScene* scene, std::vector<aiMesh*>& outMeshes);
+    MeshData ProcessMesh(aiMesh* mesh, const aiScene* scene) const;
+    void UploadMesh(const MeshData& data);
+    void LoadMaterials(const aiScene* scene);
+    void LoadAnimations(const aiScene* scene);
 };
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+#include "Component.hpp"
+#include <Engine/Utils/TransformBatch.hpp>
+#include <OPENGL/glm/glm.hpp>
+#include <OPENGL/glm/gtc/quaternion.hpp>
+#include <vector>
+#include <cstdint>
+
+class TransformHierarchy;
+
+// Position / rotation / scale of a GameObject, relative to its parent (or the world for roots).
+// Local and world matrices are cached and only rebuilt after something changed: setters mark this
+// transform and its whole subtree dirty, the getters (and TransformHierarchy::Update, once per
+// frame, parents before children) rebuild what's dirty.
+// Every GameObject owns exactly one, see GameObject::GetTransform().
+class Transform : public Component {
+public:
+    Transform() = default;
+    ~Transform() override;
+
+    Transform(const Transform&) = delete;
+    Transform& operator=(const Transform&) = delete;
+
+    // --- Local space ---
+    void SetLocalPosition(const glm::vec3& position);
+    void SetLocalRotation(const glm::quat& rotation);
+    // Degrees, applied X then Y then Z (the old GameObject::rotation convention)
+    void SetLocalEulerAngles(const glm::vec3& degrees);
+    void SetLocalScale(const glm::vec3& scale);
+    void SetLocalScale(float scale) { SetLocalScale(glm::vec3(scale)); }
+
+    const glm::vec3& GetLocalPosition() const { return localPosition; }
+    const glm::quat& GetLocalRotation() const { return localRotation; }
+    const glm::vec3& GetLocalScale() const { return localScale; }
+
+    // --- Hierarchy ---
+    // keepWorld = true adjusts the local values so the object doesn't move on screen
+    void SetParent(Transform* parent, bool keepWorld = false);
+    Transform* GetParent() const { return parent; }
+    const std::vector<Transform*>& GetChildren() const { return children; }
+    int GetDepth() const { return depth; }   // 0 = root
+
+    // --- Cached matrices ---
+    const glm::mat4& GetLocalMatrix() const;
+    const glm::mat4& GetWorldMatrix() const;
+    // Inverse transpose of the world 3x3, composed per level from R * inverse(S): no general inverse
+    const glm::mat3& GetNormalMatrix() const;
+    glm::vec3 GetWorldPosition() const { return glm::vec3(GetWorldMatrix()[3]); }
+
+    bool IsWorldDirty() const { return worldDirty; }
+
+private:
+    friend class TransformHierarchy;
+
+    glm::vec3 localPosition{ 0.0f };
+    glm::quat localRotation{ 1.0f, 0.0f, 0.0f, 0.0f };
+    glm::vec3 localScale{ 1.0f };
+
+    Transform* parent = nullptr;
+    std::vector<Transform*> children;
+    int depth = 0;
+
+    // Caches (rebuilt from const getters)
+    mutable glm::mat4 localMatrix{ 1.0f };
+    mutable glm::mat3 localNormal{ 1.0f };
+    mutable glm::mat4 worldMatrix{ 1.0f };
+    mutable glm::mat3 normalMatrix{ 1.0f };
+    mutable bool localDirty = false;
+    mutable bool worldDirty = false;
+    mutable bool normalDirty = false;
+
+    // Slot in the owning TransformHierarchy, -1 if not registered
+    TransformHierarchy* hierarchy = nullptr;
+    int32_t hierarchyIndex = -1;
+
+    void MarkLocalDirty();
+    void MarkWorldDirty();
+    void SetDepth(int newDepth);
+    void RebuildWorld() const;   // parent must be clean
+};
+
+// Every registered Transform in depth order, so one forward pass rebuilds all dirty world
+// matrices with each parent already up to date when its children are reached.
+// The local matrices of everything that moved are built in one SIMD batch (ComputeTrsMatrices) first.
+// GameObjectManager owns one and registers each GameObject's transform.
+class TransformHierarchy {
+public:
+    struct Stats {
+        size_t transforms = 0;
+        size_t rebuilt = 0;    // world matrices recomputed by the last Update
+    };
+
+    TransformHierarchy() = default;
+    ~TransformHierarchy();
+
+    TransformHierarchy(const TransformHierarchy&) = delete;
+    TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+    void Register(Transform* transform);
+    // Room for count more Registers without reallocating
+    void Reserve(size_t count) { ordered.reserve(ordered.size() + count); }
+    void Unregister(Transform* transform);
+
+    // Rebuilds every dirty world matrix, parents first
+    void Update();
+
+    const Stats& GetStats() const { return stats; }
+
+private:
+    friend class Transform;
+
+    std::vector<Transform*> ordered;   // by depth; nullptr = unregistered, compacted by Update
+    bool orderDirty = false;
+    size_t holes = 0;
+    Stats stats;
+
+    // Scratch for the batched local matrices, kept to avoid reallocating every frame
+    std::vector<Transform*> dirty;
+    TransformBatch batch;
+    std::vector<glm::mat4> localModels;
+    std::vector<glm::mat3> localNormals;
+
+    void Sort();
+};
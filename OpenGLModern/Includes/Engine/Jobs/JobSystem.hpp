@@ -0,0 +1,180 @@
+#pragma once
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <Engine/Jobs/WorkStealingDeque.hpp>
+#include <functional>
+#include <initializer_list>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+class JobCounter;
+
+// Where a job may run. GL calls are only legal on the thread that owns the context, so jobs that
+// touch GL are queued as MainThread and run by RunMainThreadJobs() (once per frame) or by a Wait()
+// on the main thread; workers never pick them up.
+enum class JobAffinity {
+    Any,
+    MainThread,
+};
+
+// Persistent worker pool shared by every engine system, so nothing spawns threads per frame.
+//
+// Each thread (workers + the main thread, the one that created the service) owns a work-stealing
+// deque: it pushes and pops its own jobs LIFO, idle threads steal FIFO from the others. Jobs
+// scheduled from threads outside the pool (loader threads) go to a shared injection queue.
+// Completion is tracked with JobCounters: a counter counts the unfinished jobs scheduled against
+// it, and a job can depend on counters (it's queued once all of them reach zero).
+// Wait() never blocks a pool thread idle: it runs other jobs until the counter is done.
+class JobSystem : public IService {
+    friend class ServiceLocator;
+public:
+    struct Stats {
+        uint64_t executed = 0;     // jobs run, all threads
+        uint64_t stolen = 0;       // of which taken from another thread's deque
+    };
+
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // counter (optional) is incremented now and decremented when fn returns
+    void Schedule(std::function<void()> fn, JobCounter* counter = nullptr, JobAffinity affinity = JobAffinity::Any);
+
+    // fn is queued once every counter in dependencies is done, i.e. once the jobs scheduled against
+    // them so far have finished: schedule producers before their consumers. Null entries are ignored.
+    void Schedule(std::function<void()> fn, std::initializer_list<JobCounter*> dependencies,
+        JobCounter* counter = nullptr, JobAffinity affinity = JobAffinity::Any);
+    // Same, for graphs built at runtime
+    void Schedule(std::function<void()> fn, const std::vector<JobCounter*>& dependencies,
+        JobCounter* counter = nullptr, JobAffinity affinity = JobAffinity::Any);
+
+    // Runs queued jobs until counter is done. On the main thread that includes MainThread jobs.
+    void Wait(JobCounter& counter);
+
+    // Main thread, once per frame: runs the MainThread jobs queued so far
+    void RunMainThreadJobs();
+
+    // Runs fn(i) for every i in [0, count) and returns when all are done.
+    // The range is split in halves down to a grain of max(minChunk, count / (threads * 4)) items;
+    // the caller keeps the lower half and queues the upper one, so idle threads steal the biggest
+    // pieces first and uneven items balance themselves. Safe to nest (call it from inside a job).
+    template <typename Fn>
+    void ParallelFor(size_t count, Fn&& fn, size_t minChunk = 1);
+
+    // Workers + the main thread
+    size_t GetThreadCount() const { return queues.size(); }
+    bool IsMainThread() const;
+    Stats GetStats() const;
+
+private:
+    // hardware_concurrency() - 1 workers (at least one), the main thread is the last core
+    JobSystem();
+    explicit JobSystem(unsigned int workerCount);
+
+    friend class JobCounter;
+
+    struct Job {
+        std::function<void()> fn;
+        JobCounter* counter = nullptr;
+        JobAffinity affinity = JobAffinity::Any;
+        std::atomic<uint32_t> unmetDependencies{ 0 };
+    };
+
+    // One per thread, on its own cache line: the deque and the counters only that thread writes
+    struct alignas(64) ThreadQueue {
+        WorkStealingDeque<Job> deque;
+        std::atomic<uint64_t> executed{ 0 };
+        std::atomic<uint64_t> stolen{ 0 };
+    };
+
+    static constexpr size_t kChunksPerThread = 4;
+
+    std::vector<std::unique_ptr<ThreadQueue>> queues;   // [0] = main thread, [1..] = workers
+    std::vector<std::thread> workers;
+    std::thread::id mainThread;
+
+    // Jobs from threads outside the pool, and deque overflow
+    std::mutex injectionMutex;
+    std::deque<Job*> injection;
+    std::atomic<size_t> injectionSize{ 0 };
+
+    std::mutex mainThreadMutex;
+    std::deque<Job*> mainThreadJobs;
+
+    // Jobs sitting in any deque or the injection queue; idle workers sleep while it's zero
+    std::atomic<int64_t> queuedJobs{ 0 };
+    std::atomic<uint32_t> sleepers{ 0 };
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    void Start(unsigned int workerCount);
+    void WorkerLoop(size_t index);
+
+    void ScheduleAfter(std::function<void()> fn, JobCounter* const* dependencies, size_t dependencyCount,
+        JobCounter* counter, JobAffinity affinity);
+    void Enqueue(Job* job);
+    void Release(Job* job);           // one dependency met; queues the job on the last one
+    Job* FindJob(int self);           // own deque, injection queue, then steal
+    bool RunOne();                    // runs one job this thread may run; false if none was found
+    bool RunOneMainThreadJob();
+    void Execute(Job* job, int self);
+    void Finish(JobCounter* counter);
+
+    // Index of the calling thread's queue in this system, or -1 for outside threads
+    int ThreadIndex() const;
+};
+
+// Unfinished jobs scheduled against it, plus jobs waiting for it to reach zero.
+// Reusable once done. Only destroy it when done (after JobSystem::Wait).
+class JobCounter {
+public:
+    JobCounter() = default;
+    ~JobCounter();
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return pending.load(std::memory_order_acquire) == 0; }
+    int64_t GetPending() const { return pending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<int64_t> pending{ 0 };
+    // Guards continuations and the final decrement, so a job can't be added as a continuation
+    // after the counter has already released the others
+    std::mutex mutex;
+    std::vector<JobSystem::Job*> continuations;
+};
+
+template <typename Fn>
+void JobSystem::ParallelFor(size_t count, Fn&& fn, size_t minChunk) {
+    if (count == 0) return;
+
+    const size_t grain = std::max({ minChunk, size_t(1), count / (GetThreadCount() * kChunksPerThread) });
+    if (count <= grain) {
+        for (size_t i = 0; i < count; i++) fn(i);
+        return;
+    }
+
+    JobCounter counter;
+    auto run = [&](auto& self, size_t begin, size_t end) -> void {
+        while (end - begin > grain) {
+            const size_t mid = begin + (end - begin) / 2;
+            Schedule([&self, mid, end] { self(self, mid, end); }, &counter);
+            end = mid;
+        }
+        for (size_t i = begin; i < end; i++) fn(i);
+    };
+    run(run, 0, count);
+    Wait(counter);
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Chase-Lev work-stealing deque of pointers (Le et al., "Correct and Efficient Work-Stealing for
+// Weak Memory Models"). The owning thread pushes and pops at the bottom (LIFO, cache warm);
+// any other thread steals from the top (FIFO, the oldest and usually biggest pieces of work).
+// Fixed capacity: Push returns false when full and the caller runs the item some other way.
+template <typename T>
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(size_t capacityPow2 = 4096)
+        : mask(static_cast<int64_t>(capacityPow2) - 1), buffer(capacityPow2) {}
+
+    // Owner thread only
+    bool Push(T* item) {
+        const int64_t b = bottom.load(std::memory_order_relaxed);
+        const int64_t t = top.load(std::memory_order_acquire);
+        if (b - t > mask) return false;
+        buffer[b & mask].store(item, std::memory_order_relaxed);
+        // Publishes the item (and everything written to it) to thieves that acquire bottom
+        bottom.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Owner thread only
+    T* Pop() {
+        const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+
+        T* item = nullptr;
+        if (t <= b) {
+            item = buffer[b & mask].load(std::memory_order_relaxed);
+            if (t == b) {
+                // Last item: race the thieves for it
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+        } else {
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread
+    T* Steal() {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) return nullptr;
+
+        T* item = buffer[t & mask].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;   // lost to the owner or another thief
+        }
+        return item;
+    }
+
+    // Approximate, for stats and idle checks
+    size_t Size() const {
+        const int64_t b = bottom.load(std::memory_order_relaxed);
+        const int64_t t = top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+private:
+    // top and bottom on their own cache lines: thieves hammer one, the owner the other
+    alignas(64) std::atomic<int64_t> top{ 0 };
+    alignas(64) std::atomic<int64_t> bottom{ 0 };
+    const int64_t mask;
+    std::vector<std::atomic<T*>> buffer;
+};
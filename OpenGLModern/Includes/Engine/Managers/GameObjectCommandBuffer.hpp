@@ -0,0 +1,72 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <Engine/Utils/ObjectPool.hpp>
+
+class GameObject;
+class GameObjectManager;
+
+// Structural changes (spawn, destroy, add / remove component) recorded while objects are being
+// updated and applied in one batch at a sync point (GameObjectManager::FlushCommands, which
+// UpdateAll calls when its pass is done), so nothing changes under a running loop.
+//
+// Recording is lock free: every thread appends to its own lane (registered under a lock once per
+// thread). Playback runs on the main thread, lane by lane in registration order: commands from one
+// thread apply in the order they were recorded. Destroys apply last, so an object destroyed in
+// the same batch is still valid for the commands before it.
+// Playback must not overlap recording (flush when no job is recording).
+class GameObjectCommandBuffer {
+public:
+    GameObjectCommandBuffer();
+    ~GameObjectCommandBuffer();
+
+    GameObjectCommandBuffer(const GameObjectCommandBuffer&) = delete;
+    GameObjectCommandBuffer& operator=(const GameObjectCommandBuffer&) = delete;
+
+    // Constructs T(args...) at playback, in its ObjectPool; the GameObjectManager owns it from then on
+    template <typename T, typename... Args>
+    void Spawn(Args&&... args) {
+        Spawn(std::function<std::unique_ptr<GameObject>()>(
+            [... args = std::forward<Args>(args)]() mutable -> std::unique_ptr<GameObject> {
+                return std::unique_ptr<GameObject>(ObjectPool::New<T>(std::move(args)...));
+            }));
+    }
+    // factory runs at playback, e.g. to configure the object before it's adopted
+    void Spawn(std::function<std::unique_ptr<GameObject>()> factory);
+
+    // Deletes a manager-owned object (spawned through a command buffer or GameObjectManager::Adopt).
+    // Recording the same object twice, from any threads, destroys it once.
+    void Destroy(GameObject* object);
+
+    template <typename T, typename... Args>
+    void AddComponent(GameObject* object, Args&&... args);
+
+    template <typename T>
+    void RemoveComponent(GameObject* object);
+
+    // Main thread, at a sync point
+    void Playback(GameObjectManager& manager);
+
+    size_t GetPendingCount() const;
+
+private:
+    struct Lane {
+        std::thread::id thread;
+        std::vector<std::function<void()>> commands;   // component changes
+        std::vector<std::function<std::unique_ptr<GameObject>()>> spawns;
+        std::vector<GameObject*> destroys;
+    };
+
+    // Tells buffers apart in the per-thread lane cache even if one is allocated where another was freed
+    const uint64_t id;
+    mutable std::mutex laneMutex;   // lane registration only
+    std::vector<std::unique_ptr<Lane>> lanes;
+
+    Lane& LocalLane();
+    void Record(std::function<void()> command) { LocalLane().commands.push_back(std::move(command)); }
+};
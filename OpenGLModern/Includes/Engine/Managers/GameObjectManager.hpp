@@ -1,24 +1,140 @@
 #pragma once
 #include "ServiceLocator.hpp"
+#include "GameObjectCommandBuffer.hpp"
+#include "UpdateScheduler.hpp"
+#include "UpdateLod.hpp"
+#include <Engine/GameObjectComponents/Transform.hpp>
+#include <Engine/Utils/Handle.hpp>
 #include <vector>
+#include <array>
+#include <memory>
 #include <algorithm>
+#include <thread>
+#include <cstdint>
 
 // Forward declaration
 class GameObject;
 
+// Every live GameObject, updated once per frame.
+// UpdateAll runs the tick groups in order: PreUpdate, Update, PostUpdate, PreRender. Update goes
+// object by object (GameObject::Update, which subclasses may override); the other groups walk a
+// dense list of just the components that override that hook, across all objects.
+// Each object stores its slot index, so Register/Unregister are O(1) (swap-and-pop).
+// Objects destroyed during UpdateAll only leave a null in their slot and are compacted when the
+// pass ends; objects created during UpdateAll are appended and first updated next frame.
+// Structural changes from inside updates (or from worker threads) go through GetCommands() and
+// are applied after the pass.
+// Every registered object and each of its components gets a generational handle
+// (GameObjectHandle / ComponentHandle): keep those instead of raw pointers anywhere that can
+// outlive the object, and Resolve them when needed (nullptr once it's gone).
+// With update LOD enabled (SetUpdateLod), far and off-screen objects skip Update on some frames
+// and catch up with the accumulated delta time (see UpdateLod).
+// With a JobSystem registered, UpdateAll runs on it through an UpdateScheduler (same results as
+// the serial loop, see UpdateScheduler for which components can run on workers).
 class GameObjectManager : public IService {
     friend class ServiceLocator;
+    friend class GameObject;
 public:
-    
-    
+    ~GameObjectManager();
+
     void Register(GameObject* obj);
     void Unregister(GameObject* obj);
     void UpdateAll(double deltaTime);
 
+    size_t GetObjectCount() const { return objects.size() - pendingRemovals.size(); }
+    // Components ticked in a group (Update: 0, it goes through the objects)
+    size_t GetTickCount(TickGroup group) const {
+        const size_t g = static_cast<size_t>(group);
+        return tickLists[g].size() - pendingTickRemovals[g].size();
+    }
+
+    // --- Handles ---
+    // O(1), nullptr if the object / component is gone. A read: fine from worker threads during
+    // UpdateAll (structural changes are deferred to the command buffer then)
+    GameObject* Resolve(GameObjectHandle handle) const {
+        GameObject* const* object = objectHandles.Get(handle);
+        return object ? *object : nullptr;
+    }
+    Component* Resolve(ComponentHandle handle) const {
+        Component* const* component = componentHandles.Get(handle);
+        return component ? *component : nullptr;
+    }
+    // nullptr as well if the component isn't exactly a T
+    template <typename T>
+    T* Resolve(ComponentHandle handle) const {
+        Component* component = Resolve(handle);
+        return component && component->GetTypeId() == Component::GetTypeId<T>() ? static_cast<T*>(component) : nullptr;
+    }
+
+    // Off = always the serial loop, even with a JobSystem. Defaults to on with more than one
+    // hardware thread (on one core the scheduler's extra passes are pure overhead).
+    void SetParallelUpdate(bool enabled) { parallelUpdate = enabled; }
+    // Timings of the last parallel UpdateAll
+    const UpdateScheduler::Stats& GetUpdateStats() const { return scheduler.GetStats(); }
+
+    // --- Update LOD ---
+    void SetUpdateLod(const UpdateLodSettings& settings) { lod.SetSettings(settings); }
+    // Call once per frame before UpdateAll (objects count as visible and near until the first call)
+    void SetUpdateViewer(const glm::vec3& position, const glm::mat4& viewProjection) { lod.SetViewer(position, viewProjection); }
+    const UpdateLod::Stats& GetUpdateLodStats() const { return lod.GetStats(); }
+
+    // --- Deferred structural changes ---
+    GameObjectCommandBuffer& GetCommands() { return commands; }
+    // Sync point: applies everything recorded so far (UpdateAll calls it at the end)
+    void FlushCommands();
+
+    // Takes ownership: the object lives until a Destroy command (or the manager) deletes it
+    GameObject* Adopt(std::unique_ptr<GameObject> obj);
+    // Deletes an object this manager owns; false if it doesn't own it
+    bool DestroyOwned(GameObject* obj);
+
+    // --- Bulk spawn ---
+    // One copy of prototype per entry of poses (local position / rotation / scale, as roots),
+    // owned by this manager. The copies are plain GameObjects holding copies of the prototype's
+    // components: a subclass's own members and Update aren't copied. Components share what
+    // their copy constructor shares (textures and other shared_ptr assets, a MeshRenderer's
+    // model). Pool storage for the objects and components and room in every list they join are
+    // reserved first, then everything is copied and registered in a single pass.
+    // Every component of the prototype must be copyable (Component::IsCopyable), else nothing
+    // is spawned. Main thread only; build the prototype with GameObject::Unregistered so it
+    // isn't updated itself.
+    std::vector<GameObject*> Instantiate(const GameObject& prototype, const TransformBatch& poses);
+
+    // Rebuilds the world matrices of every transform that moved, parents before children
+    void UpdateTransforms() { transforms.Update(); }
+    const TransformHierarchy& GetTransformHierarchy() const { return transforms; }
+
 private:
     GameObjectManager() = default;
     std::vector<GameObject*> objects;
-    
-    // Helper to give internal access if needed, though objects variable is now accessible to members
-    std::vector<GameObject*>& GetObjects() { return objects; }
+    TransformHierarchy transforms;
+
+    SlotMap<GameObject*, GameObject> objectHandles;
+    SlotMap<Component*, Component> componentHandles;
+
+    // Components overriding PreUpdate / PostUpdate / PreRender; each knows its slot (tickSlots)
+    std::array<std::vector<Component*>, kTickGroupCount> tickLists;
+
+    // Slots emptied while UpdateAll was iterating
+    bool updating = false;
+    std::vector<uint32_t> pendingRemovals;
+    std::array<std::vector<uint32_t>, kTickGroupCount> pendingTickRemovals;
+
+    std::vector<std::unique_ptr<GameObject>> owned;
+    GameObjectCommandBuffer commands;
+
+    bool parallelUpdate = std::thread::hardware_concurrency() > 1;
+    UpdateScheduler scheduler;
+    UpdateLod lod;   // one slot per entry of objects
+
+    // GameObject::AddComponent / RemoveComponent
+    void RegisterComponent(Component* component);
+    void UnregisterComponent(Component* component);
+
+    void UpdateObjects(size_t count, double deltaTime);
+    void TickComponents(TickGroup group, size_t count, double deltaTime);
+
+    void RemoveSlot(uint32_t slot);
+    void RemoveTickSlot(size_t group, uint32_t slot);
+    void FlushRemovals();
 };
\ No newline at end of file
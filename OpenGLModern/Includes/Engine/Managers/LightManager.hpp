@@ -9,6 +9,7 @@
 #include <OPENGL/glm/glm.hpp>
 #include <Shader/Shader.hpp> // Assuming this is where your Shader class lives
 #include <Engine/Managers/ServiceLocator.hpp>
+#include <Engine/Utils/Handle.hpp>
 // ==========================================
 // Light Types
 // ==========================================
@@ -105,6 +106,12 @@ public:
 // Light Manager
 // ==========================================
 
+using DirectionalLightHandle = Handle<DirectionalLight>;
+using PointLightHandle = Handle<PointLight>;
+using SpotLightHandle = Handle<SpotLight>;
+
+// Lights live here, packed by type; callers keep handles (Get returns nullptr once the light
+// was removed). Upload order is storage order: removing a light moves the last one into its place.
 class LightManager : public IService {
 
     friend class ServiceLocator;
@@ -113,29 +120,34 @@ public:
 
     // --- Add Lights ---
 
-    std::shared_ptr<DirectionalLight> addDirectionalLight(const glm::vec3& dir, const glm::vec3& color, float intensity = 1.0f) {
-        auto light = std::make_shared<DirectionalLight>(dir, color, intensity);
-        dirLights.push_back(light);
-        return light;
+    DirectionalLightHandle addDirectionalLight(const glm::vec3& dir, const glm::vec3& color, float intensity = 1.0f) {
+        return dirLights.Emplace(dir, color, intensity);
     }
 
-    std::shared_ptr<PointLight> addPointLight(const glm::vec3& pos, const glm::vec3& color, float intensity = 1.0f) {
-        auto light = std::make_shared<PointLight>(pos, color, intensity);
-        pointLights.push_back(light);
-        return light;
+    PointLightHandle addPointLight(const glm::vec3& pos, const glm::vec3& color, float intensity = 1.0f) {
+        return pointLights.Emplace(pos, color, intensity);
     }
 
-    std::shared_ptr<SpotLight> addSpotLight(const glm::vec3& pos, const glm::vec3& dir, const glm::vec3& color, 
-                                            float cutOffDeg = 12.5f, float outerCutOffDeg = 15.0f, float intensity = 1.0f) {
-        auto light = std::make_shared<SpotLight>(pos, dir, color, cutOffDeg, outerCutOffDeg, intensity);
-        spotLights.push_back(light);
-        return light;
+    SpotLightHandle addSpotLight(const glm::vec3& pos, const glm::vec3& dir, const glm::vec3& color, 
+                                 float cutOffDeg = 12.5f, float outerCutOffDeg = 15.0f, float intensity = 1.0f) {
+        return spotLights.Emplace(pos, dir, color, cutOffDeg, outerCutOffDeg, intensity);
     }
 
+    // --- Access ---
+    // Don't keep the pointer across add / remove calls, keep the handle
+
+    DirectionalLight* Get(DirectionalLightHandle handle) { return dirLights.Get(handle); }
+    PointLight* Get(PointLightHandle handle) { return pointLights.Get(handle); }
+    SpotLight* Get(SpotLightHandle handle) { return spotLights.Get(handle); }
+
+    bool Remove(DirectionalLightHandle handle) { return dirLights.Remove(handle); }
+    bool Remove(PointLightHandle handle) { return pointLights.Remove(handle); }
+    bool Remove(SpotLightHandle handle) { return spotLights.Remove(handle); }
+
     void clear() {
-        dirLights.clear();
-        pointLights.clear();
-        spotLights.clear();
+        dirLights.Clear();
+        pointLights.Clear();
+        spotLights.Clear();
     }
 
     // --- Main Registration Function ---
@@ -146,16 +158,16 @@ public:
         // 1. Process Directional Lights
         int activeDirLights = 0;
         for (const auto& light : dirLights) {
-            if (!light->enabled) continue;
+            if (!light.enabled) continue;
 
             // Limit to prevent array overflow in shader
             if (activeDirLights >= 4) break;
 
             std::string base = "dirLights[" + std::to_string(activeDirLights) + "]";
 
-            shader.setVec3(base + ".direction", light->direction);
-            shader.setVec3(base + ".color", light->color);
-            shader.setFloat(base + ".intensity", light->intensity);
+            shader.setVec3(base + ".direction", light.direction);
+            shader.setVec3(base + ".color", light.color);
+            shader.setFloat(base + ".intensity", light.intensity);
 
             activeDirLights++;
         }
@@ -164,20 +176,20 @@ public:
         // 2. Process Point Lights
         int activePointLights = 0;
         for (const auto& light : pointLights) {
-            if (!light->enabled) continue;
+            if (!light.enabled) continue;
 
             // Limit to prevent array overflow in shader
             if (activePointLights >= 16) break;
 
             std::string base = "pointLights[" + std::to_string(activePointLights) + "]";
 
-            shader.setVec3(base + ".position", light->position);
-            shader.setVec3(base + ".color", light->color);
-            shader.setFloat(base + ".intensity", light->intensity);
+            shader.setVec3(base + ".position", light.position);
+            shader.setVec3(base + ".color", light.color);
+            shader.setFloat(base + ".intensity", light.intensity);
 
-            shader.setFloat(base + ".constant", light->attenuation.constant);
-            shader.setFloat(base + ".linear", light->attenuation.linear);
-            shader.setFloat(base + ".quadratic", light->attenuation.quadratic);
+            shader.setFloat(base + ".constant", light.attenuation.constant);
+            shader.setFloat(base + ".linear", light.attenuation.linear);
+            shader.setFloat(base + ".quadratic", light.attenuation.quadratic);
 
             activePointLights++;
         }
@@ -186,24 +198,24 @@ public:
 
         int activeSpotLights = 0;
         for (const auto& light : spotLights) {
-            if (!light->enabled) continue;
+            if (!light.enabled) continue;
 
             // Limit to prevent shader overflow (Matching defines in GLSL)
             if (activeSpotLights >= 4) break; 
 
             std::string base = "spotLights[" + std::to_string(activeSpotLights) + "]";
 
-            shader.setVec3(base + ".position", light->position);
-            shader.setVec3(base + ".direction", light->direction);
-            shader.setVec3(base + ".color", light->color);
-            shader.setFloat(base + ".intensity", light->intensity);
+            shader.setVec3(base + ".position", light.position);
+            shader.setVec3(base + ".direction", light.direction);
+            shader.setVec3(base + ".color", light.color);
+            shader.setFloat(base + ".intensity", light.intensity);
 
-            shader.setFloat(base + ".cutOff", light->cutOff);
-            shader.setFloat(base + ".outerCutOff", light->outerCutOff);
+            shader.setFloat(base + ".cutOff", light.cutOff);
+            shader.setFloat(base + ".outerCutOff", light.outerCutOff);
 
-            shader.setFloat(base + ".constant", light->attenuation.constant);
-            shader.setFloat(base + ".linear", light->attenuation.linear);
-            shader.setFloat(base + ".quadratic", light->attenuation.quadratic);
+            shader.setFloat(base + ".constant", light.attenuation.constant);
+            shader.setFloat(base + ".linear", light.attenuation.linear);
+            shader.setFloat(base + ".quadratic", light.attenuation.quadratic);
 
             activeSpotLights++;
         }
@@ -213,7 +225,7 @@ public:
 private:
 
     LightManager() = default;
-    std::vector<std::shared_ptr<DirectionalLight>> dirLights;
-    std::vector<std::shared_ptr<PointLight>> pointLights;
-    std::vector<std::shared_ptr<SpotLight>> spotLights;
+    SlotMap<DirectionalLight> dirLights;
+    SlotMap<PointLight> pointLights;
+    SlotMap<SpotLight> spotLights;
 };
\ No newline at end of file
@@ -1,10 +1,11 @@
 #pragma once
-#include <unordered_map>
+#include <vector>
 #include <memory>
-#include <typeindex>
+#include <typeinfo>
 #include <stdexcept>
 #include <string>
 #include <iostream>
+#include <cstdint>
 
 // 1. Ensure the base interface exists
 class IService {
@@ -12,6 +13,14 @@ public:
     virtual ~IService() = default;
 };
 
+// Every service type T gets its own static slot (a template static, so the compiler generates
+// one per type): finding a service is a single pointer load, no hashing and no map.
+// GetService / TryGetService hand out shared_ptrs; hot paths (every frame, every spawn) use
+// GetServiceRef / TryGetServicePtr, which return a plain reference / pointer without touching
+// the reference count. Those stay valid until the service is replaced by another Create<T>.
+//
+// The locator owns the services in the order their types were first created and releases them
+// in reverse when it's destroyed, so services created first (the JobSystem) go last.
 class ServiceLocator {
 public:
     static ServiceLocator& Get() {
@@ -24,27 +33,75 @@ public:
 
     // --- NEW: Create and Register a service in one step ---
     // This allows passing arguments to the constructor: Create<Camera>(pos, up, yaw, pitch);
+    // Creating a T again replaces the previous one (it lives on while shared_ptrs to it do).
     template <typename T, typename... Args>
     std::shared_ptr<T> Create(Args&&... args) {
         // We use 'new' directly because ServiceLocator will be a friend
         // and can access the private constructor.
         std::shared_ptr<T> service(new T(std::forward<Args>(args)...));
-        
-        services_[std::type_index(typeid(T))] = service;
+
+        if (Slot<T>::index == kNoIndex) {
+            Slot<T>::index = static_cast<uint32_t>(services_.size());
+            services_.push_back({ nullptr, [] { Slot<T>::instance = nullptr; } });
+        }
+        // Slot first: a replaced service shutting down already sees its successor
+        Slot<T>::instance = service.get();
+        services_[Slot<T>::index].service = service;
         return service;
     }
 
     // Retrieve a service
     template <typename T>
     std::shared_ptr<T> GetService() {
-        auto it = services_.find(std::type_index(typeid(T)));
-        if (it == services_.end()) {
-            throw std::runtime_error("Service not found: " + std::string(typeid(T).name()));
-        }
-        return std::static_pointer_cast<T>(it->second);
+        if (!Slot<T>::instance) NotFound(typeid(T));
+        return std::static_pointer_cast<T>(services_[Slot<T>::index].service);
+    }
+
+    // Like GetService, for optional services: nullptr instead of throwing
+    template <typename T>
+    std::shared_ptr<T> TryGetService() {
+        if (!Slot<T>::instance) return nullptr;
+        return std::static_pointer_cast<T>(services_[Slot<T>::index].service);
     }
 
+    // Non-owning versions for hot paths: one load, no reference count traffic
+    template <typename T>
+    static T& GetServiceRef() {
+        T* service = Slot<T>::instance;
+        if (!service) NotFound(typeid(T));
+        return *service;
+    }
+
+    template <typename T>
+    static T* TryGetServicePtr() { return Slot<T>::instance; }
+
 private:
+    static constexpr uint32_t kNoIndex = ~0u;
+
+    template <typename T>
+    struct Slot {
+        static inline T* instance = nullptr;
+        static inline uint32_t index = kNoIndex;   // into services_, once a T was created
+    };
+
+    struct Entry {
+        std::shared_ptr<IService> service;
+        void (*clearSlot)();   // empties Slot<T>::instance on shutdown
+    };
+
     ServiceLocator() = default;
-    std::unordered_map<std::type_index, std::shared_ptr<IService>> services_;
-};
\ No newline at end of file
+    ~ServiceLocator() {
+        // Last created type first; each slot is emptied before its service goes, so a service
+        // shutting down sees the ones already gone as missing
+        for (auto it = services_.rbegin(); it != services_.rend(); ++it) {
+            it->clearSlot();
+            it->service.reset();
+        }
+    }
+
+    [[noreturn]] static void NotFound(const std::type_info& type) {
+        throw std::runtime_error("Service not found: " + std::string(type.name()));
+    }
+
+    std::vector<Entry> services_;
+};
@@ -0,0 +1,96 @@
+#pragma once
+#include <Engine/Utils/Frustum.hpp>
+#include <OPENGL/glm/glm.hpp>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+class GameObject;
+
+struct UpdateLodSettings {
+    bool enabled = false;
+    // Closer than this (divided by the object's importance) an object updates every frame; each
+    // doubling of the distance past it halves the rate
+    float fullRateDistance = 25.0f;
+    // Longest gap between two updates, in frames (a power of two)
+    uint32_t maxInterval = 8;
+    // Gap for objects outside the view frustum (at least their distance gap)
+    uint32_t hiddenInterval = 8;
+    // Every object's bucket is re-evaluated once every this many frames (a slice per frame)
+    uint32_t rebucketFrames = 8;
+};
+
+// Update level of detail for GameObjectManager::UpdateAll: each object sits in a bucket that
+// updates every frame, every 2nd, every 4th, ... chosen from its distance to the viewer, whether
+// its bounding sphere is in the view frustum, and its update importance (GameObject::
+// SetUpdateImportance). A skipped frame's delta time is accumulated, so the next update gets
+// the whole time since the last one.
+//
+// Inside a bucket of interval N each object has a phase (0..N-1) and updates on the frames
+// where frame % N == phase. New members take the least loaded phase, so the throttled work is
+// spread evenly over the frames instead of all landing on the same one.
+//
+// Bookkeeping is one small slot per object, kept parallel to the manager's object list; only
+// the PreUpdate / PostUpdate / PreRender groups ignore it (they're not throttled).
+class UpdateLod {
+public:
+    static constexpr uint32_t kMaxLevels = 7;   // intervals 1 .. 64
+
+    struct Stats {
+        size_t updated = 0;     // objects updated in the last frame
+        size_t skipped = 0;
+        size_t hidden = 0;      // outside the frustum at their last evaluation
+        std::array<size_t, kMaxLevels> buckets{};   // objects per interval (1, 2, 4, ...)
+        // Updates per frame over the next maxInterval frames, as the buckets stand
+        size_t busiestFrame = 0;
+        size_t quietestFrame = 0;
+    };
+
+    UpdateLod();
+
+    void SetSettings(const UpdateLodSettings& settings);
+    const UpdateLodSettings& GetSettings() const { return settings; }
+    bool IsEnabled() const { return settings.enabled; }
+
+    void SetViewer(const glm::vec3& position, const glm::mat4& viewProjection);
+
+    // --- Slots, mirroring GameObjectManager's object list (same swap-and-pop) ---
+    void PushSlot();
+    void Reserve(size_t count) { slots.reserve(slots.size() + count); }
+    void RemoveSlot(uint32_t slot);
+
+    // Before the Update pass: re-buckets a slice of objects[0, count) and fills GetDeltas()
+    void BeginFrame(const std::vector<GameObject*>& objects, size_t count, double deltaTime);
+    // Per slot for this frame: the delta time to update with, or < 0 to skip
+    const std::vector<double>& GetDeltas() const { return deltas; }
+
+    const Stats& GetStats() const { return stats; }
+
+private:
+    struct Slot {
+        double accumulated = 0.0;   // delta time of the frames skipped since the last update
+        uint8_t level = 0;          // interval = 1 << level
+        uint8_t phase = 0;
+        bool hidden = false;
+    };
+
+    UpdateLodSettings settings;
+    glm::vec3 viewerPosition{ 0.0f };
+    Frustum frustum;
+    bool hasViewer = false;
+
+    std::vector<Slot> slots;
+    std::vector<double> deltas;
+    // Members per level and phase (level l has 1 << l phases)
+    std::array<std::vector<uint32_t>, kMaxLevels> phaseLoad;
+    uint64_t frame = 0;
+    size_t rebucketCursor = 0;
+    Stats stats;
+
+    uint8_t ChooseLevel(const GameObject& object, bool& hidden) const;
+    void Assign(Slot& slot, uint8_t level);
+    void Leave(const Slot& slot) { phaseLoad[slot.level][slot.phase]--; }
+    uint8_t MaxLevel() const;
+    void FinishStats();
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include <Engine/GameObjectComponents/Component.hpp>
+#include <Engine/Jobs/JobSystem.hpp>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+class GameObject;
+
+// Runs the Update group of GameObjectManager::UpdateAll on the JobSystem with the same results as the serial
+// loop (every object in order, every component in AddComponent order).
+//
+// Objects are walked in order and split into runs of "parallel" objects, cut by "serial" ones:
+//  - parallel: a plain GameObject whose components with an Update all declare their UpdateAccess
+//    (and, if one of them touches the Transform, that transform is outside any hierarchy, since
+//    moving it would dirty other objects' transforms)
+//  - serial: everything else (GameObject subclasses with their own Update, undeclared components);
+//    updated on the calling thread exactly where the serial loop would
+// Inside a run the updates only touch their own object, so each component type becomes one system
+// updated over all its instances at once (split across workers). Systems depend on each other when
+// some object has conflicting components of both types, in the order the object has them; systems
+// with no path between them run at the same time. If two objects order a conflicting pair differently
+// there's no such order: that run is updated object by object in parallel instead.
+// Reading a transform rebuilds its cached matrices, so dirty transforms are rebuilt while gathering and
+// readers that come after a transform writer are ordered among themselves like writers.
+class UpdateScheduler {
+public:
+    struct SystemTiming {
+        Component::TypeId type = Component::kInvalidType;
+        std::string name;
+        size_t instances = 0;   // component updates in the last pass
+        double cpuMs = 0.0;     // summed over the threads that ran them
+    };
+
+    struct Stats {
+        double wallMs = 0.0;
+        double cpuMs = 0.0;           // all update work (serial objects included), summed over threads
+        double parallelism = 0.0;     // cpuMs / wallMs: 1 = serial, N = N threads busy the whole time
+        size_t parallelObjects = 0;
+        size_t serialObjects = 0;
+        size_t runs = 0;              // runs of parallel objects
+        size_t objectOrderRuns = 0;   // of which had no system order and ran object by object
+        double serialMs = 0.0;        // serial objects
+        std::vector<SystemTiming> systems;   // by type id, systems that ran
+    };
+
+    // Updates objects[0, count); null entries (destroyed during the pass) are skipped.
+    // deltas (UpdateLod): per object delta time instead of deltaTime, < 0 = skip the object
+    void Run(std::vector<GameObject*>& objects, size_t count, double deltaTime, JobSystem& jobs,
+        const std::vector<double>* deltas = nullptr);
+
+    const Stats& GetStats() const { return stats; }
+
+private:
+    // Runs smaller than this aren't worth the hand-off
+    static constexpr size_t kMinParallelObjects = 64;
+    // Component updates per job within a system
+    static constexpr size_t kInstancesPerChunk = 256;
+
+    Stats stats;
+
+    struct Instance {
+        Component* component;
+        double deltaTime;
+    };
+
+    // Per-run scratch, kept between frames
+    const std::vector<double>* deltas = nullptr;   // of the current Run
+    double frameDelta = 0.0;
+    uint64_t present = 0;   // systems in the current run
+    std::array<std::vector<Instance>, Component::kMaxTypes> instances;
+    std::array<uint64_t, Component::kMaxTypes> successors{};   // bit per system that must run after
+    std::array<JobCounter, Component::kMaxTypes> counters;
+    std::array<std::atomic<int64_t>, Component::kMaxTypes> systemNs{};
+    std::array<size_t, Component::kMaxTypes> systemInstances{};
+    std::atomic<int64_t> objectOrderNs{ 0 };
+
+    // Throttled objects sit this frame out; the rest get their own delta time
+    bool IsSkipped(size_t slot) const { return deltas && (*deltas)[slot] < 0.0; }
+    double DeltaAt(size_t slot) const { return deltas ? (*deltas)[slot] : frameDelta; }
+
+    bool IsParallel(const GameObject* object) const;
+    void BeginRun();
+    void Gather(const GameObject* object, double deltaTime);
+    void RunParallel(std::vector<GameObject*>& objects, size_t begin, size_t end, JobSystem& jobs);
+    void RunObjectOrder(std::vector<GameObject*>& objects, size_t begin, size_t end, JobSystem& jobs);
+    void RunSystem(Component::TypeId type, JobSystem& jobs);
+    void FinishStats(double wallMs);
+};
@@ -0,0 +1,49 @@
+#pragma once
+#include <Texture/Texture.hpp>
+#include <Texture/TextureArray.hpp>
+#include <Shader/Shader.hpp>
+#include <OPENGL/glm/glm.hpp>
+#include <memory>
+#include <string>
+
+// Texture slots used by the material (match the samplers in the shaders)
+enum class MaterialSlot : unsigned int {
+    Diffuse = 0,
+    Specular = 1,
+    Normal = 2,
+    // Not 3: that's AnimationSystem::kPaletteTextureSlot, a samplerBuffer in the skinned shader
+    DiffuseArray = 4
+};
+
+// Surface description imported from a model file.
+// Textures are shared, so several materials (or meshes) can point at the same GL texture.
+struct Material {
+    std::string name;
+    std::shared_ptr<Texture> diffuse;
+    std::shared_ptr<Texture> specular;
+    std::shared_ptr<Texture> normal;
+
+    // Set instead of `diffuse` when the map was packed by TextureArrayBuilder: materials sharing
+    // the array draw under one bind, only the layer and uv transform uniforms change
+    std::shared_ptr<TextureArray> diffuseArray;
+    int diffuseLayer = 0;
+    glm::vec4 uvTransform{ 1.0f, 1.0f, 0.0f, 0.0f };
+
+    // boundArray: the array currently bound at DiffuseArray (skips the rebind), updated here
+    void Bind(const Shader& shader, const TextureArray** boundArray = nullptr) const {
+        if (diffuse) diffuse->bind(static_cast<unsigned int>(MaterialSlot::Diffuse));
+        if (specular) specular->bind(static_cast<unsigned int>(MaterialSlot::Specular));
+        if (normal) normal->bind(static_cast<unsigned int>(MaterialSlot::Normal));
+
+        shader.setBool("useDiffuseArray", diffuseArray != nullptr);
+        if (!diffuseArray) return;
+
+        if (!boundArray || *boundArray != diffuseArray.get()) {
+            diffuseArray->bind(static_cast<unsigned int>(MaterialSlot::DiffuseArray));
+            shader.setInt("diffuseArray", static_cast<int>(MaterialSlot::DiffuseArray));
+            if (boundArray) *boundArray = diffuseArray.get();
+        }
+        shader.setFloat("diffuseLayer", static_cast<float>(diffuseLayer));
+        shader.setVec4("uvTransform", uvTransform);
+    }
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+// Tolerances used when deciding whether two vertices are "the same".
+// Each attribute is snapped to a grid of its epsilon, so values closer than
+// epsilon usually weld, and values further apart than epsilon never do.
+// Values more than 2^62 epsilons from zero don't fit the grid and only weld when bit-identical.
+struct WeldSettings {
+    float positionEpsilon = 1e-5f;
+    float normalEpsilon = 1e-3f;
+    float uvEpsilon = 1e-5f;
+};
+
+struct WeldStats {
+    size_t verticesBefore = 0;
+    size_t verticesAfter = 0;
+
+    float ReductionPercent() const {
+        if (verticesBefore == 0) return 0.0f;
+        return 100.0f * (1.0f - static_cast<float>(verticesAfter) / static_cast<float>(verticesBefore));
+    }
+};
+
+// Packed vertex layout produced by MeshRenderer: 3 pos + 3 normal + 2 uv
+constexpr size_t kWeldPositionOffset = 0;
+constexpr size_t kWeldNormalOffset = 3;
+constexpr size_t kWeldUVOffset = 6;
+constexpr size_t kWeldBaseFloats = 8;
+
+// Welds duplicated vertices in an interleaved float buffer and remaps the index buffer.
+// floatsPerVertex must be >= 8; any floats past the uv are compared bit-exactly.
+// The first occurrence of each unique vertex is kept, so vertex order stays stable.
+WeldStats WeldVertices(std::vector<float>& vertices, size_t floatsPerVertex,
+                       std::vector<unsigned int>& indices, const WeldSettings& settings = WeldSettings{});
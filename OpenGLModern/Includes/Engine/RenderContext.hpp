@@ -18,16 +18,21 @@ public:
     const glm::mat4& GetProjectionMatrix() const;
     LightManager& GetLightManager();
     Camera* GetMainCamera();
+    int GetViewportWidth() const { return viewportWidth; }
+    int GetViewportHeight() const { return viewportHeight; }
 
     // --- Setters ---
     void SetViewMatrix(const glm::mat4& v);
     void SetProjectionMatrix(const glm::mat4& p);
     void SetLightManager(std::shared_ptr<LightManager> lm);
     void SetPerspective(float fov, float aspect, float nearPlane, float farPlane);
+    void SetViewportSize(int width, int height);
 
 private:
     std::unique_ptr<Camera> mainCam;
     std::shared_ptr<LightManager> lightmanager;
     glm::mat4 view;
     glm::mat4 projection;
+    int viewportWidth = 0;
+    int viewportHeight = 0;
 };
\ No newline at end of file
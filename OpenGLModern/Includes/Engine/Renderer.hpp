@@ -0,0 +1,92 @@
+#pragma once
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <Engine/Utils/RenderQueue.hpp>
+#include <Engine/Utils/Handle.hpp>
+#include <OPENGL/glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+class Shader;
+class Texture;
+class MeshRenderer;
+struct Material;
+
+// GPU side of a submesh, what a packet's MeshHandle resolves to
+struct RenderMesh {
+    unsigned int vao = 0;
+    unsigned int indexCount = 0;
+    glm::vec4 bounds{ 0.0f };   // local bounding sphere: xyz = center, w = radius
+};
+
+// What a packet's MaterialHandle resolves to
+struct RenderMaterial {
+    Shader* shader = nullptr;
+    const Material* material = nullptr;     // null: only the base texture
+    std::shared_ptr<Texture> baseTexture;   // bound at unit 0 under the material's own maps
+    uint32_t shaderId = 0;                  // small number for the sort key, one per Shader
+};
+
+// Draws the scene from render packets instead of from the GameObjects.
+// Once the updates are done, Extract() copies what each registered MeshRenderer would draw
+// (mesh, material, world matrix, bounds, sort key) into a flat RenderQueue, frustum culls and
+// sorts it; Draw() then walks the sorted packets, setting camera and light uniforms once per
+// shader and textures once per material. Draw never touches a GameObject.
+//
+// MeshRenderers register themselves (and their submeshes and materials) when they're created
+// while a Renderer exists; one without a shader (MeshRenderer::SetShader) or on an unregistered
+// GameObject (a prototype) is skipped.
+class Renderer : public IService {
+    friend class ServiceLocator;
+public:
+    struct Stats {
+        size_t extracted = 0;       // packets copied out of the scene
+        size_t culled = 0;          // of those, outside the view
+        size_t drawCalls = 0;
+        size_t shaderChanges = 0;
+        size_t materialChanges = 0;
+        double extractMs = 0.0;
+        double drawMs = 0.0;
+    };
+
+    // --- Resources ---
+    MeshHandle AddMesh(const RenderMesh& mesh);
+    void RemoveMesh(MeshHandle handle);
+    const RenderMesh* GetMesh(MeshHandle handle) const { return meshes.Get(handle); }
+
+    MaterialHandle AddMaterial(Shader* shader, const Material* material, std::shared_ptr<Texture> baseTexture = nullptr);
+    void RemoveMaterial(MaterialHandle handle);
+    const RenderMaterial* GetMaterial(MaterialHandle handle) const { return materials.Get(handle); }
+
+    // --- Sources (called by MeshRenderer) ---
+    void Register(MeshRenderer* source);
+    void Unregister(MeshRenderer* source);
+
+    // --- Frame ---
+    // After the updates and GameObjectManager::UpdateTransforms: world matrices are read from
+    // worker threads, so none may be left dirty
+    void Extract(const RenderView& view);
+    // GL thread: draws the packets of the last Extract
+    void Draw();
+
+    const RenderQueue& GetQueue() const { return queue; }
+    const Stats& GetStats() const { return stats; }
+
+private:
+    Renderer() = default;
+
+    // Sources extracted per work item; each is only a few matrix products
+    static constexpr size_t kExtractBatch = 64;
+
+    SlotMap<RenderMesh> meshes;
+    SlotMap<RenderMaterial> materials;
+    std::unordered_map<const Shader*, uint32_t> shaderIds;
+
+    std::vector<MeshRenderer*> sources;
+    std::vector<size_t> offsets;   // first packet of each source, sources.size() + 1 entries
+
+    RenderQueue queue;
+    RenderView view;
+    Stats stats;
+};
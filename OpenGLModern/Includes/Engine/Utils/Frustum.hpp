@@ -0,0 +1,32 @@
+#pragma once
+#include <OPENGL/glm/glm.hpp>
+#include <array>
+
+// The six planes of a view-projection matrix (Gribb / Hartmann), normals pointing inside, for
+// conservative visibility tests in world space
+struct Frustum {
+    std::array<glm::vec4, 6> planes{};   // xyz = normal, w = distance
+
+    static Frustum FromMatrix(const glm::mat4& viewProjection) {
+        // Rows of the matrix (glm is column-major)
+        const glm::vec4 row0(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+        const glm::vec4 row1(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+        const glm::vec4 row2(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+        const glm::vec4 row3(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+        Frustum frustum;
+        frustum.planes = { row3 + row0, row3 - row0, row3 + row1, row3 - row1, row3 + row2, row3 - row2 };
+        for (glm::vec4& plane : frustum.planes) {
+            plane /= glm::length(glm::vec3(plane));
+        }
+        return frustum;
+    }
+
+    // False only if the sphere is entirely outside one of the planes
+    bool IntersectsSphere(const glm::vec3& center, float radius) const {
+        for (const glm::vec4& plane : planes) {
+            if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) return false;
+        }
+        return true;
+    }
+};
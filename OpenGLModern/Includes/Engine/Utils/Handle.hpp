@@ -0,0 +1,136 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+// Weak reference to an object in a SlotMap: slot index + generation, 64 bits, trivially copyable.
+// The generation changes every time the slot is reused, so a handle kept after its object was
+// removed resolves to nullptr instead of to whatever lives there now. Safe to store anywhere and
+// to hand to other threads; resolving is a read (see SlotMap for when that's safe).
+// T only tags the handle, so a Handle<SpotLight> can't be passed where a Handle<GameObject> goes.
+template <typename T>
+struct Handle {
+    static constexpr uint32_t kInvalidIndex = ~0u;
+
+    uint32_t index = kInvalidIndex;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != kInvalidIndex; }
+    uint64_t Value() const { return uint64_t(generation) << 32 | index; }
+    static Handle FromValue(uint64_t value) { return { uint32_t(value), uint32_t(value >> 32) }; }
+
+    bool operator==(const Handle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+};
+
+template <typename T>
+struct std::hash<Handle<T>> {
+    size_t operator()(const Handle<T>& handle) const { return std::hash<uint64_t>{}(handle.Value()); }
+};
+
+// Values stored densely (iterate them like a vector, in no particular order) and addressed by
+// Handle. Insert / Remove / Get are O(1): a slot array maps handle index -> dense position and
+// remembers the generation; Remove moves the last value into the hole (swap-and-pop).
+// Pointers to values are invalidated by Insert and Remove; handles are not.
+// Not synchronized: Get from any thread is fine while nothing is inserted or removed.
+// Tag is what the handles name, for maps that store something else (SlotMap<GameObject*, GameObject>).
+template <typename T, typename Tag = T>
+class SlotMap {
+public:
+    using HandleType = Handle<Tag>;
+
+    template <typename... Args>
+    HandleType Emplace(Args&&... args) {
+        uint32_t index;
+        if (freeHead != kNone) {
+            index = freeHead;
+            freeHead = slots[index].dense;
+        } else {
+            index = static_cast<uint32_t>(slots.size());
+            slots.push_back({});
+        }
+
+        Slot& slot = slots[index];
+        slot.dense = static_cast<uint32_t>(values.size());
+        values.emplace_back(std::forward<Args>(args)...);
+        denseToSlot.push_back(index);
+        return { index, slot.generation };
+    }
+
+    HandleType Insert(T value) { return Emplace(std::move(value)); }
+
+    // Room for count more values (and their slots) without reallocating
+    void Reserve(size_t count) {
+        values.reserve(values.size() + count);
+        denseToSlot.reserve(denseToSlot.size() + count);
+        slots.reserve(slots.size() + count);
+    }
+
+    // False if the handle was already stale
+    bool Remove(HandleType handle) {
+        if (!Contains(handle)) return false;
+
+        Slot& slot = slots[handle.index];
+        const uint32_t dense = slot.dense;
+        const uint32_t last = static_cast<uint32_t>(values.size()) - 1;
+        if (dense != last) {
+            values[dense] = std::move(values[last]);
+            denseToSlot[dense] = denseToSlot[last];
+            slots[denseToSlot[dense]].dense = dense;
+        }
+        values.pop_back();
+        denseToSlot.pop_back();
+
+        // Retire this generation (0 is never handed out, so a zeroed handle never resolves)
+        if (++slot.generation == 0) slot.generation = 1;
+        slot.dense = freeHead;
+        freeHead = handle.index;
+        return true;
+    }
+
+    bool Contains(HandleType handle) const {
+        return handle.index < slots.size() && slots[handle.index].generation == handle.generation &&
+            handle.generation != 0 && IsLive(handle.index);
+    }
+
+    // nullptr for stale handles
+    T* Get(HandleType handle) { return Contains(handle) ? &values[slots[handle.index].dense] : nullptr; }
+    const T* Get(HandleType handle) const { return Contains(handle) ? &values[slots[handle.index].dense] : nullptr; }
+
+    // Handle of the value at a dense position (e.g. while iterating)
+    HandleType HandleAt(size_t dense) const {
+        const uint32_t index = denseToSlot[dense];
+        return { index, slots[index].generation };
+    }
+
+    size_t Size() const { return values.size(); }
+    bool Empty() const { return values.empty(); }
+    void Clear() {
+        while (!values.empty()) Remove(HandleAt(values.size() - 1));
+    }
+
+    auto begin() { return values.begin(); }
+    auto end() { return values.end(); }
+    auto begin() const { return values.begin(); }
+    auto end() const { return values.end(); }
+
+private:
+    static constexpr uint32_t kNone = ~0u;
+
+    struct Slot {
+        uint32_t dense = 0;        // position in values while live, next free slot while free
+        uint32_t generation = 1;
+    };
+
+    std::vector<T> values;
+    std::vector<uint32_t> denseToSlot;
+    std::vector<Slot> slots;
+    uint32_t freeHead = kNone;
+
+    bool IsLive(uint32_t index) const {
+        const uint32_t dense = slots[index].dense;
+        return dense < denseToSlot.size() && denseToSlot[dense] == index;
+    }
+};
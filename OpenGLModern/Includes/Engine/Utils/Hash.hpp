@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// Fast 64-bit content hash (murmur-style word mixing, 8 bytes per step).
+// Used to deduplicate assets by content, so it has to chew through whole images quickly.
+// Not for security.
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0x9E3779B97F4A7C15ull) {
+    auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+    constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+    constexpr uint64_t c2 = 0x4cf5ad432745937full;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t h = seed ^ (size * c1);
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t k;
+        std::memcpy(&k, bytes + i, sizeof(k));
+        k *= c1;
+        k = rotl(k, 31);
+        k *= c2;
+        h ^= k;
+        h = rotl(h, 27) * 5 + 0x52dce729;
+    }
+
+    uint64_t tail = 0;
+    for (size_t shift = 0; i < size; i++, shift += 8) {
+        tail |= static_cast<uint64_t>(bytes[i]) << shift;
+    }
+    h ^= rotl(tail * c1, 31) * c2;
+
+    // Final avalanche
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <new>
+#include <utility>
+#include <typeinfo>
+#include <cstdint>
+#include <cstddef>
+
+// Slab allocator for objects of one size: slots carved out of contiguous chunks (about 64 KiB
+// each), O(1) Allocate / Free through an intrusive free list. Freed slots are reused last in,
+// first out, so a spawn lands where the latest despawn was, in memory that's still warm, and
+// objects of one type stay packed in a few chunks instead of spread over the whole heap.
+// Chunks are kept until the pool dies (pools grow to their peak, they don't shrink).
+//
+// Every slot starts with a pointer to its pool, so Free needs nothing but the object's address
+// and works for any pool (that's what Component / GameObject::operator delete rely on).
+//
+// Not synchronized, like the GameObjectManager these objects register with: create and destroy
+// components and GameObjects on the main thread (workers go through GameObjectCommandBuffer).
+class ObjectPool {
+public:
+    struct Stats {
+        std::string name;
+        size_t objectSize = 0;
+        size_t slotSize = 0;        // object + pool pointer, padded to the alignment
+        size_t allocations = 0;     // since the pool was created
+        size_t frees = 0;
+        size_t live = 0;
+        size_t peak = 0;
+        size_t chunks = 0;
+        size_t capacity = 0;        // slots in all chunks
+        size_t reservedBytes = 0;
+    };
+
+    ObjectPool(std::string name, size_t size, size_t alignment);
+    ~ObjectPool();
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Uninitialized storage for one object
+    void* Allocate();
+    // object must come from Allocate (of any pool)
+    static void Free(void* object);
+    // Room for count more objects without growing in between: what the free list lacks comes as
+    // one chunk, handed out first and in address order, so a batch lands back to back
+    void Reserve(size_t count);
+
+    const Stats& GetStats() const { return stats; }
+
+    // --- Pools ---
+    // Both live until the process ends (never destroyed, so objects owned by other statics can
+    // still be freed at exit)
+
+    // One pool per type
+    template <typename T>
+    static ObjectPool& For() {
+        static ObjectPool& pool = Leak(typeid(T).name(), sizeof(T), alignof(T));
+        return pool;
+    }
+    // Shared by every type of this size (rounded up to 16 bytes) and alignment, for plain new
+    static ObjectPool& ForSize(size_t size, size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+    // T from its own pool; delete it (or let a unique_ptr / shared_ptr do it) if T gets its
+    // operator delete from Component or GameObject, else call Delete
+    template <typename T, typename... Args>
+    static T* New(Args&&... args) {
+        ObjectPool& pool = For<T>();
+        void* storage = pool.Allocate();
+        // GameObject's constructor throws without a GameObjectManager; give the slot back
+        try {
+            return ::new (storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            Free(storage);
+            throw;
+        }
+    }
+    template <typename T>
+    static void Delete(T* object) {
+        if (!object) return;
+        object->~T();
+        Free(object);
+    }
+
+    // Stats of every pool, in creation order
+    static std::vector<Stats> GetAllStats();
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    Stats stats;
+    size_t alignment;
+    size_t headerSize;        // pool pointer, padded so the object is aligned
+    size_t slotsPerChunk;
+    std::vector<unsigned char*> chunks;
+    FreeSlot* freeList = nullptr;
+
+    static ObjectPool& Leak(std::string name, size_t size, size_t alignment);
+    void Grow(size_t slots);
+};
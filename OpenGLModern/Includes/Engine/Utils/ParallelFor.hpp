@@ -0,0 +1,46 @@
+#pragma once
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <Engine/Jobs/JobSystem.hpp>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+
+// Runs fn(i) for every i in [0, count) spread over the available cores.
+// The calling thread takes part in the work, so count == 1 never spawns a thread.
+// With a JobSystem registered the items run as jobs on its workers (no threads are created);
+// without one (tools, tests) threads are spawned for the call.
+// Indices are handed out one at a time (in small chunks on the JobSystem), which suits coarse
+// work items (one submesh, one image) where each call is much more expensive than the hand-off.
+template <typename Fn>
+void ParallelFor(size_t count, Fn&& fn) {
+    if (count == 0) return;
+
+    if (JobSystem* jobs = ServiceLocator::TryGetServicePtr<JobSystem>()) {
+        jobs->ParallelFor(count, fn);
+        return;
+    }
+
+    size_t workerCount = std::max(1u, std::thread::hardware_concurrency());
+    workerCount = std::min(workerCount, count);
+
+    std::atomic<size_t> next{ 0 };
+    auto worker = [&]() {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            fn(i);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workerCount - 1);
+    for (size_t t = 1; t < workerCount; t++) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <Engine/Utils/Handle.hpp>
+#include <Engine/Utils/Frustum.hpp>
+#include <OPENGL/glm/glm.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// What the handles in a packet name; the tables live in Renderer
+struct RenderMesh;
+struct RenderMaterial;
+using MeshHandle = Handle<RenderMesh>;
+using MaterialHandle = Handle<RenderMaterial>;
+
+// Where the frame is drawn from
+struct RenderView {
+    glm::mat4 view{ 1.0f };
+    glm::mat4 projection{ 1.0f };
+    glm::vec3 position{ 0.0f };
+};
+
+// Everything the renderer needs to draw one submesh, copied out of the scene by the extraction.
+// Plain data only (no pointers into GameObjects), so once extracted the packets can be culled,
+// sorted and drawn while the simulation moves on.
+struct RenderPacket {
+    glm::mat4 world{ 1.0f };
+    glm::vec4 bounds{ 0.0f };   // world space bounding sphere: xyz = center, w = radius
+    uint64_t sortKey = 0;       // see RenderQueue::MakeSortKey
+    MeshHandle mesh;
+    MaterialHandle material;
+    uint32_t animation = ~0u;   // AnimationSystem instance of a skinned mesh, ~0u otherwise
+    glm::mat3 normal{ 1.0f };   // Transform::GetNormalMatrix (cached there): no inverse per draw
+};
+static_assert(std::is_trivially_copyable_v<RenderPacket>, "RenderPacket must stay plain data");
+
+// One frame's packets. The extraction sizes the array up front (Resize) and every source writes
+// its own range of Data(), so sources can be extracted on several threads without locking.
+// Cull then drops what's outside the view and Sort orders the rest for drawing.
+class RenderQueue {
+public:
+    // Shader (16 bits), then material (24 bits), then distance (24 bits): draws sharing a shader
+    // and material end up next to each other, front to back inside a material
+    static uint64_t MakeSortKey(uint32_t shaderId, uint32_t materialIndex, float distance);
+
+    void Resize(size_t count);
+    RenderPacket* Data() { return packets.data(); }
+    size_t Size() const { return packets.size(); }
+
+    // Removes the packets whose bounds are entirely outside the frustum; returns how many
+    size_t Cull(const Frustum& frustum);
+
+    // Orders by sort key (indices are sorted, the packets stay where they are)
+    void Sort();
+
+    const std::vector<RenderPacket>& GetPackets() const { return packets; }
+    // Packet indices in draw order (valid after Sort)
+    const std::vector<uint32_t>& GetOrder() const { return order; }
+
+private:
+    std::vector<RenderPacket> packets;
+    std::vector<std::pair<uint64_t, uint32_t>> keys;
+    std::vector<uint32_t> order;
+};
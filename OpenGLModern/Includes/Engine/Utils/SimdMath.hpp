@@ -0,0 +1,87 @@
+#pragma once
+#include <cmath>
+
+// SSE is baseline on every x64 target we ship (MSVC x64 doesn't define __SSE2__, hence _M_X64)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENGINE_SIMD_SSE 1
+#include <immintrin.h>
+#endif
+
+// AVX2/FMA only when the compiler targets it (ENGINE_ENABLE_AVX2 in CMake: /arch:AVX2 or -mavx2 -mfma)
+#if defined(ENGINE_SIMD_SSE) && defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define ENGINE_SIMD_AVX2 1
+#endif
+
+// Small 4-wide helpers used by hot CPU loops (animation, transforms).
+// All matrices are column-major float[16], the same memory layout as glm::mat4.
+namespace simd {
+
+    // out = a * b
+    inline void Mat4Mul(const float* a, const float* b, float* out) {
+#ifdef ENGINE_SIMD_SSE
+        const __m128 a0 = _mm_loadu_ps(a + 0);
+        const __m128 a1 = _mm_loadu_ps(a + 4);
+        const __m128 a2 = _mm_loadu_ps(a + 8);
+        const __m128 a3 = _mm_loadu_ps(a + 12);
+        for (int j = 0; j < 4; j++) {
+            const float* bc = b + j * 4;
+            __m128 r = _mm_mul_ps(a0, _mm_set1_ps(bc[0]));
+            r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(bc[1])));
+            r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(bc[2])));
+            r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(bc[3])));
+            _mm_storeu_ps(out + j * 4, r);
+        }
+#else
+        float tmp[16];
+        for (int j = 0; j < 4; j++) {
+            for (int i = 0; i < 4; i++) {
+                tmp[j * 4 + i] = a[0 * 4 + i] * b[j * 4 + 0] + a[1 * 4 + i] * b[j * 4 + 1]
+                               + a[2 * 4 + i] * b[j * 4 + 2] + a[3 * 4 + i] * b[j * 4 + 3];
+            }
+        }
+        for (int k = 0; k < 16; k++) out[k] = tmp[k];
+#endif
+    }
+
+    // out = a + (b - a) * t, 4 floats
+    inline void Lerp4(const float* a, const float* b, float t, float* out) {
+#ifdef ENGINE_SIMD_SSE
+        const __m128 va = _mm_loadu_ps(a);
+        const __m128 vb = _mm_loadu_ps(b);
+        _mm_storeu_ps(out, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), _mm_set1_ps(t))));
+#else
+        for (int i = 0; i < 4; i++) out[i] = a[i] + (b[i] - a[i]) * t;
+#endif
+    }
+
+    // Normalized lerp between two unit quaternions (takes the short way round)
+    inline void Nlerp4(const float* a, const float* b, float t, float* out) {
+#ifdef ENGINE_SIMD_SSE
+        const __m128 va = _mm_loadu_ps(a);
+        __m128 vb = _mm_loadu_ps(b);
+
+        __m128 d = _mm_mul_ps(va, vb);
+        d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+        d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+        // Flip b when the dot is negative: xor with the dot's sign bit
+        const __m128 sign = _mm_and_ps(d, _mm_set1_ps(-0.0f));
+        vb = _mm_xor_ps(vb, sign);
+
+        __m128 r = _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), _mm_set1_ps(t)));
+        __m128 len = _mm_mul_ps(r, r);
+        len = _mm_add_ps(len, _mm_shuffle_ps(len, len, _MM_SHUFFLE(2, 3, 0, 1)));
+        len = _mm_add_ps(len, _mm_shuffle_ps(len, len, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm_storeu_ps(out, _mm_div_ps(r, _mm_sqrt_ps(len)));
+#else
+        float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        float s = dot < 0.0f ? -1.0f : 1.0f;
+        float r[4], len = 0.0f;
+        for (int i = 0; i < 4; i++) {
+            r[i] = a[i] + (b[i] * s - a[i]) * t;
+            len += r[i] * r[i];
+        }
+        float inv = 1.0f / std::sqrt(len);
+        for (int i = 0; i < 4; i++) out[i] = r[i] * inv;
+#endif
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <OPENGL/glm/glm.hpp>
+#include <OPENGL/glm/gtc/quaternion.hpp>
+#include <vector>
+#include <cstddef>
+
+// Position / rotation / scale of many objects as one float array per component (SoA),
+// the layout ComputeTrsMatrices loads 4 (SSE) or 8 (AVX2) objects at a time from.
+struct TransformBatch {
+    std::vector<float> positionX, positionY, positionZ;
+    std::vector<float> rotationX, rotationY, rotationZ, rotationW;   // unit quaternions
+    std::vector<float> scaleX, scaleY, scaleZ;
+
+    size_t Size() const { return positionX.size(); }
+    void Clear();
+    void Reserve(size_t count);
+    void Add(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+};
+
+// For every object: models[i] = T * R * S, and normals[i] = R * inverse(S), which is the inverse
+// transpose of the model's 3x3 without a general inverse (zero scale axes give a zero column).
+// normals may be null. useSimd = false runs the same math one object at a time (reference).
+void ComputeTrsMatrices(const TransformBatch& batch, glm::mat4* models, glm::mat3* normals, bool useSimd = true);
@@ -32,7 +32,7 @@ private:
     glm::vec3 worldUp;
 
     //optional
-    std::shared_ptr<SpotLight> spotlight;
+    SpotLightHandle spotlight;
 
     float yaw;
     float pitch;
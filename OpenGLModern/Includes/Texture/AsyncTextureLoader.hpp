@@ -0,0 +1,77 @@
+#pragma once
+#include <Texture/Texture.hpp>
+#include <Texture/Image.hpp>
+#include <Texture/MipGenerator.hpp>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <cstdint>
+
+// Two stage texture loading:
+//  1. decode + mip chain + content hash on worker threads (stb_image, scales with core count)
+//  2. upload on the GL thread: copy every level into a pixel buffer object and glTexSubImage2D from it,
+//     so the driver can DMA the pixels asynchronously instead of blocking on client memory.
+class AsyncTextureLoader {
+public:
+    struct Request {
+        uint64_t id = 0;
+        std::string path;
+        std::weak_ptr<Texture> texture;
+        MipSettings mipSettings;
+    };
+
+    struct Uploaded {
+        uint64_t id = 0;
+        uint64_t contentHash = 0;
+        int width = 0, height = 0, channels = 0;
+        bool failed = false;
+    };
+
+    // workerCount 0 = one per core, minus the GL thread
+    explicit AsyncTextureLoader(size_t workerCount = 0);
+    ~AsyncTextureLoader();
+
+    AsyncTextureLoader(const AsyncTextureLoader&) = delete;
+    AsyncTextureLoader& operator=(const AsyncTextureLoader&) = delete;
+
+    void Enqueue(Request request);
+
+    // GL thread: uploads finished decodes until byteBudget is used up (at least one per call)
+    std::vector<Uploaded> UploadFinished(size_t byteBudget);
+
+    // Requests not uploaded yet (queued, decoding, or waiting for the GL thread)
+    size_t GetPendingCount() const { return pending.load(); }
+
+private:
+    struct Decoded {
+        Request request;
+        Image image;
+        std::vector<Image> mips;
+        uint64_t contentHash = 0;
+    };
+
+    static constexpr size_t kPboCount = 4;
+
+    std::vector<std::thread> workers;
+    std::deque<Request> requests;
+    std::mutex requestMutex;
+    std::condition_variable requestReady;
+    bool stopping = false;
+
+    std::deque<Decoded> finished;
+    std::mutex finishedMutex;
+
+    std::atomic<size_t> pending{ 0 };
+
+    // Round robin of PBOs; each upload orphans its buffer so we never wait on an in-flight copy
+    unsigned int pbos[kPboCount] = {};
+    size_t nextPbo = 0;
+
+    void WorkerLoop();
+    void Upload(Texture& texture, const Image& image, const std::vector<Image>& mips);
+};
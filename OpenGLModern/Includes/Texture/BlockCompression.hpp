@@ -0,0 +1,33 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// CPU encoders/decoders for the BCn block formats we ship.
+// Every format works on 4x4 texel blocks; input blocks are always RGBA8 (64 bytes).
+enum class BlockFormat {
+    BC1, // RGB, 4 bpp
+    BC3, // RGBA (BC4 alpha + BC1 color), 8 bpp
+    BC4, // R, 4 bpp
+    BC5, // RG (two BC4 blocks), 8 bpp - normal maps
+    BC7  // RGBA high quality (mode 6), 8 bpp
+};
+
+size_t BlockBytes(BlockFormat format);
+const char* BlockFormatName(BlockFormat format);
+bool ParseBlockFormat(const std::string& name, BlockFormat& outFormat);
+
+// Vulkan format enum stored in the KTX2 header
+uint32_t VkFormatFor(BlockFormat format, bool srgb);
+bool BlockFormatFromVk(uint32_t vkFormat, BlockFormat& outFormat, bool& outSrgb);
+
+void EncodeBlock(BlockFormat format, const uint8_t rgba[64], uint8_t* outBlock);
+void DecodeBlock(BlockFormat format, const uint8_t* block, uint8_t outRgba[64]);
+
+size_t CompressedSize(BlockFormat format, int width, int height);
+
+// Whole surface (tightly packed RGBA8). Edge blocks clamp to the last row/column.
+// Rows of blocks are encoded in parallel.
+std::vector<uint8_t> CompressSurface(BlockFormat format, const uint8_t* rgba, int width, int height);
+std::vector<uint8_t> DecompressSurface(BlockFormat format, const uint8_t* blocks, int width, int height);
@@ -0,0 +1,19 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+// Decoded 8-bit image living in CPU memory.
+// Decoding functions are thread-safe, so these can be produced on worker threads
+// and handed to the GL thread for upload.
+struct Image {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    std::vector<unsigned char> pixels;
+
+    bool IsValid() const { return width > 0 && height > 0 && !pixels.empty(); }
+};
+
+// flipVertically: OpenGL expects row 0 at the bottom, image files store it at the top
+Image LoadImageFromFile(const char* path, bool flipVertically = true);
+Image LoadImageFromMemory(const unsigned char* data, size_t size, bool flipVertically = true);
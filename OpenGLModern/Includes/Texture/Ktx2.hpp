@@ -0,0 +1,30 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Minimal KTX2 reader/writer for our cooked block-compressed textures.
+// Standard identifier, header and level index; one layer, one face, no supercompression.
+// Level data is stored smallest mip first (as the spec recommends for streaming), 16-byte aligned.
+// We don't write a data format descriptor: vkFormat is all the runtime needs.
+struct Ktx2Level {
+    const uint8_t* data = nullptr; // points into the parsed buffer (e.g. a mapped file)
+    size_t size = 0;
+    int width = 0;
+    int height = 0;
+};
+
+struct Ktx2Texture {
+    uint32_t vkFormat = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<Ktx2Level> levels; // levels[0] is the full resolution image
+};
+
+// levels[0] is the full resolution image, each following level half the size
+bool WriteKtx2(const std::string& path, uint32_t vkFormat, int width, int height,
+               const std::vector<std::vector<uint8_t>>& levels);
+
+// Validates the header and every level range against size. No copies are made.
+bool ParseKtx2(const uint8_t* bytes, size_t size, Ktx2Texture& outTexture);
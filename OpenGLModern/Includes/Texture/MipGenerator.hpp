@@ -0,0 +1,30 @@
+#pragma once
+#include <Texture/Image.hpp>
+#include <vector>
+
+// CPU mip chain generation, so mips can be built by the cooker or on loader threads
+// and the GL thread only uploads finished levels (no glGenerateMipmap).
+enum class MipFilter {
+    Box,     // 2x2 average, what drivers do; fast but blurry and aliases on fine detail
+    Kaiser,  // Kaiser windowed sinc, sharp with little ringing (default)
+    Lanczos  // Lanczos-3, sharpest, rings a bit on hard edges
+};
+
+struct MipSettings {
+    MipFilter filter = MipFilter::Kaiser;
+
+    // RGB of 3/4 channel images is sRGB encoded: filter in linear light.
+    // Turn off for data textures (normal maps, roughness, masks). Alpha is always linear.
+    bool srgb = true;
+
+    // > 0: alpha-tested (cutout) texture with this cutoff. Each level's alpha is rescaled so the
+    // fraction of texels passing the test matches level 0, so foliage doesn't thin out with distance.
+    float alphaCoverageCutoff = 0.0f;
+
+    // false = scalar reference kernels (tests/benchmarks)
+    bool useSimd = true;
+};
+
+// Levels 1..N-1 of base's mip chain (down to 1x1), same channel count as base.
+// Each level is filtered from the previous one kept in float, so rounding doesn't accumulate.
+std::vector<Image> GenerateMipChain(const Image& base, const MipSettings& settings = {});
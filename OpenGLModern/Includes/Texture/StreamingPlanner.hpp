@@ -0,0 +1,37 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Decides which mip levels every streamed texture should have resident next frame.
+// Pure CPU logic (no GL), so TextureStreamer just applies the result.
+//
+// Levels are numbered like GL: 0 is full resolution. A texture with "top" level t has
+// levels t..levelCount-1 resident, so a smaller top means a sharper texture.
+struct StreamingEntry {
+    std::vector<size_t> levelBytes; // GPU bytes of each level
+    int residentTop = 0;
+    int wantedTop = 0;              // from screen-space texel density this frame
+    int tailLevel = 0;              // levels from here down are always resident
+    uint64_t lastRequestFrame = 0;  // last frame anything asked for this texture
+};
+
+struct StreamingPlan {
+    std::vector<int> targetTop;     // per entry
+    size_t residentBytes = 0;       // after applying the plan
+    size_t wantedBytes = 0;         // what every texture at its wanted level would cost
+    size_t uploadBytes = 0;
+    size_t evictedBytes = 0;
+    uint32_t starved = 0;           // entries left blurrier than wanted (budget or upload limit)
+};
+
+// Budget rules:
+//  - Missing levels load one at a time, most recently requested textures first, at most
+//    uploadBudget bytes per call (the first level always goes, so huge levels can't stall).
+//  - To make room, evict the finest level of the least recently needed texture: levels nobody
+//    wants any more go first, then wanted levels of textures requested longer ago than the one
+//    loading. Unwanted levels otherwise stay as a cache until the budget needs the space.
+StreamingPlan PlanResidency(const std::vector<StreamingEntry>& entries, size_t budgetBytes, size_t uploadBudget);
+
+// Bytes of levels top..end
+size_t ResidentBytes(const StreamingEntry& entry, int top);
@@ -1,18 +1,86 @@
 #pragma once
 #include <OPENGL/glad/glad.h>
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+struct Image;
 
 class Texture {
 public:
     unsigned int ID;
     int width, height, nrChannels;
+    int levels;
 
     // Constructor: loads and creates the texture
     Texture(const char* imagePath);
 
+    // Constructor: uploads an already decoded image (e.g. decoded on a worker thread).
+    // mips are levels 1..N from GenerateMipChain; without them the driver builds the chain.
+    Texture(const Image& image, const std::vector<Image>& mips = {});
+
+    // Empty texture with no GL object yet; async loads fill it in later (see IsReady)
+    Texture();
+
+    ~Texture();
+
+    // Owns a GL object, so no copies
+    Texture(const Texture&) = delete;
+    Texture& operator=(const Texture&) = delete;
+
+    // False until the pixels have been uploaded
+    bool IsReady() const { return ID != 0; }
+
+    // Allocates immutable storage (glTexStorage2D) with a full mip chain
+    void AllocateStorage(int width, int height, int channels);
+
+    // Immutable storage for block compressed data (BCn); levelCount comes from the cooked file
+    void AllocateCompressedStorage(int width, int height, int levelCount, GLenum internalFormat);
+
+    // Uploads one mip level. When a GL_PIXEL_UNPACK_BUFFER is bound, pixels is an offset into it.
+    void SetLevel(int level, int levelWidth, int levelHeight, const void* pixels);
+
+    // Uploads one pre-compressed mip level (glCompressedTexSubImage2D)
+    void SetCompressedLevel(int level, int levelWidth, int levelHeight, const void* data, size_t size);
+
+    void GenerateMipmaps();
+
+    // --- Streaming: mutable per-level storage, sampling clamped to the resident levels ---
+
+    // Creates the GL object without storage; levels are defined one by one (DefineLevel).
+    // compressedFormat = GL_NONE for 8-bit textures with `channels` channels.
+    void CreateStreamed(int width, int height, int levelCount, int channels, GLenum compressedFormat);
+
+    // Allocates + uploads one level (size is only used for compressed data)
+    void DefineLevel(int level, int levelWidth, int levelHeight, const void* data, size_t size);
+
+    // Frees a level's memory; it must already be outside the resident range
+    void ReleaseLevel(int level);
+
+    // GL_TEXTURE_BASE_LEVEL / GL_TEXTURE_MAX_LEVEL: sampling only touches levels in this range
+    void SetResidentLevels(int baseLevel, int maxLevel);
+    int GetBaseLevel() const { return baseLevel; }
+
     // Bind the texture to a specific slot (default is 0)
     void bind(unsigned int slot = 0) const;
 
     // Unbind (optional cleanup)
     void unbind() const;
-};
\ No newline at end of file
+
+    static int MipLevelCount(int width, int height);
+    static GLenum PixelFormat(int channels);
+    static GLenum InternalFormat(int channels);
+    // GL compressed format for a KTX2 vkFormat, 0 if we can't sample it
+    static GLenum CompressedInternalFormat(uint32_t vkFormat);
+
+    // GL_NONE for uncompressed textures
+    GLenum compressedFormat;
+
+    // Finest level sampling may use (streamed textures), 0 otherwise
+    int baseLevel;
+
+private:
+    void Upload(const Image& image, const std::vector<Image>& mips);
+    void CreateStorage(GLenum internalFormat);
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include <OPENGL/glad/glad.h>
+#include <vector>
+
+struct Image;
+
+// GL_TEXTURE_2D_ARRAY with immutable storage: `layers` same-size, same-format images that are
+// bound once and picked per draw by layer index (sampler2DArray in the shader).
+class TextureArray {
+public:
+    unsigned int ID;
+    int width, height, nrChannels;
+    int layers, levels;
+
+    // levelCount = 0: full mip chain
+    TextureArray(int width, int height, int channels, int layers, int levelCount = 0);
+    ~TextureArray();
+
+    // Owns a GL object, so no copies
+    TextureArray(const TextureArray&) = delete;
+    TextureArray& operator=(const TextureArray&) = delete;
+
+    // Uploads a layer: image is level 0, mips are levels 1..N (GenerateMipChain).
+    // Levels the mips don't cover are left as they are; call GenerateMipmaps once all layers are in.
+    void SetLayer(int layer, const Image& image, const std::vector<Image>& mips = {});
+
+    // Uploads one level of one layer
+    void SetLayerLevel(int layer, int level, const Image& image);
+
+    void GenerateMipmaps();
+
+    // GL_REPEAT by default; atlas pages use GL_CLAMP_TO_EDGE
+    void SetWrap(GLenum wrap);
+
+    void bind(unsigned int slot = 0) const;
+    void unbind() const;
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include <Texture/Image.hpp>
+#include <Texture/TextureArray.hpp>
+#include <Texture/TextureAtlas.hpp>
+#include <OPENGL/glm/glm.hpp>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+// Where a packed image ended up: bind `array` once, then draw with `layer` and `uvTransform`
+// (identity for whole layers, the atlas rect for atlased images)
+struct TextureArrayBinding {
+    std::shared_ptr<TextureArray> array;
+    int layer = 0;
+    glm::vec4 uvTransform{ 1.0f, 1.0f, 0.0f, 0.0f };
+};
+
+// Packs many images into as few GL_TEXTURE_2D_ARRAYs as possible so objects with different
+// maps stop splitting draws on texture binds:
+//  - images sharing size + channel count become layers of one array (tiling still works)
+//  - the rest are packed into atlas pages (TextureAtlas), which become layers of one array
+//    per channel count; their UVs must stay inside 0..1
+// Images too big for an atlas page get an array of their own.
+class TextureArrayBuilder {
+public:
+    struct Settings {
+        int minLayers = 2;        // smaller same-size groups go to the atlas instead
+        int maxLayers = 256;      // GL_MAX_ARRAY_TEXTURE_LAYERS is at least 256 everywhere
+        bool useAtlas = true;     // false: leftovers get single-layer arrays
+        AtlasSettings atlas;
+    };
+
+    struct Stats {
+        uint32_t images = 0;
+        uint32_t arrays = 0;
+        uint32_t layerImages = 0; // images stored as whole layers
+        uint32_t atlasImages = 0;
+        uint32_t atlasPages = 0;
+        float atlasOccupancy = 0.0f;
+    };
+
+    // Queues an image (mips = GenerateMipChain levels, generated at Build when missing).
+    // allowAtlas = false for images sampled with UVs outside 0..1 (tiling).
+    // Returns the index of its binding in Build's result.
+    size_t Add(Image image, std::vector<Image> mips = {}, bool allowAtlas = true);
+
+    // GL thread. Uploads everything and drops the CPU copies; invalid images get a null array.
+    std::vector<TextureArrayBinding> Build(const Settings& settings);
+    std::vector<TextureArrayBinding> Build();
+
+    const Stats& GetStats() const { return stats; }
+
+private:
+    struct Pending {
+        Image image;
+        std::vector<Image> mips;
+        bool allowAtlas;
+    };
+    std::vector<Pending> pending;
+    Stats stats;
+};
@@ -0,0 +1,48 @@
+#pragma once
+#include <Texture/Image.hpp>
+#include <OPENGL/glm/glm.hpp>
+#include <vector>
+
+// Packs many small images into a few same-size atlas pages (CPU only, no GL).
+//
+// Every image gets a gutter of its own replicated edge texels and its cell sits on a grid of
+// `gutter` texels. Page level k is assembled from each image's own mip k (not filtered from the
+// page), so neighbours never mix, and bilinear taps at the image border land in the gutter as
+// long as gutter >> k >= 1. That makes levels 0..log2(gutter) safe; AtlasLayout::levelCount
+// stops there. A grid of 4+ texels also keeps every image on whole BCn blocks.
+//
+// UVs outside 0..1 (GL_REPEAT tiling) can't work inside an atlas: use array layers for those.
+struct AtlasSettings {
+    int pageSize = 2048;  // square; the only page is trimmed to what it actually holds
+    int gutter = 8;       // power of two
+};
+
+struct AtlasEntry {
+    int page = -1;                      // -1: invalid or bigger than a page
+    int x = 0, y = 0;                   // level 0 texel origin of the image inside its page
+    int width = 0, height = 0;
+    glm::vec4 uvTransform{ 1.0f, 1.0f, 0.0f, 0.0f }; // uv' = uv * xy + zw
+};
+
+struct AtlasLayout {
+    std::vector<AtlasEntry> entries;    // same order as the input sizes
+    int pageCount = 0;
+    int pageWidth = 0, pageHeight = 0;
+    int gutter = 0;
+    int levelCount = 0;                 // mip levels that can't bleed (log2(gutter) + 1, page permitting)
+    float occupancy = 0.0f;             // image texels / page texels
+};
+
+// Shelf packing, tallest cells first, first page with room wins
+AtlasLayout PackAtlas(const std::vector<glm::ivec2>& sizes, const AtlasSettings& settings = {});
+
+// One image to compose: level 0 plus its GenerateMipChain levels (generated here when missing)
+struct AtlasImage {
+    const Image* image = nullptr;
+    const std::vector<Image>* mips = nullptr;
+};
+
+// Builds levels 0..levelCount-1 of every page: result[page][level].
+// All images must have `channels` channels; others are skipped. Unused page texels are zero.
+std::vector<std::vector<Image>> ComposeAtlas(const AtlasLayout& layout, const std::vector<AtlasImage>& images,
+                                             int channels);
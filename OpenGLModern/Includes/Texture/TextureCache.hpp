@@ -0,0 +1,94 @@
+#pragma once
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <Texture/Texture.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+struct Image;
+class AsyncTextureLoader;
+
+// Ref-counted handle: the GL texture is released when the last handle goes away
+using TextureHandle = std::shared_ptr<Texture>;
+
+// Shares textures between everything that loads them.
+// Deduplicates by canonical file path (no decode at all on a hit) and by a hash of the
+// decoded pixels (two files / embedded blobs with the same image share one GL texture).
+class TextureCache : public IService {
+    friend class ServiceLocator;
+public:
+    struct TextureInfo {
+        std::string name;
+        uint64_t contentHash = 0;
+        size_t residentBytes = 0;
+        long references = 0;
+        bool duplicate = false;   // see GetDuplicateBytes
+    };
+
+    ~TextureCache();
+
+    // Loads a texture from disk, or returns the one already loaded from that file.
+    // .ktx2 files (cooked by TextureCooker) are memory mapped and uploaded block compressed.
+    TextureHandle Load(const std::string& path);
+
+    // Returns immediately (.ktx2 files have nothing to decode and load synchronously); the handle becomes IsReady() once a worker has decoded it and
+    // ProcessUploads() has pushed it to the GPU
+    TextureHandle LoadAsync(const std::string& path);
+
+    // GL thread, once per frame: uploads finished async decodes (bounded by byteBudget)
+    void ProcessUploads(size_t byteBudget = 32 * 1024 * 1024);
+
+    // Uploads an already decoded image, or returns an existing texture with identical pixels.
+    // mips: levels 1..N built off the GL thread (GenerateMipChain); empty = driver generated.
+    TextureHandle FromImage(const Image& image, const std::string& name = "", const std::vector<Image>& mips = {});
+
+    size_t GetTextureCount() const;
+    size_t GetResidentBytes() const;
+    // Part of GetResidentBytes held by async loads that turned out to have the same pixels as a
+    // texture already loaded; they stay alive while their handles do, new loads get the original
+    size_t GetDuplicateBytes() const;
+    size_t GetPendingCount() const;
+    std::vector<TextureInfo> GetTextureInfo() const;
+
+    // Estimated GPU footprint of an RGBA8-style texture with a full mip chain
+    static size_t EstimateResidentBytes(int width, int height, int channels);
+
+private:
+    TextureCache();
+
+    struct Entry {
+        std::weak_ptr<Texture> texture;
+        std::string name;
+        std::string path;          // canonical path, empty for in-memory images
+        uint64_t contentHash = 0;  // 0 until the pixels are known (async loads)
+        size_t residentBytes = 0;
+        bool duplicate = false;    // async load of pixels another live entry already has
+    };
+
+    // Shared with the handle deleters so a handle outliving the cache stays safe
+    struct State {
+        mutable std::mutex mutex;
+        uint64_t nextId = 1;
+        std::unordered_map<uint64_t, Entry> entries;
+        std::unordered_map<uint64_t, uint64_t> idByHash;
+        std::unordered_map<std::string, uint64_t> idByPath;
+        size_t residentBytes = 0;
+    };
+    std::shared_ptr<State> state;
+    std::unique_ptr<AsyncTextureLoader> loader;
+
+    static uint64_t HashImage(const Image& image);
+    static std::string CanonicalPath(const std::string& path);
+    static bool IsCompressedContainer(const std::string& path);
+
+    TextureHandle LoadCompressed(const std::string& path, const std::string& canonical);
+
+    // Expects state->mutex to be held
+    TextureHandle FindAlive(const std::unordered_map<std::string, uint64_t>& index, const std::string& key) const;
+    TextureHandle FindAliveByHash(uint64_t hash) const;
+    TextureHandle Register(Texture* texture, const std::string& name, const std::string& path,
+                           uint64_t contentHash, size_t residentBytes, uint64_t& outId);
+};
@@ -0,0 +1,99 @@
+#pragma once
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <Texture/Texture.hpp>
+#include <Texture/TextureCache.hpp>
+#include <Texture/StreamingPlanner.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+// Mip level streaming under a global VRAM budget.
+//
+// Open() uploads only the small tail mips. Every frame, whoever draws with a streamed texture
+// tells us how big it is on screen (RequestScreenSize); Update() then loads the finer levels
+// that density calls for and evicts the least recently needed levels when over budget.
+// GL_TEXTURE_BASE_LEVEL/MAX_LEVEL always match the resident range, so sampling stays valid.
+//
+// Sources: cooked .ktx2 files are memory mapped and levels are read straight from the mapping;
+// other images are decoded once and their mip chain is kept in system memory.
+// GL thread only.
+class TextureStreamer : public IService {
+    friend class ServiceLocator;
+public:
+    struct Settings {
+        size_t budgetBytes = 256 * 1024 * 1024;
+        size_t uploadBytesPerFrame = 16 * 1024 * 1024;
+        int alwaysResidentSize = 64;  // levels this size and smaller never leave VRAM
+        uint32_t keepFrames = 60;     // a request keeps its level wanted for this many frames
+    };
+
+    struct Stats {
+        size_t budgetBytes = 0;
+        size_t residentBytes = 0;
+        size_t wantedBytes = 0;       // everything at the requested sharpness
+        size_t uploadedBytes = 0;     // last Update
+        size_t evictedBytes = 0;      // last Update
+        size_t totalEvictedBytes = 0;
+        uint32_t textures = 0;
+        uint32_t starved = 0;         // textures blurrier than requested after the last Update
+
+        // > 1: the scene wants more than the budget allows
+        float Pressure() const { return budgetBytes ? float(wantedBytes) / float(budgetBytes) : 0.0f; }
+    };
+
+    struct Residency {
+        std::string name;
+        int levelCount = 0;
+        int residentTop = 0;          // finest resident level (0 = full resolution)
+        int wantedTop = 0;
+        size_t residentBytes = 0;
+        uint64_t lastRequestFrame = 0;
+    };
+
+    ~TextureStreamer();
+
+    // Opens (or returns the already open) streamed texture; only the tail mips are resident
+    TextureHandle Open(const std::string& path);
+
+    // Asks for the level a texture needs when it spans screenPixels on screen.
+    // uvCoverage: fraction of the texture's width across that span (1 = whole texture once).
+    void RequestScreenSize(const TextureHandle& texture, float screenPixels, float uvCoverage = 1.0f);
+    void RequestLevel(const TextureHandle& texture, int level);
+
+    // Once per frame on the GL thread: plan, evict, upload
+    void Update();
+
+    void SetSettings(const Settings& newSettings) { settings = newSettings; }
+    const Settings& GetSettings() const { return settings; }
+    const Stats& GetStats() const { return stats; }
+    std::vector<Residency> GetResidency() const;
+
+    // Diameter in pixels of a sphere of worldRadius at distance (projectionYScale = projection[1][1])
+    static float ProjectedSizePixels(float worldRadius, float distance, float projectionYScale, float viewportHeight);
+
+    // Level whose texel density matches screenPixels for a texture textureSize texels across
+    static int LevelForScreenSize(int textureSize, float screenPixels, float uvCoverage, int levelCount);
+
+private:
+    TextureStreamer();
+
+    struct Record;
+
+    // Shared with the handle deleters (same pattern as TextureCache)
+    struct State {
+        uint64_t nextId = 1;
+        std::unordered_map<uint64_t, std::unique_ptr<Record>> records;
+        std::unordered_map<const Texture*, uint64_t> idByTexture;
+        std::unordered_map<std::string, uint64_t> idByPath;
+    };
+    std::shared_ptr<State> state;
+
+    Settings settings;
+    Stats stats;
+    uint64_t frame = 1;
+
+    Record* Find(const TextureHandle& texture) const;
+    void Apply(Record& record, int targetTop);
+};
@@ -0,0 +1,120 @@
+#pragma once
+#include <OPENGL/glad/glad.h>
+#include <Texture/VirtualTextureFile.hpp>
+#include <Texture/VirtualTexturing.hpp>
+#include <Shader/Shader.hpp>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <vector>
+#include <string>
+#include <unordered_set>
+#include <cstdint>
+
+// Virtual texture: a huge .vtex (VirtualTextureFile) of which only the tiles the camera actually
+// samples live in VRAM.
+//
+// GPU side:
+//  - page pool: one RGBA8 texture holding poolPagesPerSide^2 padded tiles
+//  - page table: RGBA8 indirection texture, one texel per tile per level (VirtualPageTable)
+//  - feedback: a low resolution target the scene is drawn into with VirtualTextureFeedback.frag,
+//    each texel naming the tile it wants; read back through PBOs a few frames late, never stalling
+// Per frame: Begin/EndFeedback around the feedback draws, then Update(), then draw the scene with
+// VirtualTexture.frag after Bind(). GL thread only; tiles are read from the file on loader threads.
+class VirtualTexture {
+public:
+    struct Settings {
+        int poolPagesPerSide = 16;     // pool = 16x16 tiles (~19 MB at 128 + 2*4 texel tiles)
+        int feedbackDivisor = 8;       // feedback target = viewport / this
+        int uploadsPerFrame = 16;
+        int loadsInFlight = 32;
+        int loaderThreads = 2;
+        uint32_t forgetFrames = 30;    // requests not repeated for this long are dropped
+    };
+
+    struct Stats {
+        size_t residentTiles = 0;
+        size_t requestedTiles = 0;     // unique tiles in the last parsed feedback
+        size_t pendingTiles = 0;       // wanted but not resident
+        size_t loadsInFlight = 0;
+        uint32_t uploadedTiles = 0;    // last Update
+        uint32_t evictedTiles = 0;     // last Update
+        uint32_t droppedTiles = 0;     // loaded but no page could be freed (pool too small)
+    };
+
+    explicit VirtualTexture(const std::string& path);
+    VirtualTexture(const std::string& path, const Settings& settings);
+    ~VirtualTexture();
+
+    VirtualTexture(const VirtualTexture&) = delete;
+    VirtualTexture& operator=(const VirtualTexture&) = delete;
+
+    bool IsValid() const { return poolTexture != 0; }
+
+    // Binds the feedback target (viewport / feedbackDivisor) and clears it
+    void BeginFeedback(int viewportWidth, int viewportHeight);
+    // Starts the async readback and restores the default framebuffer + viewport
+    void EndFeedback();
+
+    // Parses the newest finished readback, queues loads, uploads finished tiles, updates the page table
+    void Update();
+
+    // Pool and page table on the given slots + the vt* uniforms (both shaders)
+    void Bind(const Shader& shader, unsigned int poolSlot, unsigned int pageTableSlot) const;
+
+    const VirtualTextureInfo& GetInfo() const { return file.GetInfo(); }
+    const Stats& GetStats() const { return stats; }
+
+private:
+    static constexpr size_t kFeedbackBuffers = 3;
+
+    struct LoadedTile {
+        TileId tile;
+        std::vector<uint8_t> texels;
+        bool ok = false;
+    };
+
+    Settings settings;
+    Stats stats;
+    VirtualTextureFile file;
+    uint64_t frame = 1;
+
+    // CPU state
+    std::unique_ptr<TileCache> cache;
+    std::unique_ptr<VirtualPageTable> pageTable;
+    TileScheduler scheduler;
+    std::unordered_set<uint32_t> inFlight;
+
+    // GL objects
+    unsigned int poolTexture = 0;
+    unsigned int pageTableTexture = 0;
+    unsigned int feedbackFbo = 0;
+    unsigned int feedbackColor = 0;
+    unsigned int feedbackDepth = 0;
+    int feedbackWidth = 0, feedbackHeight = 0;
+    int viewportWidth = 0, viewportHeight = 0;
+
+    // Readback ring: each slot remembers its size and the fence of its glReadPixels
+    unsigned int feedbackPbos[kFeedbackBuffers] = {};
+    GLsync feedbackFences[kFeedbackBuffers] = {};
+    int feedbackSizes[kFeedbackBuffers][2] = {};
+    size_t nextFeedback = 0;
+
+    // Loader threads
+    std::vector<std::thread> loaders;
+    std::deque<TileId> loadQueue;
+    std::mutex loadMutex;
+    std::condition_variable loadReady;
+    bool stopping = false;
+    std::deque<LoadedTile> loaded;
+    std::mutex loadedMutex;
+
+    void CreateGpuResources();
+    void ResizeFeedback(int width, int height);
+    void ReadFeedback();
+    void UploadTile(const TileId& tile, const std::vector<uint8_t>& texels);
+    void UploadPageTable();
+    void LoaderLoop();
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <Texture/Image.hpp>
+#include <Texture/MipGenerator.hpp>
+#include <Engine/Utils/MappedFile.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Tiled on-disk format for virtual textures (.vtex).
+//
+// Every mip level is cut into tileSize x tileSize tiles, each stored with `border` texels of its
+// neighbours (clamped at the texture edge) so bilinear filtering inside the page pool never needs
+// the adjacent page. Levels go down until one tile covers the whole texture (the root tile).
+// The texture must be square, tileSize times a power of two, so every level is whole tiles.
+//
+// Layout: header, tile index (level 0 row major, then level 1, ...), tile data coarsest level
+// first. Tiles are raw RGBA8; the index stores a size per tile so compressed tiles can follow.
+struct VirtualTextureInfo {
+    int size = 0;       // width = height
+    int tileSize = 0;   // texels of content per tile side
+    int border = 0;
+    int levelCount = 0;
+
+    int PaddedTileSize() const { return tileSize + 2 * border; }
+    size_t TileBytes() const { return static_cast<size_t>(PaddedTileSize()) * PaddedTileSize() * 4; }
+    // Tiles per side at a level
+    int TilesPerSide(int level) const { return (size / tileSize) >> level; }
+};
+
+// Builds the mip chain (image is converted to RGBA) and writes every tile.
+// Fails (with a message) when the image isn't square or not tileSize * 2^n.
+bool WriteVirtualTexture(const std::string& path, const Image& image, int tileSize, int border,
+                         const MipSettings& mipSettings = {});
+
+// Read-only view of a .vtex file. The file is memory mapped, so ReadTile may be called from any
+// number of loader threads at once.
+class VirtualTextureFile {
+public:
+    bool Open(const std::string& path);
+
+    // Validates header and tile ranges of an in-memory file (Open uses it on the mapping)
+    bool Parse(const uint8_t* bytes, size_t size);
+
+    const VirtualTextureInfo& GetInfo() const { return info; }
+
+    // Copies one tile's RGBA8 texels (PaddedTileSize()^2 * 4 bytes) into out
+    bool ReadTile(int level, int x, int y, std::vector<uint8_t>& out) const;
+
+private:
+    struct TileRange {
+        uint64_t offset;
+        uint32_t size;
+        uint32_t reserved;
+    };
+
+    MappedFile file;
+    const uint8_t* bytes = nullptr;
+    VirtualTextureInfo info;
+    std::vector<size_t> levelFirstTile;  // index of each level's first tile in `tiles`
+    const TileRange* tiles = nullptr;
+};
@@ -0,0 +1,139 @@
+#pragma once
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+// CPU side of virtual texturing (no GL), so VirtualTexture only moves bytes:
+//  - feedback decoding: which tiles the last frame sampled, and how many pixels wanted each
+//  - TileScheduler: which missing tiles to load next
+//  - TileCache: which page pool slot a tile lives in, LRU eviction
+//  - VirtualPageTable: the indirection texture contents, with fallback to coarser tiles
+
+// Tile address: mip level + tile coordinates at that level
+struct TileId {
+    uint8_t level = 0;
+    uint16_t x = 0;
+    uint16_t y = 0;
+
+    uint32_t Key() const { return uint32_t(level) << 24 | uint32_t(x) << 12 | uint32_t(y); }
+    static TileId FromKey(uint32_t key) {
+        return { uint8_t(key >> 24), uint16_t((key >> 12) & 0xFFF), uint16_t(key & 0xFFF) };
+    }
+    TileId Parent() const { return { uint8_t(level + 1), uint16_t(x >> 1), uint16_t(y >> 1) }; }
+    bool operator==(const TileId& other) const { return Key() == other.Key(); }
+};
+
+// --- Feedback ---
+
+// One feedback texel (RGBA8, see VirtualTextureFeedback.frag):
+// R/G = low 8 bits of tile x/y, B = level (4 bits) | x bits 8-9 << 4 | y bits 8-9 << 6,
+// A = 255 where a virtual textured surface was drawn (cleared to 0).
+uint32_t EncodeFeedback(TileId tile);
+
+struct TileRequest {
+    TileId tile;
+    uint32_t pixels = 0; // feedback texels that asked for it
+};
+
+// Unique tiles in a feedback readback (pixelCount RGBA8 texels).
+// Tiles outside a texture with tilesPerSide tiles at level 0 and levelCount levels are dropped.
+std::vector<TileRequest> ParseFeedback(const uint8_t* rgba, size_t pixelCount, int tilesPerSide, int levelCount);
+
+// --- Scheduling ---
+
+class TileScheduler {
+public:
+    // Requests not repeated for this many frames are dropped
+    explicit TileScheduler(uint32_t forgetFrames = 30) : forgetFrames(forgetFrames) {}
+
+    // Records this frame's requests. Each tile's ancestors are requested too (with its pixels),
+    // so a region refines coarse to fine and always has a close level to fall back to.
+    void Submit(const std::vector<TileRequest>& requests, int levelCount, uint64_t frame);
+
+    // Up to maxCount tiles to load, best first: coarser level, then older request, then more pixels.
+    // skip(tile) = true for tiles that are resident or already loading.
+    std::vector<TileId> Next(size_t maxCount, uint64_t frame, const std::function<bool(TileId)>& skip);
+
+    // Loaded (or failed): stop asking for it
+    void Complete(TileId tile) { pending.erase(tile.Key()); }
+
+    size_t GetPendingCount() const { return pending.size(); }
+
+private:
+    struct Pending {
+        uint32_t pixels = 0;
+        uint64_t firstFrame = 0;
+        uint64_t lastFrame = 0;
+    };
+    std::unordered_map<uint32_t, Pending> pending;
+    uint32_t forgetFrames;
+};
+
+// --- Page pool ---
+
+// Which pool page holds which tile. Full pools evict the least recently used tile,
+// but never one used this frame (that would thrash), and never a pinned one.
+class TileCache {
+public:
+    explicit TileCache(int pageCount);
+
+    // Page holding tile (marks it used this frame), -1 if not resident
+    int Touch(TileId tile, uint64_t frame);
+    bool Contains(TileId tile) const { return slots.count(tile.Key()) != 0 || pinned.count(tile.Key()) != 0; }
+
+    // Page for a new tile, or -1 when nothing can be evicted.
+    // If a resident tile had to make room, it's returned in evicted and evictedValid is true.
+    int Allocate(TileId tile, uint64_t frame, TileId& evicted, bool& evictedValid);
+
+    // Pinned tiles (the root) never leave
+    void Pin(TileId tile);
+
+    size_t GetResidentCount() const { return slots.size() + pinned.size(); }
+    int GetPageCount() const { return pageCount; }
+
+private:
+    struct Slot {
+        uint32_t key;
+        int page;
+        uint64_t lastFrame;
+    };
+    int pageCount;
+    std::vector<int> freePages;
+    std::list<Slot> lru;                                            // front = most recently used
+    std::unordered_map<uint32_t, std::list<Slot>::iterator> slots;
+    std::unordered_map<uint32_t, int> pinned;
+};
+
+// --- Indirection ---
+
+// CPU copy of the page table texture: one RGBA8 texel per tile per level.
+// Texel = R pool page x, G pool page y, B level of the tile actually mapped, A 255 (0 = nothing).
+// Unmapped tiles resolve to their closest mapped ancestor, so sampling always finds something
+// once the root tile is in.
+class VirtualPageTable {
+public:
+    VirtualPageTable(int tilesPerSide, int levelCount, int poolPagesPerRow);
+
+    void Map(TileId tile, int page);
+    void Unmap(TileId tile);
+    int GetPage(TileId tile) const;
+
+    // Rebuilds levels touched since the last call (a change at level L affects L and finer).
+    // Returns the coarsest level that changed (upload levels 0..that), -1 if none.
+    int Resolve();
+
+    const std::vector<uint32_t>& GetLevel(int level) const { return resolved[level]; }
+    int LevelSize(int level) const { return tilesPerSide >> level; }
+    int GetLevelCount() const { return levelCount; }
+
+private:
+    int tilesPerSide;
+    int levelCount;
+    int poolPagesPerRow;
+    std::vector<std::vector<int>> pages;          // mapped page per tile, -1 = none
+    std::vector<std::vector<uint32_t>> resolved;
+    int dirtyLevel = -1;
+};
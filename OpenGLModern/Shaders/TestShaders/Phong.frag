@@ -8,6 +8,11 @@ in vec2 TexCoord;
 
 // --- Uniforms ---
 uniform sampler2D texture1;
+// Packed diffuse maps (TextureArrayBuilder): layer + atlas rect instead of texture1
+uniform sampler2DArray diffuseArray;
+uniform bool useDiffuseArray;
+uniform float diffuseLayer;
+uniform vec4 uvTransform; // uv * xy + zw
 uniform vec3 viewPos; 
 
 // NOTE: Lighting.glsl is injected here automatically
@@ -19,7 +24,9 @@ void main()
     vec3 norm = normalize(Normal); 
 
     // 1. Get the base color from your texture
-    vec4 texColor = texture(texture1, TexCoord);
+    vec4 texColor = useDiffuseArray
+        ? texture(diffuseArray, vec3(TexCoord * uvTransform.xy + uvTransform.zw, diffuseLayer))
+        : texture(texture1, TexCoord);
     
     // 2. Setup Material Properties
     vec3 albedo = texColor.rgb;
@@ -0,0 +1,44 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoord;
+layout (location = 3) in uvec4 aBoneIds;     // 4 x uint8 palette indices
+layout (location = 4) in vec4 aBoneWeights;  // 4 x unorm8, sum to 1
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoord;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+uniform mat3 normalMatrix;
+
+// All characters' skinning matrices live in one texture buffer (4 texels per mat4)
+uniform samplerBuffer bonePalette;
+uniform int boneOffset;
+
+mat4 FetchBone(uint index)
+{
+    int base = (boneOffset + int(index)) * 4;
+    return mat4(texelFetch(bonePalette, base),
+                texelFetch(bonePalette, base + 1),
+                texelFetch(bonePalette, base + 2),
+                texelFetch(bonePalette, base + 3));
+}
+
+void main()
+{
+    mat4 skin = FetchBone(aBoneIds.x) * aBoneWeights.x
+              + FetchBone(aBoneIds.y) * aBoneWeights.y
+              + FetchBone(aBoneIds.z) * aBoneWeights.z
+              + FetchBone(aBoneIds.w) * aBoneWeights.w;
+
+    vec4 skinnedPos = skin * vec4(aPos, 1.0);
+
+    FragPos = vec3(model * skinnedPos);
+    Normal = normalMatrix * (mat3(skin) * aNormal);
+    TexCoord = aTexCoord;
+
+    gl_Position = projection * view * model * skinnedPos;
+}
@@ -0,0 +1,56 @@
+#version 330 core
+out vec4 FragColor;
+
+// --- Inputs from Vertex Shader (Phong.vert) ---
+in vec3 FragPos;
+in vec3 Normal;
+in vec2 TexCoord;
+
+// --- Uniforms ---
+uniform vec3 viewPos;
+
+// Set by VirtualTexture::Bind
+uniform sampler2D vtPool;       // resident tiles, with borders
+uniform sampler2D vtPageTable;  // per tile per level: pool page xy, level actually mapped
+uniform float vtSize;           // virtual texels per side at level 0
+uniform float vtTileSize;
+uniform float vtBorder;
+uniform float vtPaddedTileSize;
+uniform float vtLevelCount;
+uniform float vtPoolSize;       // pool texels per side
+
+// NOTE: Lighting.glsl is injected here automatically
+// It provides: CalculateAllLights(...)
+
+vec4 SampleVirtual(vec2 uv)
+{
+    // 1. Wanted level from the screen space derivatives of virtual texel coordinates
+    vec2 texel = uv * vtSize;
+    vec2 dx = dFdx(texel);
+    vec2 dy = dFdy(texel);
+    float lod = 0.5 * log2(max(max(dot(dx, dx), dot(dy, dy)), 1e-8));
+    int level = int(clamp(floor(lod), 0.0, vtLevelCount - 1.0));
+
+    // 2. Page table: which pool page holds this tile (or its closest resident ancestor)
+    uv = fract(uv);
+    float tilesAtLevel = vtSize / vtTileSize / exp2(float(level));
+    vec4 entry = texelFetch(vtPageTable, ivec2(uv * tilesAtLevel), level) * 255.0;
+
+    // 3. Position inside that page, at the level that's actually mapped
+    float tilesAtMapped = vtSize / vtTileSize / exp2(entry.b);
+    vec2 local = fract(uv * tilesAtMapped);
+    vec2 poolTexel = entry.xy * vtPaddedTileSize + vtBorder + local * vtTileSize;
+    return textureLod(vtPool, poolTexel / vtPoolSize, 0.0);
+}
+
+void main()
+{
+    vec3 norm = normalize(Normal);
+
+    vec3 albedo = SampleVirtual(TexCoord).rgb;
+    float specMap = 0.5;
+    float shininess = 32.0;
+
+    vec3 result = CalculateAllLights(norm, FragPos, viewPos, albedo, specMap, shininess);
+    FragColor = vec4(result, 1.0);
+}
@@ -0,0 +1,28 @@
+#version 330 core
+out vec4 FeedbackColor;
+
+// --- Inputs from Vertex Shader (Phong.vert) ---
+in vec2 TexCoord;
+
+// Set by VirtualTexture::Bind
+uniform float vtSize;
+uniform float vtTileSize;
+uniform float vtLevelCount;
+uniform float vtFeedbackLodBias; // the feedback target is smaller than the screen
+
+// Writes the tile this pixel would sample, encoded like EncodeFeedback (VirtualTexturing.hpp):
+// R/G = low 8 bits of tile x/y, B = level | x bits 8-9 << 4 | y bits 8-9 << 6, A = 1
+void main()
+{
+    vec2 texel = TexCoord * vtSize;
+    vec2 dx = dFdx(texel);
+    vec2 dy = dFdy(texel);
+    float lod = 0.5 * log2(max(max(dot(dx, dx), dot(dy, dy)), 1e-8)) + vtFeedbackLodBias;
+    int level = int(clamp(floor(lod), 0.0, vtLevelCount - 1.0));
+
+    float tilesAtLevel = vtSize / vtTileSize / exp2(float(level));
+    ivec2 tile = ivec2(fract(TexCoord) * tilesAtLevel);
+
+    int b = level | (((tile.x >> 8) & 3) << 4) | (((tile.y >> 8) & 3) << 6);
+    FeedbackColor = vec4(float(tile.x & 255), float(tile.y & 255), float(b), 255.0) / 255.0;
+}
@@ -1,7 +1,10 @@
 #include "Cube/Cube.hpp"
 #include "Shader/Shader.hpp"
 #include "Texture/Texture.hpp"
+#include "Texture/TextureCache.hpp"
+#include "Texture/TextureStreamer.hpp"
 #include "Engine/GameObjectComponents/MeshRenderer.hpp" // Ensure this file is in your include path
+#include "Engine/GameObjectComponents/Animator.hpp"
 
 #include <Engine/Managers/ServiceLocator.hpp>
 #include "Engine/RenderContext.hpp"
@@ -12,25 +15,43 @@
 #include <OPENGL/glm/glm.hpp>
 #include <OPENGL/glm/gtc/matrix_transform.hpp>
 #include <iostream>
+#include <algorithm>
 
 Cube::Cube(glm::vec3 pos) {
-    position = pos;
+    transform.SetLocalPosition(pos);
     
     // 1. Initialize the MeshRenderer with the path
     // This handles Assimp loading, VAO/VBO generation internally
     meshRenderer = std::make_unique<MeshRenderer>("C:/Users/piotr/Downloads/DamagedHelmet.glb");
     
-    // Manually set owner if your MeshRenderer relies on 'owner->position' 
+    // Manually set owner: the MeshRenderer draws with the owner's Transform
     // (If you haven't fully implemented the generic Component system yet, we do this manually)
     meshRenderer->SetOwner(this); 
 
     // 2. Setup Shader & Texture
     shader = std::make_unique<Shader>("Shaders/TestShaders/Phong.vert", "Shaders/TestShaders/Phong.frag");
-    texture = std::make_unique<Texture>("Textures/temp/texture.png");
+    // Streamed: starts with the small mips, sharpens as the cube gets bigger on screen
+    texture = ServiceLocator::Get().GetService<TextureStreamer>()->Open("Textures/temp/texture.png");
 
-    shader->use();
-    shader->setInt("texture1", 0);
-    shader->setVec4("ambientColor", glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+    // Animated models: skinned submeshes go through Skinned.vert (same fragment shader),
+    // their pose is evaluated with every other character's in AnimationSystem
+    if (auto skeleton = meshRenderer->GetSkeleton()) {
+        skinnedShader = std::make_unique<Shader>("Shaders/TestShaders/Skinned.vert", "Shaders/TestShaders/Phong.frag");
+        const auto& clips = meshRenderer->GetAnimations();
+        AddComponent<Animator>(skeleton, clips.empty() ? nullptr : clips.front());
+    }
+
+    for (Shader* target : { shader.get(), skinnedShader.get() }) {
+        if (!target) continue;
+        target->use();
+        target->setInt("texture1", 0);
+        // Array samplers need their own unit (two sampler types can't share one)
+        target->setInt("diffuseArray", static_cast<int>(MaterialSlot::DiffuseArray));
+        target->setVec4("ambientColor", glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+    }
+
+    // 3. Drawn by the Renderer from now on (camera, lights and textures are set there)
+    meshRenderer->SetShader(shader.get(), texture, skinnedShader.get());
 }
 
 Cube::~Cube() {
@@ -38,22 +59,16 @@ Cube::~Cube() {
 }
 
 void Cube::Update(double deltaTime) {
-    texture->bind(0);
-    shader->use();
-
-    // --- SETUP GLOBAL UNIFORMS (View/Proj/Lights) ---
-    auto renderService = ServiceLocator::Get().GetService<RenderContext>();
-    
-    shader->setMat4("view", renderService->GetViewMatrix());
-    shader->setMat4("projection", renderService->GetProjectionMatrix());
-
-    auto cam = renderService->GetMainCamera();
-    if (cam) shader->setVec3("viewPos", cam->GetPosition());
-
-    auto& lightManager = renderService->GetLightManager();
-    lightManager.UpdateShader(*shader);
+    // Only CPU work here: the Renderer draws the MeshRenderer's packets after the updates
+    RenderContext& renderService = ServiceLocator::GetServiceRef<RenderContext>();
 
-    // --- DELEGATE DRAWING TO THE COMPONENT ---
-    // The MeshRenderer calculates the Model matrix (using this->position) and draws meshes
-    meshRenderer->Draw(*shader);
+    // Tell the streamer how big we are on screen (unit sized model, radius ~1)
+    if (auto cam = renderService.GetMainCamera(); cam && texture) {
+        const glm::vec3& scale = transform.GetLocalScale();
+        const float radius = std::max(scale.x, std::max(scale.y, scale.z));
+        const float distance = glm::length(cam->GetPosition() - transform.GetWorldPosition());
+        const float pixels = TextureStreamer::ProjectedSizePixels(radius, distance,
+            renderService.GetProjectionMatrix()[1][1], static_cast<float>(renderService.GetViewportHeight()));
+        ServiceLocator::GetServiceRef<TextureStreamer>().RequestScreenSize(texture, pixels);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include <Engine/Animation/AnimationClip.hpp>
+#include <Engine/Utils/SimdMath.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float kSqrt2 = 1.41421356f;
+    constexpr float kQuatScale = 32767.0f;   // 15 bits per stored component
+    constexpr float kVecScale = 65535.0f;    // 16 bits per component
+
+    // Greedy curve fit: from each kept key, extend the segment as long as every skipped
+    // sample is reproduced by interpolating the segment's end points.
+    template <typename Fits>
+    std::vector<size_t> ReduceKeys(size_t count, Fits fits) {
+        std::vector<size_t> keys;
+        if (count == 0) return keys;
+
+        keys.push_back(0);
+        size_t anchor = 0;
+        while (anchor + 1 < count) {
+            size_t end = anchor + 1;
+            while (end + 1 < count) {
+                const size_t candidate = end + 1;
+                bool ok = true;
+                for (size_t i = anchor + 1; i < candidate && ok; i++) {
+                    ok = fits(anchor, candidate, i);
+                }
+                if (!ok) break;
+                end = candidate;
+            }
+            keys.push_back(end);
+            anchor = end;
+        }
+        return keys;
+    }
+
+    float InterpFactor(size_t a, size_t b, size_t i) {
+        return static_cast<float>(i - a) / static_cast<float>(b - a);
+    }
+
+    void QuatToArray(const glm::quat& q, float* out) {
+        out[0] = q.x; out[1] = q.y; out[2] = q.z; out[3] = q.w;
+    }
+
+    // Max component error, treating q and -q as the same rotation
+    float QuatError(const float* a, const float* b) {
+        float same = 0.0f, flipped = 0.0f;
+        for (int c = 0; c < 4; c++) {
+            same = std::max(same, std::abs(a[c] - b[c]));
+            flipped = std::max(flipped, std::abs(a[c] + b[c]));
+        }
+        return std::min(same, flipped);
+    }
+
+    uint16_t QuantizeUnit(float v, float scale) {
+        v = std::clamp(v, 0.0f, 1.0f);
+        return static_cast<uint16_t>(std::lround(v * scale));
+    }
+}
+
+AnimationClip::PackedQuat AnimationClip::PackQuat(const glm::quat& q) {
+    float c[4];
+    QuatToArray(glm::normalize(q), c);
+
+    int largest = 0;
+    for (int i = 1; i < 4; i++) {
+        if (std::abs(c[i]) > std::abs(c[largest])) largest = i;
+    }
+    // q and -q are the same rotation: make the dropped component positive
+    if (c[largest] < 0.0f) {
+        for (float& v : c) v = -v;
+    }
+
+    uint16_t stored[3];
+    for (int i = 0, s = 0; i < 4; i++) {
+        if (i == largest) continue;
+        // Remaining components are within [-1/sqrt2, 1/sqrt2]
+        stored[s++] = QuantizeUnit((c[i] * kSqrt2) * 0.5f + 0.5f, kQuatScale);
+    }
+
+    PackedQuat packed;
+    packed.a = static_cast<uint16_t>(stored[0] | ((largest >> 1) << 15));
+    packed.b = static_cast<uint16_t>(stored[1] | ((largest & 1) << 15));
+    packed.c = stored[2];
+    return packed;
+}
+
+void AnimationClip::UnpackQuat(const PackedQuat& packed, float* out) {
+    const int largest = ((packed.a >> 15) << 1) | (packed.b >> 15);
+    const uint16_t stored[3] = {
+        static_cast<uint16_t>(packed.a & 0x7FFF),
+        static_cast<uint16_t>(packed.b & 0x7FFF),
+        static_cast<uint16_t>(packed.c & 0x7FFF)
+    };
+
+    float sumSq = 0.0f;
+    for (int i = 0, s = 0; i < 4; i++) {
+        if (i == largest) continue;
+        const float v = ((stored[s++] / kQuatScale) * 2.0f - 1.0f) / kSqrt2;
+        out[i] = v;
+        sumSq += v * v;
+    }
+    out[largest] = std::sqrt(std::max(0.0f, 1.0f - sumSq));
+}
+
+AnimationClip::Channel AnimationClip::CompressVec3(const glm::vec3* samples, size_t count, float tolerance) {
+    Channel channel;
+    if (count == 0) return channel;
+
+    std::vector<size_t> keys = ReduceKeys(count, [&](size_t a, size_t b, size_t i) {
+        const glm::vec3 v = glm::mix(samples[a], samples[b], InterpFactor(a, b, i));
+        const glm::vec3 d = glm::abs(v - samples[i]);
+        return std::max(d.x, std::max(d.y, d.z)) <= tolerance;
+    });
+
+    // A flat curve only needs one key
+    if (keys.size() == 2) {
+        const glm::vec3 d = glm::abs(samples[keys[1]] - samples[keys[0]]);
+        if (std::max(d.x, std::max(d.y, d.z)) <= tolerance) keys.pop_back();
+    }
+
+    glm::vec3 lo(samples[keys[0]]), hi(samples[keys[0]]);
+    for (size_t k : keys) {
+        lo = glm::min(lo, samples[k]);
+        hi = glm::max(hi, samples[k]);
+    }
+    const glm::vec3 extent = hi - lo;
+    for (int c = 0; c < 3; c++) {
+        channel.rangeMin[c] = lo[c];
+        channel.rangeExtent[c] = extent[c];
+    }
+
+    channel.firstKey = static_cast<uint32_t>(vecFrames.size());
+    channel.keyCount = static_cast<uint32_t>(keys.size());
+    for (size_t k : keys) {
+        PackedVec3 packed;
+        uint16_t* dst = &packed.x;
+        for (int c = 0; c < 3; c++) {
+            dst[c] = extent[c] > 0.0f ? QuantizeUnit((samples[k][c] - lo[c]) / extent[c], kVecScale) : 0;
+        }
+        vecFrames.push_back(static_cast<uint16_t>(k));
+        vecValues.push_back(packed);
+    }
+    return channel;
+}
+
+AnimationClip::Channel AnimationClip::CompressQuat(const glm::quat* samples, size_t count, float tolerance) {
+    Channel channel;
+    if (count == 0) return channel;
+
+    std::vector<float> raw(count * 4);
+    for (size_t i = 0; i < count; i++) {
+        QuatToArray(glm::normalize(samples[i]), &raw[i * 4]);
+    }
+
+    std::vector<size_t> keys = ReduceKeys(count, [&](size_t a, size_t b, size_t i) {
+        float v[4];
+        simd::Nlerp4(&raw[a * 4], &raw[b * 4], InterpFactor(a, b, i), v);
+        return QuatError(v, &raw[i * 4]) <= tolerance;
+    });
+
+    if (keys.size() == 2 && QuatError(&raw[keys[0] * 4], &raw[keys[1] * 4]) <= tolerance) {
+        keys.pop_back();
+    }
+
+    channel.firstKey = static_cast<uint32_t>(rotFrames.size());
+    channel.keyCount = static_cast<uint32_t>(keys.size());
+    for (size_t k : keys) {
+        rotFrames.push_back(static_cast<uint16_t>(k));
+        rotValues.push_back(PackQuat(glm::normalize(samples[k])));
+    }
+    return channel;
+}
+
+AnimationClip AnimationClip::Compress(const std::string& name, float sampleRate, size_t frameCount,
+                                      const std::vector<RawJointTrack>& tracks,
+                                      const ClipCompressionSettings& settings) {
+    AnimationClip clip;
+    clip.name = name;
+    clip.sampleRate = sampleRate;
+    // Frame numbers are stored in 16 bits: longer clips are cut, and so is every track, or its later
+    // keys would wrap around to small frame numbers and break the sorted key search when sampling
+    frameCount = std::min<size_t>(frameCount, 65535);
+    clip.duration = frameCount > 1 ? static_cast<float>(frameCount - 1) / sampleRate : 0.0f;
+    clip.channels.resize(tracks.size());
+
+    for (size_t j = 0; j < tracks.size(); j++) {
+        const RawJointTrack& track = tracks[j];
+        const size_t translations = std::min(track.translations.size(), frameCount);
+        const size_t rotations = std::min(track.rotations.size(), frameCount);
+        const size_t scales = std::min(track.scales.size(), frameCount);
+        clip.rawKeyCount += translations + rotations + scales;
+
+        clip.channels[j].translation = clip.CompressVec3(track.translations.data(), translations, settings.translationTolerance);
+        clip.channels[j].rotation = clip.CompressQuat(track.rotations.data(), rotations, settings.rotationTolerance);
+        clip.channels[j].scale = clip.CompressVec3(track.scales.data(), scales, settings.scaleTolerance);
+    }
+    return clip;
+}
+
+size_t AnimationClip::GetCompressedBytes() const {
+    return channels.size() * sizeof(JointChannels)
+         + vecFrames.size() * (sizeof(uint16_t) + sizeof(PackedVec3))
+         + rotFrames.size() * (sizeof(uint16_t) + sizeof(PackedQuat));
+}
+
+void AnimationClip::SampleVec3(const Channel& channel, float frame, float* out) const {
+    auto decode = [&](uint32_t key, float* v) {
+        const uint16_t* q = &vecValues[key].x;
+        for (int c = 0; c < 3; c++) {
+            v[c] = channel.rangeMin[c] + (q[c] / kVecScale) * channel.rangeExtent[c];
+        }
+        v[3] = 0.0f;
+    };
+
+    if (channel.keyCount == 1) {
+        decode(channel.firstKey, out);
+        return;
+    }
+
+    const uint16_t* begin = vecFrames.data() + channel.firstKey;
+    const uint16_t* end = begin + channel.keyCount;
+    const uint16_t* hi = std::upper_bound(begin, end, frame, [](float f, uint16_t k) { return f < k; });
+    hi = std::clamp(hi, begin + 1, end - 1);
+    const uint16_t* lo = hi - 1;
+
+    alignas(16) float a[4], b[4];
+    decode(static_cast<uint32_t>(lo - vecFrames.data()), a);
+    decode(static_cast<uint32_t>(hi - vecFrames.data()), b);
+    const float t = std::clamp((frame - *lo) / static_cast<float>(*hi - *lo), 0.0f, 1.0f);
+    simd::Lerp4(a, b, t, out);
+}
+
+void AnimationClip::SampleQuat(const Channel& channel, float frame, float* out) const {
+    if (channel.keyCount == 1) {
+        UnpackQuat(rotValues[channel.firstKey], out);
+        return;
+    }
+
+    const uint16_t* begin = rotFrames.data() + channel.firstKey;
+    const uint16_t* end = begin + channel.keyCount;
+    const uint16_t* hi = std::upper_bound(begin, end, frame, [](float f, uint16_t k) { return f < k; });
+    hi = std::clamp(hi, begin + 1, end - 1);
+    const uint16_t* lo = hi - 1;
+
+    alignas(16) float a[4], b[4];
+    UnpackQuat(rotValues[lo - rotFrames.data()], a);
+    UnpackQuat(rotValues[hi - rotFrames.data()], b);
+    const float t = std::clamp((frame - *lo) / static_cast<float>(*hi - *lo), 0.0f, 1.0f);
+    simd::Nlerp4(a, b, t, out);
+}
+
+void AnimationClip::SamplePose(float timeSeconds, const JointPose* bindPose, JointPose* outPose) const {
+    const float frame = std::clamp(timeSeconds, 0.0f, duration) * sampleRate;
+
+    for (size_t j = 0; j < channels.size(); j++) {
+        const JointChannels& joint = channels[j];
+        JointPose& pose = outPose[j];
+        pose = bindPose[j];
+
+        if (joint.translation.keyCount) SampleVec3(joint.translation, frame, pose.translation);
+        if (joint.rotation.keyCount) SampleQuat(joint.rotation, frame, pose.rotation);
+        if (joint.scale.keyCount) SampleVec3(joint.scale, frame, pose.scale);
+    }
+}
@@ -0,0 +1,130 @@
+#include <Engine/Animation/AnimationImport.hpp>
+#include <OPENGL/glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    // Assimp matrices are row-major, glm is column-major
+    glm::mat4 ToGlm(const aiMatrix4x4& m) {
+        return glm::transpose(glm::make_mat4(&m.a1));
+    }
+
+    glm::vec3 ToGlm(const aiVector3D& v) { return glm::vec3(v.x, v.y, v.z); }
+    glm::quat ToGlm(const aiQuaternion& q) { return glm::quat(q.w, q.x, q.y, q.z); }
+
+    JointPose DecomposePose(const aiMatrix4x4& m) {
+        aiVector3D scaling, position;
+        aiQuaternion rotation;
+        m.Decompose(scaling, rotation, position);
+
+        JointPose pose;
+        pose.translation[0] = position.x; pose.translation[1] = position.y; pose.translation[2] = position.z;
+        pose.rotation[0] = rotation.x; pose.rotation[1] = rotation.y; pose.rotation[2] = rotation.z; pose.rotation[3] = rotation.w;
+        pose.scale[0] = scaling.x; pose.scale[1] = scaling.y; pose.scale[2] = scaling.z;
+        return pose;
+    }
+
+    void AddJoints(const aiNode* node, int parent, Skeleton& skeleton) {
+        const int index = static_cast<int>(skeleton.joints.size());
+        skeleton.joints.push_back({ node->mName.C_Str(), parent });
+        skeleton.bindPose.push_back(DecomposePose(node->mTransformation));
+        skeleton.jointByName[node->mName.C_Str()] = index;
+
+        for (unsigned int i = 0; i < node->mNumChildren; i++) {
+            AddJoints(node->mChildren[i], index, skeleton);
+        }
+    }
+
+    // Finds the key segment containing 'ticks' (keys are sorted by time)
+    template <typename Key>
+    void FindSegment(const Key* keys, unsigned int count, double ticks, unsigned int& a, unsigned int& b, float& t) {
+        if (count == 1 || ticks <= keys[0].mTime) { a = b = 0; t = 0.0f; return; }
+        if (ticks >= keys[count - 1].mTime) { a = b = count - 1; t = 0.0f; return; }
+
+        b = 1;
+        while (b < count - 1 && keys[b].mTime < ticks) b++;
+        a = b - 1;
+        t = static_cast<float>((ticks - keys[a].mTime) / (keys[b].mTime - keys[a].mTime));
+    }
+
+    glm::vec3 SampleVectorKeys(const aiVectorKey* keys, unsigned int count, double ticks) {
+        unsigned int a, b; float t;
+        FindSegment(keys, count, ticks, a, b, t);
+        return glm::mix(ToGlm(keys[a].mValue), ToGlm(keys[b].mValue), t);
+    }
+
+    glm::quat SampleQuatKeys(const aiQuatKey* keys, unsigned int count, double ticks) {
+        unsigned int a, b; float t;
+        FindSegment(keys, count, ticks, a, b, t);
+        return glm::slerp(ToGlm(keys[a].mValue), ToGlm(keys[b].mValue), t);
+    }
+}
+
+std::shared_ptr<Skeleton> ImportSkeleton(const aiScene* scene) {
+    bool skinned = false;
+    for (unsigned int m = 0; m < scene->mNumMeshes && !skinned; m++) {
+        skinned = scene->mMeshes[m]->HasBones();
+    }
+    if (!skinned) return nullptr;
+
+    auto skeleton = std::make_shared<Skeleton>();
+
+    // 1. Joints: the whole node tree, depth first so parents come before children
+    AddJoints(scene->mRootNode, -1, *skeleton);
+    skeleton->globalInverse = glm::inverse(ToGlm(scene->mRootNode->mTransformation));
+
+    // 2. Palette: every distinct bone referenced by a mesh
+    for (unsigned int m = 0; m < scene->mNumMeshes; m++) {
+        const aiMesh* mesh = scene->mMeshes[m];
+        for (unsigned int b = 0; b < mesh->mNumBones; b++) {
+            const aiBone* bone = mesh->mBones[b];
+            const std::string name = bone->mName.C_Str();
+            if (skeleton->boneByName.count(name)) continue;
+
+            const int joint = skeleton->FindJoint(name);
+            if (joint < 0) {
+                std::cerr << "ERROR::ANIMATION::Bone without node: " << name << std::endl;
+                continue;
+            }
+            if (skeleton->BoneCount() >= kMaxSkinBones) {
+                std::cerr << "ERROR::ANIMATION::More than " << kMaxSkinBones << " bones, ignoring " << name << std::endl;
+                continue;
+            }
+
+            skeleton->boneByName[name] = static_cast<int>(skeleton->BoneCount());
+            skeleton->boneJoints.push_back(joint);
+            skeleton->inverseBind.push_back(ToGlm(bone->mOffsetMatrix));
+        }
+    }
+    return skeleton;
+}
+
+std::shared_ptr<AnimationClip> ImportAnimationClip(const aiAnimation* animation, const Skeleton& skeleton,
+                                                   float sampleRate, const ClipCompressionSettings& settings) {
+    // glTF exports leave mTicksPerSecond at 0, assimp's convention is then 25
+    const double ticksPerSecond = animation->mTicksPerSecond > 0.0 ? animation->mTicksPerSecond : 25.0;
+    const double durationSeconds = animation->mDuration / ticksPerSecond;
+    const size_t frameCount = static_cast<size_t>(std::ceil(durationSeconds * sampleRate)) + 1;
+
+    std::vector<RawJointTrack> tracks(skeleton.JointCount());
+    for (unsigned int c = 0; c < animation->mNumChannels; c++) {
+        const aiNodeAnim* channel = animation->mChannels[c];
+        const int joint = skeleton.FindJoint(channel->mNodeName.C_Str());
+        if (joint < 0) continue;
+
+        RawJointTrack& track = tracks[joint];
+        for (size_t f = 0; f < frameCount; f++) {
+            const double ticks = std::min(f / static_cast<double>(sampleRate), durationSeconds) * ticksPerSecond;
+            if (channel->mNumPositionKeys)
+                track.translations.push_back(SampleVectorKeys(channel->mPositionKeys, channel->mNumPositionKeys, ticks));
+            if (channel->mNumRotationKeys)
+                track.rotations.push_back(SampleQuatKeys(channel->mRotationKeys, channel->mNumRotationKeys, ticks));
+            if (channel->mNumScalingKeys)
+                track.scales.push_back(SampleVectorKeys(channel->mScalingKeys, channel->mNumScalingKeys, ticks));
+        }
+    }
+
+    return std::make_shared<AnimationClip>(
+        AnimationClip::Compress(animation->mName.C_Str(), sampleRate, frameCount, tracks, settings));
+}
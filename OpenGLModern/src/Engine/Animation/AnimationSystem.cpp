@@ -0,0 +1,154 @@
+#include <Engine/Animation/AnimationSystem.hpp>
+#include <Engine/Utils/ParallelFor.hpp>
+#include <Shader/Shader.hpp>
+#include <OPENGL/glad/glad.h>
+#include <chrono>
+#include <cmath>
+
+AnimationSystem::~AnimationSystem() {
+    if (paletteTexture) glDeleteTextures(1, &paletteTexture);
+    if (paletteBuffer) glDeleteBuffers(1, &paletteBuffer);
+}
+
+AnimationSystem::InstanceId AnimationSystem::AddInstance(std::shared_ptr<const Skeleton> skeleton,
+                                                         std::shared_ptr<const AnimationClip> clip) {
+    InstanceId id;
+    if (!freeList.empty()) {
+        id = freeList.back();
+        freeList.pop_back();
+    } else {
+        id = static_cast<InstanceId>(instances.size());
+        instances.emplace_back();
+    }
+
+    Instance& instance = instances[id];
+    instance = Instance{};
+    instance.skeleton = std::move(skeleton);
+    instance.clip = std::move(clip);
+    instance.active = true;
+    layoutDirty = true;
+    return id;
+}
+
+void AnimationSystem::RemoveInstance(InstanceId id) {
+    if (id >= instances.size() || !instances[id].active) return;
+    instances[id] = Instance{};
+    freeList.push_back(id);
+    layoutDirty = true;
+}
+
+void AnimationSystem::Play(InstanceId id, std::shared_ptr<const AnimationClip> clip, float speed, bool loop) {
+    if (id >= instances.size() || !instances[id].active) return;
+    Instance& instance = instances[id];
+    instance.clip = std::move(clip);
+    instance.time = 0.0f;
+    instance.speed = speed;
+    instance.loop = loop;
+}
+
+void AnimationSystem::RebuildLayout() {
+    // Pack every active instance's palette back to back
+    uint32_t offset = 0;
+    stats.activeInstances = 0;
+    for (auto& instance : instances) {
+        if (!instance.active) continue;
+        instance.paletteOffset = offset;
+        offset += static_cast<uint32_t>(instance.skeleton->BoneCount());
+        stats.activeInstances++;
+    }
+    palette.resize(offset);
+    stats.paletteMatrices = offset;
+    layoutDirty = false;
+}
+
+void AnimationSystem::EvaluateInstance(Instance& instance) {
+    const Skeleton& skeleton = *instance.skeleton;
+
+    // Per-thread scratch, reused across frames and instances
+    thread_local std::vector<JointPose> pose;
+    thread_local std::vector<glm::mat4> model;
+    pose.resize(skeleton.JointCount());
+    model.resize(skeleton.JointCount());
+
+    if (instance.clip && instance.clip->GetJointCount() == skeleton.JointCount()) {
+        instance.clip->SamplePose(instance.time, skeleton.bindPose.data(), pose.data());
+    } else {
+        std::copy(skeleton.bindPose.begin(), skeleton.bindPose.end(), pose.begin());
+    }
+
+    BuildSkinningMatrices(skeleton, pose.data(), model.data(), palette.data() + instance.paletteOffset);
+}
+
+void AnimationSystem::Update(double deltaTime) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    if (layoutDirty) RebuildLayout();
+
+    // 1. Advance clocks (cheap, serial)
+    for (auto& instance : instances) {
+        if (!instance.active || !instance.clip) continue;
+        const float duration = instance.clip->GetDuration();
+        instance.time += static_cast<float>(deltaTime) * instance.speed;
+        if (duration <= 0.0f) {
+            instance.time = 0.0f;
+        } else if (instance.loop) {
+            instance.time = std::fmod(instance.time, duration);
+            if (instance.time < 0.0f) instance.time += duration;
+        } else if (instance.time > duration) {
+            instance.time = duration;
+        }
+    }
+
+    // 2. Sample + concatenate, batches of characters per worker
+    const size_t batchCount = (instances.size() + kBatchSize - 1) / kBatchSize;
+    ParallelFor(batchCount, [&](size_t batch) {
+        const size_t end = std::min(instances.size(), (batch + 1) * kBatchSize);
+        for (size_t i = batch * kBatchSize; i < end; i++) {
+            if (instances[i].active) EvaluateInstance(instances[i]);
+        }
+    });
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    stats.updateMs = std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+void AnimationSystem::Upload() {
+    stats.uploadBytes = 0;
+    if (palette.empty()) return;
+
+    if (!paletteBuffer) {
+        glGenBuffers(1, &paletteBuffer);
+        glGenTextures(1, &paletteTexture);
+    }
+
+    const size_t bytes = palette.size() * sizeof(glm::mat4);
+    glBindBuffer(GL_TEXTURE_BUFFER, paletteBuffer);
+    if (bytes > paletteCapacityBytes) {
+        paletteCapacityBytes = bytes;
+        glBufferData(GL_TEXTURE_BUFFER, paletteCapacityBytes, nullptr, GL_STREAM_DRAW);
+        glBindTexture(GL_TEXTURE_BUFFER, paletteTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, paletteBuffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+    } else {
+        // Orphan last frame's storage so we don't stall on draws still reading it
+        glBufferData(GL_TEXTURE_BUFFER, paletteCapacityBytes, nullptr, GL_STREAM_DRAW);
+    }
+    glBufferSubData(GL_TEXTURE_BUFFER, 0, bytes, palette.data());
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    stats.uploadBytes = bytes;
+}
+
+void AnimationSystem::BindPalette(const Shader& shader, InstanceId id) const {
+    if (id >= instances.size() || !instances[id].active || !paletteTexture) return;
+
+    glActiveTexture(GL_TEXTURE0 + kPaletteTextureSlot);
+    glBindTexture(GL_TEXTURE_BUFFER, paletteTexture);
+    shader.setInt("bonePalette", static_cast<int>(kPaletteTextureSlot));
+    shader.setInt("boneOffset", static_cast<int>(instances[id].paletteOffset));
+}
+
+const glm::mat4* AnimationSystem::GetPalette(InstanceId id) const {
+    if (id >= instances.size() || !instances[id].active || layoutDirty) return nullptr;
+    return palette.data() + instances[id].paletteOffset;
+}
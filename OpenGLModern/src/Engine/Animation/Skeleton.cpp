@@ -0,0 +1,102 @@
+#include <Engine/Animation/Skeleton.hpp>
+#include <Engine/Utils/SimdMath.hpp>
+#include <OPENGL/glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cmath>
+
+int Skeleton::FindJoint(const std::string& name) const {
+    auto it = jointByName.find(name);
+    return it != jointByName.end() ? it->second : -1;
+}
+
+int Skeleton::FindBone(const std::string& name) const {
+    auto it = boneByName.find(name);
+    return it != boneByName.end() ? it->second : -1;
+}
+
+PackedSkinWeights PackSkinWeights(const int* bones, const float* weights, size_t count) {
+    // 1. Pick the 4 strongest influences
+    int topBones[4] = { 0, 0, 0, 0 };
+    float topWeights[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (size_t i = 0; i < count; i++) {
+        int weakest = 0;
+        for (int k = 1; k < 4; k++) {
+            if (topWeights[k] < topWeights[weakest]) weakest = k;
+        }
+        if (weights[i] > topWeights[weakest]) {
+            topWeights[weakest] = weights[i];
+            topBones[weakest] = bones[i];
+        }
+    }
+
+    PackedSkinWeights packed;
+    const float sum = topWeights[0] + topWeights[1] + topWeights[2] + topWeights[3];
+    if (sum <= 0.0f) {
+        // Unskinned vertex: fully bound to palette entry 0
+        packed.weights[0] = 255;
+        return packed;
+    }
+
+    // 2. Quantize, then give the rounding remainder to the strongest influence
+    int total = 0, strongest = 0;
+    for (int k = 0; k < 4; k++) {
+        packed.bones[k] = static_cast<uint8_t>(std::clamp(topBones[k], 0, static_cast<int>(kMaxSkinBones) - 1));
+        packed.weights[k] = static_cast<uint8_t>(std::lround(topWeights[k] / sum * 255.0f));
+        total += packed.weights[k];
+        if (topWeights[k] > topWeights[strongest]) strongest = k;
+    }
+    packed.weights[strongest] = static_cast<uint8_t>(packed.weights[strongest] + (255 - total));
+    return packed;
+}
+
+void PoseToMatrix(const JointPose& pose, float* m) {
+    const float x = pose.rotation[0], y = pose.rotation[1], z = pose.rotation[2], w = pose.rotation[3];
+    const float sx = pose.scale[0], sy = pose.scale[1], sz = pose.scale[2];
+
+    const float xx = x * x, yy = y * y, zz = z * z;
+    const float xy = x * y, xz = x * z, yz = y * z;
+    const float wx = w * x, wy = w * y, wz = w * z;
+
+    m[0] = (1.0f - 2.0f * (yy + zz)) * sx;
+    m[1] = (2.0f * (xy + wz)) * sx;
+    m[2] = (2.0f * (xz - wy)) * sx;
+    m[3] = 0.0f;
+
+    m[4] = (2.0f * (xy - wz)) * sy;
+    m[5] = (1.0f - 2.0f * (xx + zz)) * sy;
+    m[6] = (2.0f * (yz + wx)) * sy;
+    m[7] = 0.0f;
+
+    m[8] = (2.0f * (xz + wy)) * sz;
+    m[9] = (2.0f * (yz - wx)) * sz;
+    m[10] = (1.0f - 2.0f * (xx + yy)) * sz;
+    m[11] = 0.0f;
+
+    m[12] = pose.translation[0];
+    m[13] = pose.translation[1];
+    m[14] = pose.translation[2];
+    m[15] = 1.0f;
+}
+
+void BuildSkinningMatrices(const Skeleton& skeleton, const JointPose* pose,
+                           glm::mat4* modelScratch, glm::mat4* outPalette) {
+    // 1. Local -> model space, parents first (SIMD 4x4 concatenation)
+    float local[16];
+    for (size_t j = 0; j < skeleton.JointCount(); j++) {
+        PoseToMatrix(pose[j], local);
+        const int parent = skeleton.joints[j].parent;
+        float* model = glm::value_ptr(modelScratch[j]);
+        if (parent < 0) {
+            simd::Mat4Mul(glm::value_ptr(skeleton.globalInverse), local, model);
+        } else {
+            simd::Mat4Mul(glm::value_ptr(modelScratch[parent]), local, model);
+        }
+    }
+
+    // 2. Palette: model space joint * inverse bind
+    for (size_t b = 0; b < skeleton.BoneCount(); b++) {
+        simd::Mat4Mul(glm::value_ptr(modelScratch[skeleton.boneJoints[b]]),
+                      glm::value_ptr(skeleton.inverseBind[b]),
+                      glm::value_ptr(outPalette[b]));
+    }
+}
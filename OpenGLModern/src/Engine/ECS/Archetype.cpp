@@ -0,0 +1,116 @@
+#include <Engine/ECS/Archetype.hpp>
+#include <algorithm>
+#include <new>
+
+namespace {
+    size_t AlignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    // Columns start on 16 bytes so SIMD loads over float arrays stay aligned
+    size_t ColumnAlignment(ComponentTypeId type) {
+        return std::max<size_t>(GetComponentTypeInfo(type).alignment, 16);
+    }
+}
+
+Archetype::Archetype(ComponentMask mask) : mask(mask) {
+    for (ComponentTypeId type = 0; type < kMaxComponentTypes; type++) {
+        if (Has(type)) {
+            types.push_back(type);
+            componentSizes[type] = static_cast<uint32_t>(GetComponentTypeInfo(type).size);
+        }
+    }
+    Layout();
+}
+
+Archetype::~Archetype() {
+    for (size_t c = 0; c < chunks.size(); c++) {
+        for (ComponentTypeId type : types) {
+            const ComponentTypeInfo& info = GetComponentTypeInfo(type);
+            std::byte* column = static_cast<std::byte*>(GetColumn(c, type));
+            for (uint32_t row = 0; row < chunks[c].count; row++) {
+                info.destroy(column + static_cast<size_t>(row) * info.size);
+            }
+        }
+        ::operator delete(chunks[c].data, std::align_val_t(kChunkAlignment));
+    }
+    if (spareChunk) ::operator delete(spareChunk, std::align_val_t(kChunkAlignment));
+}
+
+size_t Archetype::LayoutBytes(uint32_t rows) const {
+    size_t bytes = sizeof(Entity) * rows;
+    for (ComponentTypeId type : types) {
+        bytes = AlignUp(bytes, ColumnAlignment(type)) + static_cast<size_t>(componentSizes[type]) * rows;
+    }
+    return bytes;
+}
+
+void Archetype::Layout() {
+    // 1. As many rows as fit once padding is paid for
+    size_t rowBytes = sizeof(Entity);
+    for (ComponentTypeId type : types) rowBytes += componentSizes[type];
+    capacity = static_cast<uint32_t>(kChunkBytes / rowBytes);
+    while (capacity > 1 && LayoutBytes(capacity) > kChunkBytes) capacity--;
+
+    // 2. Components too big for the standard chunk get one row per (bigger) chunk
+    capacity = std::max(capacity, 1u);
+    chunkBytes = AlignUp(std::max(kChunkBytes, LayoutBytes(capacity)), kChunkAlignment);
+
+    // 3. Entity ids first, then one column per type
+    size_t offset = sizeof(Entity) * capacity;
+    for (ComponentTypeId type : types) {
+        offset = AlignUp(offset, ColumnAlignment(type));
+        columnOffsets[type] = static_cast<uint32_t>(offset);
+        offset += static_cast<size_t>(componentSizes[type]) * capacity;
+    }
+}
+
+Archetype::Row Archetype::AddRow(Entity entity) {
+    if (chunks.empty() || chunks.back().count == capacity) {
+        Chunk chunk;
+        if (spareChunk) {
+            chunk.data = spareChunk;
+            spareChunk = nullptr;
+        } else {
+            chunk.data = static_cast<std::byte*>(::operator new(chunkBytes, std::align_val_t(kChunkAlignment)));
+        }
+        chunks.push_back(chunk);
+    }
+
+    const uint32_t chunkIndex = static_cast<uint32_t>(chunks.size() - 1);
+    Chunk& chunk = chunks.back();
+    const Row row{ chunkIndex, chunk.count++ };
+    GetEntities(chunkIndex)[row.row] = entity;
+    entityCount++;
+    return row;
+}
+
+Entity Archetype::RemoveRow(Row row) {
+    const uint32_t lastChunk = static_cast<uint32_t>(chunks.size() - 1);
+    const Row last{ lastChunk, chunks[lastChunk].count - 1 };
+
+    Entity moved;
+    if (row.chunk != last.chunk || row.row != last.row) {
+        for (ComponentTypeId type : types) {
+            GetComponentTypeInfo(type).relocate(GetComponent(row, type), GetComponent(last, type));
+        }
+        moved = GetEntities(last.chunk)[last.row];
+        GetEntities(row.chunk)[row.row] = moved;
+    }
+
+    entityCount--;
+    if (--chunks[lastChunk].count == 0) {
+        // Keep one empty chunk around so spawn/despawn at a chunk boundary doesn't hit the allocator
+        if (spareChunk) ::operator delete(spareChunk, std::align_val_t(kChunkAlignment));
+        spareChunk = chunks[lastChunk].data;
+        chunks.pop_back();
+    }
+    return moved;
+}
+
+Entity Archetype::DestroyRow(Row row) {
+    for (ComponentTypeId type : types) {
+        GetComponentTypeInfo(type).destroy(GetComponent(row, type));
+    }
+    return RemoveRow(row);
+}
@@ -0,0 +1,30 @@
+#include <Engine/ECS/ComponentType.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+    // Fixed array: ids are handed out while other threads may be reading earlier entries
+    ComponentTypeInfo typeInfos[kMaxComponentTypes];
+    std::atomic<ComponentTypeId> typeCount{ 0 };
+}
+
+ComponentTypeId RegisterComponentType(const ComponentTypeInfo& info) {
+    const ComponentTypeId id = typeCount.fetch_add(1);
+    if (id >= kMaxComponentTypes) {
+        // Masks are 64 bits wide; silently aliasing two types would corrupt every archetype
+        std::cerr << "ERROR::ECS::TOO_MANY_COMPONENT_TYPES (max " << kMaxComponentTypes << ")" << std::endl;
+        std::abort();
+    }
+    typeInfos[id] = info;
+    return id;
+}
+
+const ComponentTypeInfo& GetComponentTypeInfo(ComponentTypeId id) {
+    return typeInfos[id];
+}
+
+ComponentTypeId GetComponentTypeCount() {
+    return std::min(typeCount.load(), kMaxComponentTypes);
+}
@@ -0,0 +1,82 @@
+#include <Engine/ECS/EcsWorld.hpp>
+
+Archetype& EcsWorld::GetArchetype(ComponentMask mask) {
+    auto it = archetypes.find(mask);
+    if (it != archetypes.end()) return *it->second;
+
+    auto archetype = std::make_unique<Archetype>(mask);
+    Archetype* raw = archetype.get();
+    archetypes.emplace(mask, std::move(archetype));
+    archetypeList.push_back(raw);
+    return *raw;
+}
+
+const EcsWorld::Record* EcsWorld::Find(Entity entity) const {
+    if (entity.index >= records.size()) return nullptr;
+    const Record& record = records[entity.index];
+    if (!record.archetype || record.generation != entity.generation) return nullptr;
+    return &record;
+}
+
+bool EcsWorld::IsAlive(Entity entity) const {
+    return Find(entity) != nullptr;
+}
+
+Entity EcsWorld::AllocateEntity(Archetype& archetype) {
+    Entity entity;
+    if (!freeIndices.empty()) {
+        entity.index = freeIndices.back();
+        freeIndices.pop_back();
+    } else {
+        entity.index = static_cast<uint32_t>(records.size());
+        records.emplace_back();
+    }
+
+    Record& record = records[entity.index];
+    entity.generation = record.generation;
+    record.archetype = &archetype;
+    record.row = archetype.AddRow(entity);
+    entityCount++;
+    return entity;
+}
+
+void EcsWorld::Destroy(Entity entity) {
+    if (!Find(entity)) return;
+
+    Record& record = records[entity.index];
+    Relocated(record.archetype->DestroyRow(record.row), record.row);
+
+    record.archetype = nullptr;
+    record.generation++;
+    freeIndices.push_back(entity.index);
+    entityCount--;
+}
+
+Archetype::Row EcsWorld::ChangeArchetype(Entity entity, ComponentMask newMask) {
+    Record& record = records[entity.index];
+    Archetype& from = *record.archetype;
+    Archetype& to = GetArchetype(newMask);
+    const Archetype::Row oldRow = record.row;
+    const Archetype::Row newRow = to.AddRow(entity);
+
+    // 1. Carry over what both have, drop the rest
+    for (ComponentTypeId type : from.GetTypes()) {
+        const ComponentTypeInfo& info = GetComponentTypeInfo(type);
+        if (to.Has(type)) {
+            info.relocate(to.GetComponent(newRow, type), from.GetComponent(oldRow, type));
+        } else {
+            info.destroy(from.GetComponent(oldRow, type));
+        }
+    }
+
+    // 2. Close the hole in the old archetype
+    Relocated(from.RemoveRow(oldRow), oldRow);
+
+    record.archetype = &to;
+    record.row = newRow;
+    return newRow;
+}
+
+void EcsWorld::Relocated(Entity moved, Archetype::Row row) {
+    if (moved.IsValid()) records[moved.index].row = row;
+}
@@ -0,0 +1,22 @@
+#include <Engine/GameObjectComponents/Animator.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+
+Animator::Animator(std::shared_ptr<const Skeleton> skeleton, std::shared_ptr<const AnimationClip> clip) {
+    auto animation = ServiceLocator::Get().GetService<AnimationSystem>();
+    instance = animation->AddInstance(std::move(skeleton), std::move(clip));
+}
+
+Animator::~Animator() {
+    try {
+        auto animation = ServiceLocator::Get().GetService<AnimationSystem>();
+        animation->RemoveInstance(instance);
+    } catch (...) {}
+}
+
+void Animator::Play(std::shared_ptr<const AnimationClip> clip, float speed, bool loop) {
+    ServiceLocator::Get().GetService<AnimationSystem>()->Play(instance, std::move(clip), speed, loop);
+}
+
+void Animator::BindPalette(const Shader& shader) const {
+    ServiceLocator::GetServiceRef<AnimationSystem>().BindPalette(shader, instance);
+}
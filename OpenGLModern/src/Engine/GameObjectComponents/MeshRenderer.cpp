@@ -3,48 +3,198 @@
 #include <iostream>
 #include <OPENGL/glm/glm.hpp>
 #include <Engine/GameObject.hpp>
-MeshRenderer::MeshRenderer(const std::string& path) {
+#include <Engine/Utils/ParallelFor.hpp>
+#include <Engine/Utils/Hash.hpp>
+#include <Engine/GameObjectComponents/Animator.hpp>
+#include <Engine/Renderer.hpp>
+#include <Engine/Animation/AnimationImport.hpp>
+#include <Texture/Image.hpp>
+#include <Texture/MipGenerator.hpp>
+#include <Texture/TextureCache.hpp>
+#include <Texture/TextureArrayBuilder.hpp>
+#include <unordered_map>
+#include <initializer_list>
+#include <cstring>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // One image referenced by the model's materials, decoded once no matter how many materials use it
+    struct TextureSource {
+        const aiTexture* embedded = nullptr; // blob stored inside the model file (.glb)
+        std::string filePath;                // or an external file next to the model
+        std::string name;
+        bool color = false;                  // used as a base color map: filter mips in linear light
+        bool dataMap = false;                // also used as specular/normal: stays a plain texture
+        bool tiled = false;                  // sampled with UVs outside 0..1: can't go into an atlas
+        Image image;
+        std::vector<Image> mips;
+        std::shared_ptr<Texture> texture;
+    };
+
+    size_t EmbeddedByteSize(const aiTexture* texture) {
+        // mHeight == 0 means pcData holds a compressed file (png/jpg) of mWidth bytes
+        if (texture->mHeight == 0) return texture->mWidth;
+        return static_cast<size_t>(texture->mWidth) * texture->mHeight * sizeof(aiTexel);
+    }
+
+    Image DecodeEmbedded(const aiTexture* texture) {
+        if (texture->mHeight == 0) {
+            return LoadImageFromMemory(reinterpret_cast<const unsigned char*>(texture->pcData),
+                                       EmbeddedByteSize(texture), true);
+        }
+
+        // Raw BGRA texels: swizzle to RGBA and flip rows like stb does for files
+        Image image;
+        image.width = static_cast<int>(texture->mWidth);
+        image.height = static_cast<int>(texture->mHeight);
+        image.channels = 4;
+        image.pixels.resize(static_cast<size_t>(image.width) * image.height * 4);
+        for (int y = 0; y < image.height; y++) {
+            const aiTexel* src = texture->pcData + static_cast<size_t>(y) * image.width;
+            unsigned char* dst = &image.pixels[static_cast<size_t>(image.height - 1 - y) * image.width * 4];
+            for (int x = 0; x < image.width; x++) {
+                dst[x * 4 + 0] = src[x].r;
+                dst[x * 4 + 1] = src[x].g;
+                dst[x * 4 + 2] = src[x].b;
+                dst[x * 4 + 3] = src[x].a;
+            }
+        }
+        return image;
+    }
+}
+
+MeshRenderer::MeshRenderer(const std::string& path, const WeldSettings& weldSettings)
+    : model(std::make_shared<Model>()), weldSettings(weldSettings) {
+    // Before loading: the submeshes register as they're uploaded
+    if (Renderer* service = ServiceLocator::TryGetServicePtr<Renderer>()) {
+        renderer = service;
+        renderer->Register(this);
+        model->renderer = renderer;
+    }
     LoadModel(path);
 }
 
+MeshRenderer::MeshRenderer(const MeshRenderer& other)
+    : Component(other), model(other.model), renderMaterials(other.renderMaterials),
+      directory(other.directory), weldSettings(other.weldSettings), renderer(other.renderer) {
+    if (renderer) renderer->Register(this);
+}
+
 MeshRenderer::~MeshRenderer() {
+    if (renderer) renderer->Unregister(this);
+}
+
+MeshRenderer::Model::~Model() {
     for (auto& mesh : meshes) {
+        if (renderer) renderer->RemoveMesh(mesh.handle);
         glDeleteVertexArrays(1, &mesh.VAO);
         glDeleteBuffers(1, &mesh.VBO);
         glDeleteBuffers(1, &mesh.EBO);
     }
 }
 
+MeshRenderer::RenderMaterials::~RenderMaterials() {
+    for (MaterialHandle handle : handles) renderer->RemoveMaterial(handle);
+    for (MaterialHandle handle : skinnedHandles) renderer->RemoveMaterial(handle);
+}
+
 void MeshRenderer::Draw(Shader& shader) {
-    // 1. Get Transform from the Owner GameObject
-    glm::mat4 model = glm::mat4(1.0f);
+    // 1. Get Transform from the Owner GameObject (cached, only rebuilt when it moved)
     if (owner) {
-        model = glm::translate(model, owner->position);
-        // Basic rotation logic (could be improved with Quaternions)
-        model = glm::rotate(model, glm::radians(owner->rotation.x), glm::vec3(1, 0, 0));
-        model = glm::rotate(model, glm::radians(owner->rotation.y), glm::vec3(0, 1, 0));
-        model = glm::rotate(model, glm::radians(owner->rotation.z), glm::vec3(0, 0, 1));
-        model = glm::scale(model, owner->scale);
-    }
-
-    shader.setMat4("model", model);
-    
-    // recalculate normal matrix
-    glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(model)));
-    shader.setMat3("normalMatrix", normalMatrix);
-
-    // 2. Draw all submeshes
-    for (unsigned int i = 0; i < meshes.size(); i++) {
-        glBindVertexArray(meshes[i].VAO);
-        glDrawElements(GL_TRIANGLES, meshes[i].indexCount, GL_UNSIGNED_INT, 0);
+        const Transform& transform = owner->GetTransform();
+        shader.setMat4("model", transform.GetWorldMatrix());
+        shader.setMat3("normalMatrix", transform.GetNormalMatrix());
+    } else {
+        shader.setMat4("model", glm::mat4(1.0f));
+        shader.setMat3("normalMatrix", glm::mat3(1.0f));
+    }
+
+    // Skinned models read their bone matrices from the shared palette buffer
+    if (model->skeleton && owner) {
+        if (Animator* animator = owner->GetComponent<Animator>()) {
+            animator->BindPalette(shader);
+        }
+    }
+
+    // 2. Draw all submeshes (packed diffuse maps share one array bind)
+    const TextureArray* boundArray = nullptr;
+    for (unsigned int i = 0; i < model->meshes.size(); i++) {
+        if (model->meshes[i].materialIndex < model->materials.size()) {
+            model->materials[model->meshes[i].materialIndex].Bind(shader, &boundArray);
+        }
+        glBindVertexArray(model->meshes[i].VAO);
+        glDrawElements(GL_TRIANGLES, model->meshes[i].indexCount, GL_UNSIGNED_INT, 0);
         glBindVertexArray(0);
     }
 }
 
+void MeshRenderer::SetShader(Shader* shader, std::shared_ptr<Texture> baseTexture, Shader* skinnedShader) {
+    // Copies made before keep the old set
+    renderMaterials.reset();
+    if (!renderer || !shader) return;
+
+    auto registerFor = [&](Shader* target, std::vector<MaterialHandle>& handles) {
+        for (const Material& material : model->materials) {
+            handles.push_back(renderer->AddMaterial(target, &material, baseTexture));
+        }
+        handles.push_back(renderer->AddMaterial(target, nullptr, baseTexture));
+        return renderer->GetMaterial(handles.back())->shaderId;
+    };
+
+    auto registered = std::make_shared<RenderMaterials>();
+    registered->renderer = renderer;
+    registered->shaderId = registerFor(shader, registered->handles);
+    const bool hasSkinned = std::any_of(model->meshes.begin(), model->meshes.end(),
+                                        [](const SubMesh& mesh) { return mesh.skinned; });
+    if (skinnedShader && hasSkinned) {
+        registered->skinnedShaderId = registerFor(skinnedShader, registered->skinnedHandles);
+    }
+    renderMaterials = std::move(registered);
+}
+
+size_t MeshRenderer::GetPacketCount() const {
+    if (!renderMaterials || (owner && !owner->GetHandle().IsValid())) return 0;
+    return model->meshes.size();
+}
+
+void MeshRenderer::ExtractPackets(RenderPacket* out, const RenderView& view) const {
+    const glm::mat4 world = owner ? owner->GetTransform().GetWorldMatrix() : glm::mat4(1.0f);
+    const glm::mat3 normal = owner ? owner->GetTransform().GetNormalMatrix() : glm::mat3(1.0f);
+    // Spheres grow with the largest axis scale
+    const float scale = std::sqrt(std::max({ glm::dot(world[0], world[0]), glm::dot(world[1], world[1]),
+                                             glm::dot(world[2], world[2]) }));
+
+    // Skinned submeshes only go through the skinned shader with a palette to read
+    uint32_t animation = AnimationSystem::kInvalidInstance;
+    if (model->skeleton && owner && !renderMaterials->skinnedHandles.empty()) {
+        if (const Animator* animator = owner->GetComponent<Animator>()) animation = animator->GetInstance();
+    }
+
+    for (size_t i = 0; i < model->meshes.size(); i++) {
+        const SubMesh& mesh = model->meshes[i];
+        const bool skinned = mesh.skinned && animation != AnimationSystem::kInvalidInstance;
+        const std::vector<MaterialHandle>& materialHandles = skinned ? renderMaterials->skinnedHandles : renderMaterials->handles;
+        const uint32_t shaderId = skinned ? renderMaterials->skinnedShaderId : renderMaterials->shaderId;
+        const MaterialHandle material = materialHandles[std::min<size_t>(mesh.materialIndex, model->materials.size())];
+        const glm::vec3 center = glm::vec3(world * glm::vec4(glm::vec3(mesh.bounds), 1.0f));
+
+        RenderPacket& packet = out[i];
+        packet.world = world;
+        packet.normal = normal;
+        packet.bounds = glm::vec4(center, mesh.bounds.w * scale);
+        packet.sortKey = RenderQueue::MakeSortKey(shaderId, material.index, glm::length(center - view.position));
+        packet.mesh = mesh.handle;
+        packet.material = material;
+        packet.animation = skinned ? animation : AnimationSystem::kInvalidInstance;
+    }
+}
+
 void MeshRenderer::LoadModel(const std::string& path) {
     Assimp::Importer importer;
     // Triangulate: Ensure all faces are triangles (GL_TRIANGLES)
     // FlipUVs: OpenGL expects origin at bottom-left, images often top-left
+    // No JoinIdenticalVertices: our own weld below is tolerance based and runs per submesh in parallel
     const aiScene* scene = importer.ReadFile(path, 
         aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenSmoothNormals);
 
@@ -56,24 +206,62 @@ void MeshRenderer::LoadModel(const std::string& path) {
     // Save directory for loading textures relative to the model later
     directory = path.substr(0, path.find_last_of('/'));
 
-    ProcessNode(scene->mRootNode, scene);
+    LoadMaterials(scene);
+    LoadAnimations(scene);
+
+    std::vector<aiMesh*> sceneMeshes;
+    ProcessNode(scene->mRootNode, scene, sceneMeshes);
+
+    // Build + weld every submesh on worker threads (no GL calls in here)
+    std::vector<MeshData> meshData(sceneMeshes.size());
+    ParallelFor(sceneMeshes.size(), [&](size_t i) {
+        meshData[i] = ProcessMesh(sceneMeshes[i], scene);
+    });
+
+    // GL objects must be created on the thread that owns the context
+    WeldStats& weld = model->loadStats.weld;
+    for (const auto& data : meshData) {
+        UploadMesh(data);
+        weld.verticesBefore += data.weld.verticesBefore;
+        weld.verticesAfter += data.weld.verticesAfter;
+    }
 }
 
-void MeshRenderer::ProcessNode(aiNode* node, const aiScene* scene) {
-    // Process all meshes in current node
+void MeshRenderer::ProcessNode(aiNode* node, const aiScene* scene, std::vector<aiMesh*>& outMeshes) {
+    // Collect all meshes in current node
     for (unsigned int i = 0; i < node->mNumMeshes; i++) {
-        aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-        ProcessMesh(mesh, scene);
+        outMeshes.push_back(scene->mMeshes[node->mMeshes[i]]);
     }
     // Process children
     for (unsigned int i = 0; i < node->mNumChildren; i++) {
-        ProcessNode(node->mChildren[i], scene);
+        ProcessNode(node->mChildren[i], scene, outMeshes);
     }
 }
 
-void MeshRenderer::ProcessMesh(aiMesh* mesh, const aiScene* scene) {
-    std::vector<float> vertices; 
-    std::vector<unsigned int> indices;
+MeshData MeshRenderer::ProcessMesh(aiMesh* mesh, const aiScene* scene) const {
+    MeshData data;
+    std::vector<float>& vertices = data.vertices;
+    std::vector<unsigned int>& indices = data.indices;
+
+    const bool skinned = model->skeleton && mesh->HasBones();
+    data.floatsPerVertex = skinned ? kSkinnedVertexFloats : kWeldBaseFloats;
+    vertices.reserve(mesh->mNumVertices * data.floatsPerVertex);
+    indices.reserve(mesh->mNumFaces * 3);
+
+    // Gather bone influences per vertex (palette index + weight)
+    std::vector<std::vector<std::pair<int, float>>> influences;
+    if (skinned) {
+        influences.resize(mesh->mNumVertices);
+        for (unsigned int b = 0; b < mesh->mNumBones; b++) {
+            const aiBone* bone = mesh->mBones[b];
+            const int paletteIndex = model->skeleton->FindBone(bone->mName.C_Str());
+            if (paletteIndex < 0) continue;
+            for (unsigned int w = 0; w < bone->mNumWeights; w++) {
+                const aiVertexWeight& weight = bone->mWeights[w];
+                influences[weight.mVertexId].push_back({ paletteIndex, weight.mWeight });
+            }
+        }
+    }
 
     // 1. Process Vertices
     for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
@@ -98,18 +286,67 @@ void MeshRenderer::ProcessMesh(aiMesh* mesh, const aiScene* scene) {
         } else {
             vertices.push_back(0.0f); vertices.push_back(0.0f);
         }
+
+        // Skin: 4 x uint8 bone index + 4 x unorm8 weight, stored bitwise in two floats
+        if (skinned) {
+            std::vector<int> bones;
+            std::vector<float> weights;
+            for (const auto& [bone, weight] : influences[i]) {
+                bones.push_back(bone);
+                weights.push_back(weight);
+            }
+            PackedSkinWeights packed = PackSkinWeights(bones.data(), weights.data(), bones.size());
+            float skinFloats[2];
+            std::memcpy(skinFloats, &packed, sizeof(packed));
+            vertices.push_back(skinFloats[0]);
+            vertices.push_back(skinFloats[1]);
+        }
     }
 
     // 2. Process Indices
     for (unsigned int i = 0; i < mesh->mNumFaces; i++) {
-        aiFace face = mesh->mFaces[i];
+        const aiFace& face = mesh->mFaces[i];
         for (unsigned int j = 0; j < face.mNumIndices; j++)
             indices.push_back(face.mIndices[j]);
     }
 
-    // 3. Create Buffers (VAO/VBO/EBO)
+    data.materialIndex = mesh->mMaterialIndex;
+
+    // Bounding sphere around the box of the positions (bind pose for skinned meshes)
+    if (mesh->mNumVertices > 0) {
+        glm::vec3 lo(mesh->mVertices[0].x, mesh->mVertices[0].y, mesh->mVertices[0].z);
+        glm::vec3 hi = lo;
+        for (unsigned int i = 1; i < mesh->mNumVertices; i++) {
+            const glm::vec3 p(mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z);
+            lo = glm::min(lo, p);
+            hi = glm::max(hi, p);
+        }
+        const glm::vec3 center = (lo + hi) * 0.5f;
+        float radius = 0.0f;
+        for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
+            const glm::vec3 p(mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z);
+            radius = std::max(radius, glm::length(p - center));
+        }
+        data.bounds = glm::vec4(center, radius);
+    }
+
+    // 3. Weld duplicated vertices and remap the indices
+    // (skin data past the uv is compared bit-exactly)
+    data.weld = WeldVertices(vertices, data.floatsPerVertex, indices, weldSettings);
+    return data;
+}
+
+void MeshRenderer::UploadMesh(const MeshData& data) {
+    const std::vector<float>& vertices = data.vertices;
+    const std::vector<unsigned int>& indices = data.indices;
+    if (vertices.empty() || indices.empty()) return;
+
+    // Create Buffers (VAO/VBO/EBO)
     SubMesh subMesh;
-    subMesh.indexCount = indices.size();
+    subMesh.indexCount = static_cast<unsigned int>(indices.size());
+    subMesh.materialIndex = data.materialIndex;
+    subMesh.skinned = data.floatsPerVertex == kSkinnedVertexFloats;
+    subMesh.bounds = data.bounds;
 
     glGenVertexArrays(1, &subMesh.VAO);
     glGenBuffers(1, &subMesh.VBO);
@@ -123,8 +360,8 @@ void MeshRenderer::ProcessMesh(aiMesh* mesh, const aiScene* scene) {
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, subMesh.EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
 
-    // Stride = 8 floats (3 pos + 3 normal + 2 uv)
-    int stride = 8 * sizeof(float);
+    // Stride = 8 floats (3 pos + 3 normal + 2 uv), +8 bytes of skin data for skinned meshes
+    int stride = static_cast<int>(data.floatsPerVertex * sizeof(float));
 
     // Position (Loc 0)
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
@@ -138,8 +375,163 @@ void MeshRenderer::ProcessMesh(aiMesh* mesh, const aiScene* scene) {
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(6 * sizeof(float)));
     glEnableVertexAttribArray(2);
 
+    if (subMesh.skinned) {
+        // Bone indices (Loc 3) as integers, weights (Loc 4) as normalized bytes
+        glVertexAttribIPointer(3, 4, GL_UNSIGNED_BYTE, stride, (void*)(8 * sizeof(float)));
+        glEnableVertexAttribArray(3);
+        glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void*)(8 * sizeof(float) + 4));
+        glEnableVertexAttribArray(4);
+    }
+
     glBindVertexArray(0);
 
+    if (renderer) subMesh.handle = renderer->AddMesh(RenderMesh{ subMesh.VAO, subMesh.indexCount, subMesh.bounds });
+
     // Store the mesh
-    meshes.push_back(subMesh);
+    model->meshes.push_back(subMesh);
+}
+
+void MeshRenderer::LoadMaterials(const aiScene* scene) {
+    std::vector<TextureSource> sources;
+    std::unordered_map<uint64_t, size_t> embeddedByHash;
+    std::unordered_map<std::string, size_t> filesByPath;
+
+    // Returns an index into sources, or -1 when the material has no texture of these types
+    auto findSource = [&](const aiMaterial* material, std::initializer_list<aiTextureType> types) -> int {
+        for (aiTextureType type : types) {
+            aiString path;
+            if (material->GetTextureCount(type) == 0 ||
+                material->GetTexture(type, 0, &path) != aiReturn_SUCCESS) {
+                continue;
+            }
+
+            // Embedded ("*0" in glTF/glb): identical blobs are shared by content hash
+            if (const aiTexture* embedded = scene->GetEmbeddedTexture(path.C_Str())) {
+                uint64_t hash = HashBytes(embedded->pcData, EmbeddedByteSize(embedded));
+                auto [it, inserted] = embeddedByHash.try_emplace(hash, sources.size());
+                if (inserted) {
+                    sources.emplace_back();
+                    sources.back().embedded = embedded;
+                    sources.back().name = directory + '/' + path.C_Str();
+                }
+                return static_cast<int>(it->second);
+            }
+
+            // External file, relative to the model
+            std::string fullPath = directory + '/' + path.C_Str();
+            auto [it, inserted] = filesByPath.try_emplace(fullPath, sources.size());
+            if (inserted) {
+                sources.emplace_back();
+                sources.back().filePath = fullPath;
+                sources.back().name = fullPath;
+            }
+            return static_cast<int>(it->second);
+        }
+        return -1;
+    };
+
+    struct MaterialRefs {
+        int diffuse, specular, normal;
+    };
+    std::vector<MaterialRefs> refs(scene->mNumMaterials);
+    model->materials.resize(scene->mNumMaterials);
+
+    for (unsigned int i = 0; i < scene->mNumMaterials; i++) {
+        const aiMaterial* material = scene->mMaterials[i];
+        model->materials[i].name = material->GetName().C_Str();
+        refs[i].diffuse = findSource(material, { aiTextureType_BASE_COLOR, aiTextureType_DIFFUSE });
+        refs[i].specular = findSource(material, { aiTextureType_SPECULAR });
+        refs[i].normal = findSource(material, { aiTextureType_NORMALS });
+    }
+
+    // Atlased maps only work for UVs inside 0..1, so find the materials that tile
+    std::vector<bool> materialTiles(scene->mNumMaterials, false);
+    for (unsigned int m = 0; m < scene->mNumMeshes; m++) {
+        const aiMesh* mesh = scene->mMeshes[m];
+        if (!mesh->mTextureCoords[0] || mesh->mMaterialIndex >= scene->mNumMaterials) continue;
+        for (unsigned int v = 0; v < mesh->mNumVertices && !materialTiles[mesh->mMaterialIndex]; v++) {
+            const aiVector3D& uv = mesh->mTextureCoords[0][v];
+            if (uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f) materialTiles[mesh->mMaterialIndex] = true;
+        }
+    }
+
+    for (size_t i = 0; i < refs.size(); i++) {
+        const MaterialRefs& ref = refs[i];
+        if (ref.diffuse >= 0) {
+            sources[ref.diffuse].color = true;
+            if (materialTiles[i]) sources[ref.diffuse].tiled = true;
+        }
+        if (ref.specular >= 0) sources[ref.specular].dataMap = true;
+        if (ref.normal >= 0) sources[ref.normal].dataMap = true;
+    }
+
+    // 1. Decode every unique image and build its mip chain on worker threads
+    //    (embedded ones straight from memory)
+    ParallelFor(sources.size(), [&](size_t i) {
+        TextureSource& source = sources[i];
+        source.image = source.embedded ? DecodeEmbedded(source.embedded)
+                                       : LoadImageFromFile(source.filePath.c_str(), true);
+        MipSettings mipSettings;
+        mipSettings.srgb = source.color;
+        source.mips = GenerateMipChain(source.image, mipSettings);
+    });
+
+    // 2. With several diffuse maps, pack them into shared arrays/atlases so every submesh
+    //    draws under one bind (layer + uv transform per material)
+    std::vector<int> packedIndex(sources.size(), -1);
+    size_t packable = 0;
+    for (const auto& source : sources) {
+        if (source.color && !source.dataMap) packable++;
+    }
+    std::vector<TextureArrayBinding> packed;
+    if (packable > 1) {
+        TextureArrayBuilder builder;
+        for (size_t i = 0; i < sources.size(); i++) {
+            if (!sources[i].color || sources[i].dataMap) continue;
+            packedIndex[i] = static_cast<int>(builder.Add(std::move(sources[i].image), std::move(sources[i].mips),
+                                                          !sources[i].tiled));
+        }
+        packed = builder.Build();
+        model->loadStats.packing = builder.GetStats();
+    }
+
+    // 3. Upload the rest on the GL thread through the cache (shares pixels already loaded by
+    //    other models), then drop the CPU copy
+    auto textureCache = ServiceLocator::Get().GetService<TextureCache>();
+    for (size_t i = 0; i < sources.size(); i++) {
+        TextureSource& source = sources[i];
+        if (packedIndex[i] < 0) {
+            source.texture = textureCache->FromImage(source.image, source.name, source.mips);
+        }
+        source.image = Image{};
+        source.mips.clear();
+    }
+
+    auto resolve = [&](int index) -> std::shared_ptr<Texture> {
+        return index >= 0 ? sources[index].texture : nullptr;
+    };
+    for (size_t i = 0; i < model->materials.size(); i++) {
+        const int diffuse = refs[i].diffuse;
+        if (diffuse >= 0 && packedIndex[diffuse] >= 0) {
+            const TextureArrayBinding& binding = packed[packedIndex[diffuse]];
+            model->materials[i].diffuseArray = binding.array;
+            model->materials[i].diffuseLayer = binding.layer;
+            model->materials[i].uvTransform = binding.uvTransform;
+        }
+        model->materials[i].diffuse = resolve(diffuse);
+        model->materials[i].specular = resolve(refs[i].specular);
+        model->materials[i].normal = resolve(refs[i].normal);
+    }
+    model->loadStats.uniqueTextures = sources.size();
+}
+
+void MeshRenderer::LoadAnimations(const aiScene* scene) {
+    model->skeleton = ImportSkeleton(scene);
+    if (!model->skeleton) return;
+
+    // Resampling + curve fitting is the slow part, so compress clips in parallel
+    model->animations.resize(scene->mNumAnimations);
+    ParallelFor(model->animations.size(), [&](size_t i) {
+        model->animations[i] = ImportAnimationClip(scene->mAnimations[i], *model->skeleton);
+    });
 }
\ No newline at end of file
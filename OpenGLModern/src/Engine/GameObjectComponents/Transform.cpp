@@ -0,0 +1,228 @@
+#include <Engine/GameObjectComponents/Transform.hpp>
+#include <Engine/Utils/SimdMath.hpp>
+#include <algorithm>
+
+namespace {
+    float SafeReciprocal(float v) {
+        return v != 0.0f ? 1.0f / v : 0.0f;
+    }
+}
+
+Transform::~Transform() {
+    if (hierarchy) hierarchy->Unregister(this);
+    SetParent(nullptr);
+    // Orphans become roots where they are
+    for (Transform* child : children) {
+        child->parent = nullptr;
+        child->SetDepth(0);
+        child->MarkWorldDirty();
+    }
+}
+
+// --- Local space ---
+
+void Transform::SetLocalPosition(const glm::vec3& position) {
+    localPosition = position;
+    MarkLocalDirty();
+}
+
+void Transform::SetLocalRotation(const glm::quat& rotation) {
+    localRotation = glm::normalize(rotation);
+    MarkLocalDirty();
+}
+
+void Transform::SetLocalEulerAngles(const glm::vec3& degrees) {
+    // Same as rotate(X) * rotate(Y) * rotate(Z) on a matrix
+    const glm::quat x = glm::angleAxis(glm::radians(degrees.x), glm::vec3(1, 0, 0));
+    const glm::quat y = glm::angleAxis(glm::radians(degrees.y), glm::vec3(0, 1, 0));
+    const glm::quat z = glm::angleAxis(glm::radians(degrees.z), glm::vec3(0, 0, 1));
+    SetLocalRotation(x * y * z);
+}
+
+void Transform::SetLocalScale(const glm::vec3& scale) {
+    localScale = scale;
+    MarkLocalDirty();
+}
+
+// --- Hierarchy ---
+
+void Transform::SetParent(Transform* newParent, bool keepWorld) {
+    if (newParent == parent || newParent == this) return;
+    // Refuse cycles: newParent can't be one of our descendants
+    for (Transform* ancestor = newParent; ancestor; ancestor = ancestor->parent) {
+        if (ancestor == this) return;
+    }
+
+    glm::mat4 world{ 1.0f };
+    if (keepWorld) world = GetWorldMatrix();
+
+    if (parent) {
+        auto& siblings = parent->children;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+    }
+    parent = newParent;
+    if (parent) parent->children.push_back(this);
+    SetDepth(parent ? parent->depth + 1 : 0);
+
+    if (keepWorld) {
+        // local = inverse(parentWorld) * world, split back into TRS (shear from non-uniform parents is lost)
+        const glm::mat4 local = parent ? glm::inverse(parent->GetWorldMatrix()) * world : world;
+        localPosition = glm::vec3(local[3]);
+        localScale = glm::vec3(glm::length(glm::vec3(local[0])), glm::length(glm::vec3(local[1])),
+                               glm::length(glm::vec3(local[2])));
+        const glm::mat3 rotation(glm::vec3(local[0]) / localScale.x, glm::vec3(local[1]) / localScale.y,
+                                 glm::vec3(local[2]) / localScale.z);
+        localRotation = glm::normalize(glm::quat_cast(rotation));
+        MarkLocalDirty();
+    } else {
+        MarkWorldDirty();
+    }
+}
+
+void Transform::SetDepth(int newDepth) {
+    if (depth != newDepth && hierarchy) hierarchy->orderDirty = true;
+    depth = newDepth;
+    for (Transform* child : children) child->SetDepth(newDepth + 1);
+}
+
+// --- Dirty flags ---
+
+void Transform::MarkLocalDirty() {
+    localDirty = true;
+    MarkWorldDirty();
+}
+
+void Transform::MarkWorldDirty() {
+    // A dirty transform's subtree is always dirty too, so there's nothing left to do below it
+    if (worldDirty) return;
+    worldDirty = true;
+    normalDirty = true;
+    for (Transform* child : children) child->MarkWorldDirty();
+}
+
+// --- Cached matrices ---
+
+const glm::mat4& Transform::GetLocalMatrix() const {
+    if (localDirty) {
+        // T * R * S without the three separate matrix products; normal = R * inverse(S)
+        const glm::mat3 rotation = glm::mat3_cast(localRotation);
+        localMatrix = glm::mat4(
+            glm::vec4(rotation[0] * localScale.x, 0.0f),
+            glm::vec4(rotation[1] * localScale.y, 0.0f),
+            glm::vec4(rotation[2] * localScale.z, 0.0f),
+            glm::vec4(localPosition, 1.0f));
+        localNormal = glm::mat3(rotation[0] * SafeReciprocal(localScale.x), rotation[1] * SafeReciprocal(localScale.y),
+                                rotation[2] * SafeReciprocal(localScale.z));
+        localDirty = false;
+    }
+    return localMatrix;
+}
+
+const glm::mat4& Transform::GetWorldMatrix() const {
+    if (worldDirty) {
+        // Walks up only as far as the first clean ancestor
+        if (parent) parent->GetWorldMatrix();
+        RebuildWorld();
+    }
+    return worldMatrix;
+}
+
+void Transform::RebuildWorld() const {
+    if (parent) {
+        simd::Mat4Mul(&parent->worldMatrix[0][0], &GetLocalMatrix()[0][0], &worldMatrix[0][0]);
+    } else {
+        worldMatrix = GetLocalMatrix();
+    }
+    worldDirty = false;
+}
+
+const glm::mat3& Transform::GetNormalMatrix() const {
+    if (normalDirty) {
+        // inverse(A * B)^T = inverse(A)^T * inverse(B)^T, so the normal matrices chain like the world ones
+        GetLocalMatrix();
+        normalMatrix = parent ? parent->GetNormalMatrix() * localNormal : localNormal;
+        normalDirty = false;
+    }
+    return normalMatrix;
+}
+
+// --- Hierarchy pass ---
+
+TransformHierarchy::~TransformHierarchy() {
+    for (Transform* transform : ordered) {
+        if (transform) transform->hierarchy = nullptr;
+    }
+}
+
+void TransformHierarchy::Register(Transform* transform) {
+    if (transform->hierarchy) return;
+    transform->hierarchy = this;
+    transform->hierarchyIndex = static_cast<int32_t>(ordered.size());
+    ordered.push_back(transform);
+    stats.transforms++;
+    // Appending a root keeps the order valid; anything deeper needs a re-sort
+    if (transform->depth > 0) orderDirty = true;
+}
+
+void TransformHierarchy::Unregister(Transform* transform) {
+    if (transform->hierarchy != this) return;
+    // Leave a hole instead of shifting everything; Update compacts
+    ordered[transform->hierarchyIndex] = nullptr;
+    transform->hierarchy = nullptr;
+    transform->hierarchyIndex = -1;
+    holes++;
+    stats.transforms--;
+}
+
+void TransformHierarchy::Sort() {
+    // Stable: siblings keep registration order, so results don't depend on sort internals
+    std::stable_sort(ordered.begin(), ordered.end(), [](const Transform* a, const Transform* b) {
+        return a->depth < b->depth;
+    });
+}
+
+void TransformHierarchy::Update() {
+    // 1. Drop holes left by Unregister
+    if (holes > 0) {
+        ordered.erase(std::remove(ordered.begin(), ordered.end(), nullptr), ordered.end());
+        holes = 0;
+        orderDirty = true;   // indices changed
+    }
+
+    // 2. Restore depth order after reparenting
+    if (orderDirty) {
+        Sort();
+        for (size_t i = 0; i < ordered.size(); i++) ordered[i]->hierarchyIndex = static_cast<int32_t>(i);
+        orderDirty = false;
+    }
+
+    // 3. Local matrices of everything that moved, in one SIMD batch
+    dirty.clear();
+    batch.Clear();
+    for (Transform* transform : ordered) {
+        if (!transform->worldDirty) continue;
+        dirty.push_back(transform);
+        if (transform->localDirty) {
+            batch.Add(transform->localPosition, transform->localRotation, transform->localScale);
+        }
+    }
+    localModels.resize(batch.Size());
+    localNormals.resize(batch.Size());
+    ComputeTrsMatrices(batch, localModels.data(), localNormals.data());
+
+    // 4. One forward pass: a parent always comes before its children, so it's already clean
+    size_t next = 0;
+    for (Transform* transform : dirty) {
+        if (transform->localDirty) {
+            transform->localMatrix = localModels[next];
+            transform->localNormal = localNormals[next];
+            transform->localDirty = false;
+            next++;
+        }
+        transform->GetWorldMatrix();
+        transform->normalMatrix = transform->parent
+            ? transform->parent->GetNormalMatrix() * transform->localNormal : transform->localNormal;
+        transform->normalDirty = false;
+    }
+    stats.rebuilt = dirty.size();
+}
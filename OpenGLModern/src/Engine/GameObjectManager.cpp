@@ -1,27 +1,287 @@
 #include <Engine/Managers/GameObjectManager.hpp>
 #include <Engine/GameObject.hpp>
+#include <Engine/Jobs/JobSystem.hpp>
+#include <functional>
+#include <iostream>
+
+GameObjectManager::~GameObjectManager() {
+    // Owned objects first, while everything they unregister from still exists
+    while (!owned.empty()) {
+        owned.pop_back();
+    }
+    // Objects owned elsewhere outlive us: their destructors must not call back
+    for (GameObject* obj : objects) {
+        if (!obj) continue;
+        obj->manager = nullptr;
+        obj->managerSlot = -1;
+    }
+}
 
 void GameObjectManager::Register(GameObject* obj) {
+    if (obj->managerSlot >= 0) return;
+    obj->manager = this;
+    obj->managerSlot = static_cast<int32_t>(objects.size());
     objects.push_back(obj);
+    lod.PushSlot();
+    obj->handle = objectHandles.Insert(obj);
+    for (auto& component : obj->components) {
+        RegisterComponent(component.get());
+    }
+    transforms.Register(&obj->GetTransform());
+}
+
+void GameObjectManager::RegisterComponent(Component* component) {
+    component->handle = componentHandles.Insert(component);
+
+    // Update is run by the objects themselves
+    for (size_t group = 0; group < kTickGroupCount; group++) {
+        if (group == static_cast<size_t>(TickGroup::Update)) continue;
+        if (!component->HasPhase(Component::PhaseBit(static_cast<TickGroup>(group)))) continue;
+        component->tickSlots[group] = static_cast<int32_t>(tickLists[group].size());
+        tickLists[group].push_back(component);
+    }
+}
+
+void GameObjectManager::UnregisterComponent(Component* component) {
+    componentHandles.Remove(component->handle);
+    component->handle = {};
+
+    for (size_t group = 0; group < kTickGroupCount; group++) {
+        const int32_t slot = component->tickSlots[group];
+        if (slot < 0) continue;
+        component->tickSlots[group] = -1;
+        if (updating) {
+            tickLists[group][slot] = nullptr;
+            pendingTickRemovals[group].push_back(static_cast<uint32_t>(slot));
+        } else {
+            RemoveTickSlot(group, static_cast<uint32_t>(slot));
+        }
+    }
 }
 
 void GameObjectManager::Unregister(GameObject* obj) {
-    objects.erase(
-        std::remove(objects.begin(), objects.end(), obj),
-        objects.end()
-    );
+    const int32_t slot = obj->managerSlot;
+    if (slot < 0 || static_cast<size_t>(slot) >= objects.size() || objects[slot] != obj) return;
+
+    obj->manager = nullptr;
+    obj->managerSlot = -1;
+    transforms.Unregister(&obj->GetTransform());
+
+    // Handles go stale right away, even if the slot is only compacted after the update pass
+    objectHandles.Remove(obj->handle);
+    obj->handle = {};
+    for (auto& component : obj->components) {
+        UnregisterComponent(component.get());
+    }
+
+    if (updating) {
+        // Don't move anything under the running loop: leave a hole
+        objects[slot] = nullptr;
+        pendingRemovals.push_back(static_cast<uint32_t>(slot));
+    } else {
+        RemoveSlot(static_cast<uint32_t>(slot));
+    }
+}
+
+void GameObjectManager::RemoveSlot(uint32_t slot) {
+    lod.RemoveSlot(slot);
+    GameObject* last = objects.back();
+    objects.pop_back();
+    if (slot < objects.size()) {
+        objects[slot] = last;
+        if (last) last->managerSlot = static_cast<int32_t>(slot);
+    }
+}
+
+void GameObjectManager::RemoveTickSlot(size_t group, uint32_t slot) {
+    std::vector<Component*>& list = tickLists[group];
+    Component* last = list.back();
+    list.pop_back();
+    if (slot < list.size()) {
+        list[slot] = last;
+        if (last) last->tickSlots[group] = static_cast<int32_t>(slot);
+    }
+}
+
+void GameObjectManager::FlushRemovals() {
+    // Highest slot first: everything above the slot being filled is already dealt with,
+    // so the last element moved into it is never another hole
+    std::sort(pendingRemovals.begin(), pendingRemovals.end(), std::greater<uint32_t>());
+    for (uint32_t slot : pendingRemovals) {
+        RemoveSlot(slot);
+    }
+    pendingRemovals.clear();
+
+    for (size_t group = 0; group < kTickGroupCount; group++) {
+        std::vector<uint32_t>& pending = pendingTickRemovals[group];
+        std::sort(pending.begin(), pending.end(), std::greater<uint32_t>());
+        for (uint32_t slot : pending) {
+            RemoveTickSlot(group, slot);
+        }
+        pending.clear();
+    }
 }
 
 void GameObjectManager::UpdateAll(double deltaTime) {
-    // Copy vector to handle objects being deleted during update
-    auto objectsCopy = objects;
+    // Objects and components created during the pass are appended past the counts and wait for
+    // the next frame; the ones destroyed during it leave a null behind
+    const size_t objectCount = objects.size();
+    std::array<size_t, kTickGroupCount> tickCounts;
+    for (size_t group = 0; group < kTickGroupCount; group++) tickCounts[group] = tickLists[group].size();
+
+    updating = true;
+    TickComponents(TickGroup::PreUpdate, tickCounts[size_t(TickGroup::PreUpdate)], deltaTime);
+    UpdateObjects(objectCount, deltaTime);
+    TickComponents(TickGroup::PostUpdate, tickCounts[size_t(TickGroup::PostUpdate)], deltaTime);
+    TickComponents(TickGroup::PreRender, tickCounts[size_t(TickGroup::PreRender)], deltaTime);
+    updating = false;
 
-    for (auto* obj : objectsCopy) {
-        // Verify object still exists in the live list
-        bool exists = std::find(objects.begin(), objects.end(), obj) != objects.end();
+    FlushRemovals();
+    FlushCommands();
+}
 
-        if (exists) {
-            obj->Update(deltaTime);
+void GameObjectManager::UpdateObjects(size_t count, double deltaTime) {
+    // Per object delta time (< 0 = skip this frame) when throttled
+    const std::vector<double>* deltas = nullptr;
+    if (lod.IsEnabled()) {
+        lod.BeginFrame(objects, count, deltaTime);
+        deltas = &lod.GetDeltas();
+    }
+
+    JobSystem* jobs = parallelUpdate ? ServiceLocator::TryGetServicePtr<JobSystem>() : nullptr;
+    if (jobs) {
+        scheduler.Run(objects, count, deltaTime, *jobs, deltas);
+    } else if (deltas) {
+        for (size_t i = 0; i < count; i++) {
+            GameObject* obj = objects[i];
+            if (obj && (*deltas)[i] >= 0.0) {
+                obj->Update((*deltas)[i]);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            if (GameObject* obj = objects[i]) {
+                obj->Update(deltaTime);
+            }
         }
     }
+}
+
+void GameObjectManager::TickComponents(TickGroup group, size_t count, double deltaTime) {
+    void (Component::*hook)(double) = nullptr;
+    switch (group) {
+    case TickGroup::PreUpdate: hook = &Component::PreUpdate; break;
+    case TickGroup::PostUpdate: hook = &Component::PostUpdate; break;
+    case TickGroup::PreRender: hook = &Component::PreRender; break;
+    case TickGroup::Update: return;
+    }
+
+    // Re-read every iteration: a hook may destroy (null) or create (append) components
+    const std::vector<Component*>& list = tickLists[static_cast<size_t>(group)];
+    for (size_t i = 0; i < count; i++) {
+        if (Component* component = list[i]) {
+            (component->*hook)(deltaTime);
+        }
+    }
+}
+
+void GameObjectManager::FlushCommands() {
+    commands.Playback(*this);
+}
+
+GameObject* GameObjectManager::Adopt(std::unique_ptr<GameObject> obj) {
+    if (!obj || obj->ownedSlot >= 0) return obj.release();
+    obj->ownedSlot = static_cast<int32_t>(owned.size());
+    owned.push_back(std::move(obj));
+    return owned.back().get();
+}
+
+std::vector<GameObject*> GameObjectManager::Instantiate(const GameObject& prototype, const TransformBatch& poses) {
+    std::vector<GameObject*> spawned;
+    const std::vector<std::unique_ptr<Component>>& sources = prototype.components;
+    for (const auto& source : sources) {
+        if (!Component::IsCopyable(source->typeId)) {
+            std::cerr << "ERROR::GAMEOBJECTMANAGER::INSTANTIATE::COMPONENT_NOT_COPYABLE "
+                      << Component::GetTypeName(source->typeId) << std::endl;
+            return spawned;
+        }
+    }
+    const size_t count = poses.Size();
+    if (count == 0) return spawned;
+
+    // 1. Reserve: pool storage for the objects and every component type, room in every list
+    ObjectPool::For<GameObject>().Reserve(count);
+    std::array<size_t, kTickGroupCount> ticked{};
+    for (const auto& source : sources) {
+        Component::TypeTable()[source->typeId].pool->Reserve(count);
+        for (size_t group = 0; group < kTickGroupCount; group++) {
+            if (group != static_cast<size_t>(TickGroup::Update) &&
+                source->HasPhase(Component::PhaseBit(static_cast<TickGroup>(group)))) ticked[group]++;
+        }
+    }
+    objects.reserve(objects.size() + count);
+    owned.reserve(owned.size() + count);
+    lod.Reserve(count);
+    transforms.Reserve(count);
+    objectHandles.Reserve(count);
+    componentHandles.Reserve(count * sources.size());
+    for (size_t group = 0; group < kTickGroupCount; group++) {
+        tickLists[group].reserve(tickLists[group].size() + count * ticked[group]);
+    }
+    spawned.reserve(count);
+
+    // Which component each of GetComponent's slots points at, as an index into the list
+    std::vector<size_t> slotSources(prototype.componentSlots.size());
+    for (size_t slot = 0; slot < slotSources.size(); slot++) {
+        slotSources[slot] = std::find_if(sources.begin(), sources.end(), [&](const std::unique_ptr<Component>& source) {
+            return source.get() == prototype.componentSlots[slot];
+        }) - sources.begin();
+    }
+
+    // 2. Copy and register
+    for (size_t i = 0; i < count; i++) {
+        GameObject* object = ObjectPool::New<GameObject>(GameObject::Unregistered{});
+        object->updateImportance = prototype.updateImportance;
+        object->boundingRadius = prototype.boundingRadius;
+
+        Transform& transform = object->GetTransform();
+        transform.SetLocalPosition(glm::vec3(poses.positionX[i], poses.positionY[i], poses.positionZ[i]));
+        transform.SetLocalRotation(glm::quat(poses.rotationW[i], poses.rotationX[i], poses.rotationY[i], poses.rotationZ[i]));
+        transform.SetLocalScale(glm::vec3(poses.scaleX[i], poses.scaleY[i], poses.scaleZ[i]));
+
+        object->components.reserve(sources.size());
+        for (const auto& source : sources) {
+            Component* copy = Component::TypeTable()[source->typeId].copy(*source);
+            copy->SetOwner(object);
+            copy->Start();
+            object->components.emplace_back(copy);
+            if (copy->HasPhase(Component::PhaseBit(TickGroup::Update))) object->updateComponents.push_back(copy);
+            if (copy->HasPhase(Component::kDrawPhase)) object->drawComponents.push_back(copy);
+        }
+        object->componentMask = prototype.componentMask;
+        object->componentSlots.resize(slotSources.size());
+        for (size_t slot = 0; slot < slotSources.size(); slot++) {
+            object->componentSlots[slot] = object->components[slotSources[slot]].get();
+        }
+
+        Register(object);
+        object->ownedSlot = static_cast<int32_t>(owned.size());
+        owned.emplace_back(object);
+        spawned.push_back(object);
+    }
+    return spawned;
+}
+
+bool GameObjectManager::DestroyOwned(GameObject* obj) {
+    const int32_t slot = obj->ownedSlot;
+    if (slot < 0 || static_cast<size_t>(slot) >= owned.size() || owned[slot].get() != obj) return false;
+
+    // Swap-and-pop; the destructor unregisters (deferred if an update pass is running)
+    std::unique_ptr<GameObject> doomed = std::move(owned[slot]);
+    if (static_cast<size_t>(slot) + 1 < owned.size()) {
+        owned[slot] = std::move(owned.back());
+        owned[slot]->ownedSlot = slot;
+    }
+    owned.pop_back();
+    return true;
 }
\ No newline at end of file
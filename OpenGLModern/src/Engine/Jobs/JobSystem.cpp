@@ -0,0 +1,299 @@
+#include <Engine/Jobs/JobSystem.hpp>
+#include <iostream>
+#include <cstdlib>
+
+namespace {
+    // Which pool (if any) the calling thread belongs to, and its queue there
+    struct ThreadSlot {
+        const JobSystem* system = nullptr;
+        int index = -1;
+    };
+    thread_local ThreadSlot tlsSlot;
+
+    // Idle rounds a worker spins (yielding) before it goes to sleep: jobs tend to arrive in bursts
+    constexpr int kIdleSpins = 64;
+
+    // Where a thief starts looking, different per thread so they don't all hit the same victim
+    uint32_t NextVictimSeed() {
+        thread_local uint32_t state = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+}
+
+JobSystem::JobSystem() {
+    Start(std::max(2u, std::thread::hardware_concurrency()) - 1);
+}
+
+JobSystem::JobSystem(unsigned int workerCount) {
+    Start(std::max(1u, workerCount));
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Whatever nobody waited for is dropped; the threads are gone, so the owner-only Pop is safe
+    for (auto& queue : queues) {
+        while (Job* job = queue->deque.Pop()) delete job;
+    }
+    for (Job* job : injection) delete job;
+    for (Job* job : mainThreadJobs) delete job;
+
+    if (tlsSlot.system == this) tlsSlot = {};
+}
+
+void JobSystem::Start(unsigned int workerCount) {
+    mainThread = std::this_thread::get_id();
+
+    // 1. Every queue exists before any worker can look for work
+    queues.reserve(workerCount + 1);
+    for (unsigned int i = 0; i <= workerCount; i++) {
+        queues.push_back(std::make_unique<ThreadQueue>());
+    }
+    tlsSlot = { this, 0 };
+
+    // 2. Workers
+    workers.reserve(workerCount);
+    for (unsigned int i = 1; i <= workerCount; i++) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this, static_cast<size_t>(i));
+    }
+}
+
+bool JobSystem::IsMainThread() const {
+    return std::this_thread::get_id() == mainThread;
+}
+
+int JobSystem::ThreadIndex() const {
+    return tlsSlot.system == this ? tlsSlot.index : -1;
+}
+
+JobSystem::Stats JobSystem::GetStats() const {
+    Stats stats;
+    for (const auto& queue : queues) {
+        stats.executed += queue->executed.load(std::memory_order_relaxed);
+        stats.stolen += queue->stolen.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+// --- Scheduling ---
+
+void JobSystem::Schedule(std::function<void()> fn, JobCounter* counter, JobAffinity affinity) {
+    Job* job = new Job();
+    job->fn = std::move(fn);
+    job->counter = counter;
+    job->affinity = affinity;
+    if (counter) counter->pending.fetch_add(1, std::memory_order_relaxed);
+    Enqueue(job);
+}
+
+void JobSystem::Schedule(std::function<void()> fn, std::initializer_list<JobCounter*> dependencies,
+    JobCounter* counter, JobAffinity affinity) {
+    ScheduleAfter(std::move(fn), dependencies.begin(), dependencies.size(), counter, affinity);
+}
+
+void JobSystem::Schedule(std::function<void()> fn, const std::vector<JobCounter*>& dependencies,
+    JobCounter* counter, JobAffinity affinity) {
+    ScheduleAfter(std::move(fn), dependencies.data(), dependencies.size(), counter, affinity);
+}
+
+void JobSystem::ScheduleAfter(std::function<void()> fn, JobCounter* const* dependencies, size_t dependencyCount,
+    JobCounter* counter, JobAffinity affinity) {
+    Job* job = new Job();
+    job->fn = std::move(fn);
+    job->counter = counter;
+    job->affinity = affinity;
+    if (counter) counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+    // One extra for ourselves, so the job can't be queued while we're still registering it
+    job->unmetDependencies.store(static_cast<uint32_t>(dependencyCount) + 1, std::memory_order_relaxed);
+    for (size_t i = 0; i < dependencyCount; i++) {
+        JobCounter* dependency = dependencies[i];
+        bool waiting = false;
+        if (dependency) {
+            std::lock_guard<std::mutex> lock(dependency->mutex);
+            waiting = dependency->pending.load(std::memory_order_acquire) > 0;
+            if (waiting) dependency->continuations.push_back(job);
+        }
+        if (!waiting) Release(job);
+    }
+    Release(job);
+}
+
+void JobSystem::Release(Job* job) {
+    if (job->unmetDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Enqueue(job);
+    }
+}
+
+void JobSystem::Enqueue(Job* job) {
+    if (job->affinity == JobAffinity::MainThread) {
+        std::lock_guard<std::mutex> lock(mainThreadMutex);
+        mainThreadJobs.push_back(job);
+        return;
+    }
+
+    // Counted before it's visible, so a worker deciding whether to sleep can't miss it
+    queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+
+    const int self = ThreadIndex();
+    if (self < 0 || !queues[self]->deque.Push(job)) {
+        std::lock_guard<std::mutex> lock(injectionMutex);
+        injection.push_back(job);
+        injectionSize.fetch_add(1, std::memory_order_release);
+    }
+
+    if (sleepers.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wake.notify_one();
+    }
+}
+
+// --- Execution ---
+
+JobSystem::Job* JobSystem::FindJob(int self) {
+    // 1. Own deque, newest first (its data is still in cache)
+    if (self >= 0) {
+        if (Job* job = queues[self]->deque.Pop()) {
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // 2. Jobs from outside the pool
+    if (injectionSize.load(std::memory_order_acquire) > 0) {
+        std::lock_guard<std::mutex> lock(injectionMutex);
+        if (!injection.empty()) {
+            Job* job = injection.front();
+            injection.pop_front();
+            injectionSize.fetch_sub(1, std::memory_order_relaxed);
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // 3. Steal the oldest job of some other thread
+    const size_t count = queues.size();
+    const size_t start = NextVictimSeed() % count;
+    for (size_t i = 0; i < count; i++) {
+        const size_t victim = (start + i) % count;
+        if (static_cast<int>(victim) == self) continue;
+        if (Job* job = queues[victim]->deque.Steal()) {
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            if (self >= 0) queues[self]->stolen.fetch_add(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::Execute(Job* job, int self) {
+    JobCounter* counter = job->counter;
+    {
+        // The job (and whatever its function captured) is gone before the counter says done
+        std::function<void()> fn = std::move(job->fn);
+        delete job;
+        fn();
+    }
+    if (self >= 0) queues[self]->executed.fetch_add(1, std::memory_order_relaxed);
+    if (counter) Finish(counter);
+}
+
+void JobSystem::Finish(JobCounter* counter) {
+    // Not the last job: a plain decrement, the counter's lock is only for the final one
+    int64_t pending = counter->pending.load(std::memory_order_relaxed);
+    while (pending > 1) {
+        if (counter->pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel)) return;
+    }
+
+    std::vector<Job*> ready;
+    {
+        std::lock_guard<std::mutex> lock(counter->mutex);
+        // Someone may have scheduled more work against it in the meantime
+        if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            ready.swap(counter->continuations);
+        }
+    }
+    // counter may already be destroyed by its waiter here
+    for (Job* job : ready) Release(job);
+}
+
+bool JobSystem::RunOneMainThreadJob() {
+    Job* job = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mainThreadMutex);
+        if (mainThreadJobs.empty()) return false;
+        job = mainThreadJobs.front();
+        mainThreadJobs.pop_front();
+    }
+    Execute(job, ThreadIndex());
+    return true;
+}
+
+bool JobSystem::RunOne() {
+    const int self = ThreadIndex();
+    if (IsMainThread() && RunOneMainThreadJob()) return true;
+
+    Job* job = FindJob(self);
+    if (!job) return false;
+    Execute(job, self);
+    return true;
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    while (!counter.IsDone()) {
+        if (!RunOne()) std::this_thread::yield();
+    }
+}
+
+void JobSystem::RunMainThreadJobs() {
+    if (!IsMainThread()) {
+        std::cerr << "ERROR::JOBSYSTEM::NOT_MAIN_THREAD RunMainThreadJobs called from a worker" << std::endl;
+        std::abort();
+    }
+
+    // Only what's queued now: a job that queues another one doesn't keep the frame waiting
+    std::deque<Job*> jobs;
+    {
+        std::lock_guard<std::mutex> lock(mainThreadMutex);
+        jobs.swap(mainThreadJobs);
+    }
+    for (Job* job : jobs) {
+        Execute(job, ThreadIndex());
+    }
+}
+
+void JobSystem::WorkerLoop(size_t index) {
+    tlsSlot = { this, static_cast<int>(index) };
+
+    while (true) {
+        bool ran = false;
+        for (int spin = 0; spin < kIdleSpins && !ran; spin++) {
+            ran = RunOne();
+            if (!ran) std::this_thread::yield();
+        }
+        if (ran) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        wake.wait(lock, [this] { return stopping || queuedJobs.load(std::memory_order_seq_cst) > 0; });
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+        if (stopping) return;
+    }
+}
+
+// --- JobCounter ---
+
+JobCounter::~JobCounter() {
+    // The last Finish may still be inside the lock after pending reached zero
+    std::lock_guard<std::mutex> lock(mutex);
+}
@@ -0,0 +1,95 @@
+#include <Engine/Managers/GameObjectCommandBuffer.hpp>
+#include <Engine/Managers/GameObjectManager.hpp>
+#include <Engine/GameObject.hpp>
+#include <iostream>
+
+namespace {
+    std::atomic<uint64_t> nextBufferId{ 1 };
+
+    // Last lane this thread recorded into; a miss costs one locked lookup
+    struct LaneCache {
+        uint64_t bufferId = 0;
+        void* lane = nullptr;
+    };
+    thread_local LaneCache laneCache;
+}
+
+GameObjectCommandBuffer::GameObjectCommandBuffer() : id(nextBufferId.fetch_add(1)) {}
+
+GameObjectCommandBuffer::~GameObjectCommandBuffer() = default;
+
+GameObjectCommandBuffer::Lane& GameObjectCommandBuffer::LocalLane() {
+    if (laneCache.bufferId == id) return *static_cast<Lane*>(laneCache.lane);
+
+    std::lock_guard<std::mutex> lock(laneMutex);
+    const std::thread::id thread = std::this_thread::get_id();
+    Lane* lane = nullptr;
+    for (const auto& existing : lanes) {
+        if (existing->thread == thread) {
+            lane = existing.get();
+            break;
+        }
+    }
+    if (!lane) {
+        lanes.push_back(std::make_unique<Lane>());
+        lane = lanes.back().get();
+        lane->thread = thread;
+    }
+    laneCache = { id, lane };
+    return *lane;
+}
+
+void GameObjectCommandBuffer::Spawn(std::function<std::unique_ptr<GameObject>()> factory) {
+    LocalLane().spawns.push_back(std::move(factory));
+}
+
+void GameObjectCommandBuffer::Destroy(GameObject* object) {
+    if (!object || object->destroyQueued.exchange(true)) return;
+    LocalLane().destroys.push_back(object);
+}
+
+size_t GameObjectCommandBuffer::GetPendingCount() const {
+    std::lock_guard<std::mutex> lock(laneMutex);
+    size_t count = 0;
+    for (const auto& lane : lanes) {
+        count += lane->commands.size() + lane->spawns.size() + lane->destroys.size();
+    }
+    return count;
+}
+
+void GameObjectCommandBuffer::Playback(GameObjectManager& manager) {
+    // Not locked while running commands: they may record (and register a lane) themselves
+    std::vector<Lane*> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(laneMutex);
+        snapshot.reserve(lanes.size());
+        for (const auto& lane : lanes) snapshot.push_back(lane.get());
+    }
+
+    // 1. Component changes, then spawns. Commands may record more commands: those wait for the
+    //    next playback (swap the lane's list out first so recording into it stays valid)
+    std::vector<std::function<void()>> commands;
+    std::vector<std::function<std::unique_ptr<GameObject>()>> spawns;
+    for (Lane* lane : snapshot) {
+        commands.swap(lane->commands);
+        for (auto& command : commands) command();
+        commands.clear();
+
+        spawns.swap(lane->spawns);
+        for (auto& spawn : spawns) manager.Adopt(spawn());
+        spawns.clear();
+    }
+
+    // 2. Destroys last, so everything above could still use the objects
+    std::vector<GameObject*> destroys;
+    for (Lane* lane : snapshot) {
+        destroys.swap(lane->destroys);
+        for (GameObject* object : destroys) {
+            if (!manager.DestroyOwned(object)) {
+                object->destroyQueued = false;
+                std::cerr << "ERROR::GAMEOBJECT::DESTROY_NOT_OWNED (only manager-owned objects can be destroyed by command)" << std::endl;
+            }
+        }
+        destroys.clear();
+    }
+}
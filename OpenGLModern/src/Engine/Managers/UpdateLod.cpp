@@ -0,0 +1,133 @@
+#include <Engine/Managers/UpdateLod.hpp>
+#include <Engine/GameObject.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+UpdateLod::UpdateLod() {
+    for (uint32_t level = 0; level < kMaxLevels; level++) {
+        phaseLoad[level].assign(size_t(1) << level, 0);
+    }
+}
+
+void UpdateLod::SetSettings(const UpdateLodSettings& newSettings) {
+    settings = newSettings;
+    settings.maxInterval = std::max(1u, settings.maxInterval);
+    settings.rebucketFrames = std::max(1u, settings.rebucketFrames);
+}
+
+void UpdateLod::SetViewer(const glm::vec3& position, const glm::mat4& viewProjection) {
+    viewerPosition = position;
+    frustum = Frustum::FromMatrix(viewProjection);
+    hasViewer = true;
+}
+
+void UpdateLod::PushSlot() {
+    // Every frame until the first evaluation
+    slots.push_back({});
+    phaseLoad[0][0]++;
+}
+
+void UpdateLod::RemoveSlot(uint32_t slot) {
+    Leave(slots[slot]);
+    slots[slot] = slots.back();
+    slots.pop_back();
+}
+
+uint8_t UpdateLod::MaxLevel() const {
+    return static_cast<uint8_t>(std::min<uint32_t>(kMaxLevels - 1, std::bit_width(settings.maxInterval) - 1));
+}
+
+uint8_t UpdateLod::ChooseLevel(const GameObject& object, bool& hidden) const {
+    hidden = false;
+    const float importance = object.GetUpdateImportance();
+    if (!hasViewer || std::isinf(importance)) return 0;
+    if (importance <= 0.0f) return MaxLevel();
+
+    const glm::vec3 position = object.GetTransform().GetWorldPosition();
+    const float distance = glm::length(position - viewerPosition) / importance;
+
+    // Interval 2 up to twice the full rate distance, 4 up to four times, ...
+    int level = 0;
+    if (distance > settings.fullRateDistance) {
+        level = static_cast<int>(std::ceil(std::log2(distance / std::max(settings.fullRateDistance, 1e-3f))));
+    }
+
+    hidden = !frustum.IntersectsSphere(position, object.GetBoundingRadius());
+    if (hidden) level = std::max(level, static_cast<int>(std::bit_width(std::max(1u, settings.hiddenInterval))) - 1);
+
+    return static_cast<uint8_t>(std::clamp(level, 0, static_cast<int>(MaxLevel())));
+}
+
+void UpdateLod::Assign(Slot& slot, uint8_t level) {
+    Leave(slot);
+
+    // Least loaded phase of the new bucket (lowest first on ties)
+    std::vector<uint32_t>& load = phaseLoad[level];
+    const auto phase = std::min_element(load.begin(), load.end());
+    (*phase)++;
+    slot.level = level;
+    slot.phase = static_cast<uint8_t>(phase - load.begin());
+}
+
+void UpdateLod::BeginFrame(const std::vector<GameObject*>& objects, size_t count, double deltaTime) {
+    // 1. Re-bucket this frame's slice (round robin over all objects)
+    if (count > 0) {
+        const size_t slice = (count + settings.rebucketFrames - 1) / settings.rebucketFrames;
+        for (size_t n = 0; n < slice; n++) {
+            const size_t i = rebucketCursor++ % count;
+            const GameObject* object = objects[i];
+            if (!object) continue;
+
+            Slot& slot = slots[i];
+            bool hidden = false;
+            const uint8_t level = ChooseLevel(*object, hidden);
+            slot.hidden = hidden;
+            if (level != slot.level) Assign(slot, level);
+        }
+    }
+
+    // 2. Who updates this frame, and with how much time
+    deltas.resize(count);
+    stats.updated = stats.skipped = stats.hidden = 0;
+    for (size_t i = 0; i < count; i++) {
+        Slot& slot = slots[i];
+        stats.hidden += slot.hidden;
+        slot.accumulated += deltaTime;
+        const uint64_t mask = (uint64_t(1) << slot.level) - 1;
+        if ((frame & mask) == slot.phase) {
+            deltas[i] = slot.accumulated;
+            slot.accumulated = 0.0;
+            stats.updated++;
+        } else {
+            deltas[i] = -1.0;
+            stats.skipped++;
+        }
+    }
+    frame++;
+
+    FinishStats();
+}
+
+void UpdateLod::FinishStats() {
+    for (uint32_t level = 0; level < kMaxLevels; level++) {
+        stats.buckets[level] = 0;
+        for (uint32_t members : phaseLoad[level]) stats.buckets[level] += members;
+    }
+
+    // Upcoming frames repeat with the longest interval in use
+    uint32_t longest = 0;
+    for (uint32_t level = 0; level < kMaxLevels; level++) {
+        if (stats.buckets[level]) longest = level;
+    }
+    stats.busiestFrame = 0;
+    stats.quietestFrame = ~size_t(0);
+    for (uint64_t f = 0; f < (uint64_t(1) << longest); f++) {
+        size_t load = 0;
+        for (uint32_t level = 0; level <= longest; level++) {
+            load += phaseLoad[level][(frame + f) & ((uint64_t(1) << level) - 1)];
+        }
+        stats.busiestFrame = std::max(stats.busiestFrame, load);
+        stats.quietestFrame = std::min(stats.quietestFrame, load);
+    }
+}
@@ -0,0 +1,227 @@
+#include <Engine/Managers/UpdateScheduler.hpp>
+#include <Engine/GameObject.hpp>
+#include <chrono>
+#include <bit>
+#include <typeinfo>
+
+namespace {
+    using Clock = std::chrono::high_resolution_clock;
+
+    int64_t ElapsedNs(Clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    }
+
+    double ToMs(int64_t ns) {
+        return static_cast<double>(ns) / 1e6;
+    }
+}
+
+void UpdateScheduler::Run(std::vector<GameObject*>& objects, size_t count, double deltaTime, JobSystem& jobs,
+    const std::vector<double>* objectDeltas) {
+    const auto start = Clock::now();
+    deltas = objectDeltas;
+    frameDelta = deltaTime;
+
+    stats.parallelObjects = stats.serialObjects = 0;
+    stats.runs = stats.objectOrderRuns = 0;
+    for (auto& ns : systemNs) ns.store(0, std::memory_order_relaxed);
+    systemInstances.fill(0);
+    objectOrderNs.store(0, std::memory_order_relaxed);
+    int64_t serialNs = 0;
+
+    // Slots are re-read every time: a serial update may destroy (null) or create (append) objects
+    size_t i = 0;
+    while (i < count) {
+        // 1. Gather the longest run of parallel objects starting here (one pass: check + collect).
+        //    Nothing in a run can create or destroy objects, so its slots stay put until it's run.
+        BeginRun();
+        size_t end = i;
+        size_t runObjects = 0;
+        for (; end < count; end++) {
+            const GameObject* object = objects[end];
+            if (!object || IsSkipped(end)) continue;
+            if (!IsParallel(object)) break;
+            Gather(object, DeltaAt(end));
+            runObjects++;
+        }
+
+        if (runObjects >= kMinParallelObjects) {
+            RunParallel(objects, i, end, jobs);
+            stats.parallelObjects += runObjects;
+            stats.runs++;
+            i = end;
+            continue;
+        }
+
+        // 2. A run too short to hand off, then the serial object that ended it: update in place
+        const size_t serialEnd = std::min(count, end + 1);
+        const auto serialStart = Clock::now();
+        for (; i < serialEnd; i++) {
+            GameObject* object = objects[i];
+            if (object && !IsSkipped(i)) {
+                object->Update(DeltaAt(i));
+                stats.serialObjects++;
+            }
+        }
+        serialNs += ElapsedNs(serialStart);
+    }
+
+    stats.serialMs = ToMs(serialNs);
+    FinishStats(ToMs(ElapsedNs(start)));
+    deltas = nullptr;
+}
+
+bool UpdateScheduler::IsParallel(const GameObject* object) const {
+    // Subclasses may override Update with anything
+    if (typeid(*object) != typeid(GameObject)) return false;
+    // Two components of one type could land in different chunks of their system
+    if (static_cast<size_t>(std::popcount(object->componentMask)) != object->components.size()) return false;
+
+    // Components without an Update aren't run at all, so they don't need to declare anything
+    const uint64_t transformBit = uint64_t(1) << Component::GetTypeId<Transform>();
+    bool touchesTransform = false;
+    for (const Component* component : object->updateComponents) {
+        const UpdateAccess& access = Component::GetUpdateAccess(component->GetTypeId());
+        if (!access.declared) return false;
+        touchesTransform |= ((access.reads | access.writes) & transformBit) != 0;
+    }
+
+    // Moving a transform dirties its children, reading one may rebuild from its parent
+    const Transform& transform = object->GetTransform();
+    return !touchesTransform || (!transform.GetParent() && transform.GetChildren().empty());
+}
+
+void UpdateScheduler::BeginRun() {
+    for (uint64_t bits = present; bits; bits &= bits - 1) {
+        instances[std::countr_zero(bits)].clear();
+        successors[std::countr_zero(bits)] = 0;
+    }
+    present = 0;
+}
+
+void UpdateScheduler::Gather(const GameObject* object, double deltaTime) {
+    const std::vector<Component*>& components = object->updateComponents;
+
+    // Reading a transform rebuilds its cached matrices. Whatever is dirty now gets rebuilt here, before
+    // any system runs; readers after a transform writer rebuild it again, so they're ordered like writers.
+    const uint64_t transformBit = uint64_t(1) << Component::GetTypeId<Transform>();
+    size_t firstWriter = components.size();
+    bool touchesTransform = false;
+    for (size_t a = 0; a < components.size(); a++) {
+        const UpdateAccess& access = Component::GetUpdateAccess(components[a]->GetTypeId());
+        touchesTransform |= ((access.reads | access.writes) & transformBit) != 0;
+        if (firstWriter == components.size() && (access.writes & transformBit)) firstWriter = a;
+    }
+    if (touchesTransform) {
+        object->GetTransform().GetWorldMatrix();
+        object->GetTransform().GetNormalMatrix();
+    }
+    auto accessAt = [&](size_t index) {
+        UpdateAccess access = Component::GetUpdateAccess(components[index]->GetTypeId());
+        if (index > firstWriter) access.writes |= access.reads & transformBit;
+        return access;
+    };
+
+    // Each system's instances in object order, and which systems some object needs in a given order
+    for (size_t a = 0; a < components.size(); a++) {
+        const Component::TypeId type = components[a]->GetTypeId();
+        instances[type].push_back({ components[a], deltaTime });
+        present |= uint64_t(1) << type;
+
+        const UpdateAccess access = accessAt(a);
+        for (size_t b = a + 1; b < components.size(); b++) {
+            if (access.ConflictsWith(accessAt(b))) {
+                successors[type] |= uint64_t(1) << components[b]->GetTypeId();
+            }
+        }
+    }
+}
+
+void UpdateScheduler::RunParallel(std::vector<GameObject*>& objects, size_t begin, size_t end, JobSystem& jobs) {
+    // 1. Topological order of the systems (lowest type id first among the ready ones)
+    std::array<int, Component::kMaxTypes> indegree{};
+    for (uint64_t bits = present; bits; bits &= bits - 1) {
+        for (uint64_t next = successors[std::countr_zero(bits)]; next; next &= next - 1) {
+            indegree[std::countr_zero(next)]++;
+        }
+    }
+
+    std::vector<Component::TypeId> order;
+    order.reserve(std::popcount(present));
+    uint64_t ready = 0;
+    for (uint64_t bits = present; bits; bits &= bits - 1) {
+        if (indegree[std::countr_zero(bits)] == 0) ready |= bits & (~bits + 1);
+    }
+    while (ready) {
+        const Component::TypeId type = static_cast<Component::TypeId>(std::countr_zero(ready));
+        ready &= ready - 1;
+        order.push_back(type);
+        for (uint64_t next = successors[type]; next; next &= next - 1) {
+            const int successor = std::countr_zero(next);
+            if (--indegree[successor] == 0) ready |= uint64_t(1) << successor;
+        }
+    }
+
+    if (order.size() != static_cast<size_t>(std::popcount(present))) {
+        // Objects disagree on which of two conflicting systems goes first
+        stats.objectOrderRuns++;
+        RunObjectOrder(objects, begin, end, jobs);
+        return;
+    }
+
+    // 2. One job per system, after the systems it depends on
+    std::vector<JobCounter*> dependencies;
+    for (Component::TypeId type : order) {
+        dependencies.clear();
+        for (Component::TypeId before : order) {
+            if (before == type) break;
+            if (successors[before] >> type & 1) dependencies.push_back(&counters[before]);
+        }
+        jobs.Schedule([this, type, &jobs] { RunSystem(type, jobs); }, dependencies, &counters[type]);
+    }
+    for (Component::TypeId type : order) {
+        jobs.Wait(counters[type]);
+    }
+}
+
+void UpdateScheduler::RunSystem(Component::TypeId type, JobSystem& jobs) {
+    const std::vector<Instance>& list = instances[type];
+    const size_t chunks = (list.size() + kInstancesPerChunk - 1) / kInstancesPerChunk;
+    jobs.ParallelFor(chunks, [&](size_t chunk) {
+        const auto start = Clock::now();
+        const size_t last = std::min(list.size(), (chunk + 1) * kInstancesPerChunk);
+        for (size_t i = chunk * kInstancesPerChunk; i < last; i++) {
+            list[i].component->Update(list[i].deltaTime);
+        }
+        systemNs[type].fetch_add(ElapsedNs(start), std::memory_order_relaxed);
+    });
+    systemInstances[type] += list.size();
+}
+
+void UpdateScheduler::RunObjectOrder(std::vector<GameObject*>& objects, size_t begin, size_t end, JobSystem& jobs) {
+    const size_t chunks = (end - begin + kMinParallelObjects - 1) / kMinParallelObjects;
+    jobs.ParallelFor(chunks, [&](size_t chunk) {
+        const auto start = Clock::now();
+        const size_t last = std::min(end, begin + (chunk + 1) * kMinParallelObjects);
+        for (size_t o = begin + chunk * kMinParallelObjects; o < last; o++) {
+            GameObject* object = objects[o];
+            if (object && !IsSkipped(o)) object->Update(DeltaAt(o));
+        }
+        objectOrderNs.fetch_add(ElapsedNs(start), std::memory_order_relaxed);
+    });
+}
+
+void UpdateScheduler::FinishStats(double wallMs) {
+    stats.systems.clear();
+    double cpuMs = stats.serialMs + ToMs(objectOrderNs.load(std::memory_order_relaxed));
+    for (Component::TypeId type = 0; type < Component::kMaxTypes; type++) {
+        if (systemInstances[type] == 0) continue;
+        const double ms = ToMs(systemNs[type].load(std::memory_order_relaxed));
+        stats.systems.push_back({ type, Component::GetTypeName(type), systemInstances[type], ms });
+        cpuMs += ms;
+    }
+
+    stats.wallMs = wallMs;
+    stats.cpuMs = cpuMs;
+    stats.parallelism = wallMs > 0.0 ? cpuMs / wallMs : 0.0;
+}
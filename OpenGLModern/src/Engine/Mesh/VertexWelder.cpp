@@ -0,0 +1,115 @@
+#include <Engine/Mesh/VertexWelder.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+    // Grid cells at or beyond this many epsilons don't fit a key; such values (and NaN / inf)
+    // are keyed by their bits instead, offset past every grid cell so the two never collide
+    constexpr double kMaxCells = 4611686018427387904.0;   // 2^62
+    constexpr int64_t kBitsKeyBase = int64_t(1) << 62;
+
+    // Snap a float onto a grid of the given epsilon (0 = compare the raw bits)
+    int64_t Quantize(float value, float epsilon) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        if (epsilon <= 0.0f) return bits;
+
+        const double cell = std::floor(static_cast<double>(value) / epsilon + 0.5);
+        if (!(std::fabs(cell) < kMaxCells)) return kBitsKeyBase + bits;
+        return static_cast<int64_t>(cell);
+    }
+
+    uint64_t HashKey(const int64_t* key, size_t count) {
+        // FNV-1a over the quantized words (both halves), then a final avalanche
+        uint64_t h = 14695981039346656037ull;
+        for (size_t i = 0; i < count; i++) {
+            const uint64_t word = static_cast<uint64_t>(key[i]);
+            h ^= static_cast<uint32_t>(word);
+            h *= 1099511628211ull;
+            h ^= static_cast<uint32_t>(word >> 32);
+            h *= 1099511628211ull;
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    size_t NextPowerOfTwo(size_t v) {
+        size_t p = 1;
+        while (p < v) p <<= 1;
+        return p;
+    }
+}
+
+WeldStats WeldVertices(std::vector<float>& vertices, size_t floatsPerVertex,
+                       std::vector<unsigned int>& indices, const WeldSettings& settings) {
+    WeldStats stats;
+    if (floatsPerVertex < kWeldBaseFloats || vertices.empty()) {
+        stats.verticesBefore = stats.verticesAfter = floatsPerVertex ? vertices.size() / floatsPerVertex : 0;
+        return stats;
+    }
+
+    const size_t vertexCount = vertices.size() / floatsPerVertex;
+    stats.verticesBefore = vertexCount;
+
+    // 1. Quantize every vertex into an integer key (one 64-bit word per float)
+    std::vector<float> epsilons(floatsPerVertex, 0.0f);
+    for (size_t i = 0; i < 3; i++) epsilons[kWeldPositionOffset + i] = settings.positionEpsilon;
+    for (size_t i = 0; i < 3; i++) epsilons[kWeldNormalOffset + i] = settings.normalEpsilon;
+    for (size_t i = 0; i < 2; i++) epsilons[kWeldUVOffset + i] = settings.uvEpsilon;
+
+    std::vector<int64_t> keys(vertexCount * floatsPerVertex);
+    for (size_t v = 0; v < vertexCount; v++) {
+        const float* src = &vertices[v * floatsPerVertex];
+        int64_t* dst = &keys[v * floatsPerVertex];
+        for (size_t c = 0; c < floatsPerVertex; c++) {
+            dst[c] = Quantize(src[c], epsilons[c]);
+        }
+    }
+
+    // 2. Open addressing table of unique vertices (linear probing, load factor <= 0.5)
+    const size_t tableSize = NextPowerOfTwo(vertexCount * 2);
+    const size_t mask = tableSize - 1;
+    constexpr unsigned int kEmpty = ~0u;
+    std::vector<unsigned int> table(tableSize, kEmpty);
+
+    std::vector<unsigned int> remap(vertexCount);
+    std::vector<float> welded;
+    welded.reserve(vertices.size());
+    unsigned int uniqueCount = 0;
+    const size_t keyBytes = floatsPerVertex * sizeof(int64_t);
+
+    for (size_t v = 0; v < vertexCount; v++) {
+        const int64_t* key = &keys[v * floatsPerVertex];
+        size_t slot = HashKey(key, floatsPerVertex) & mask;
+
+        while (true) {
+            unsigned int existing = table[slot];
+            if (existing == kEmpty) {
+                // New unique vertex: its key lives at its original position
+                table[slot] = static_cast<unsigned int>(v);
+                remap[v] = uniqueCount++;
+                welded.insert(welded.end(), vertices.begin() + v * floatsPerVertex,
+                              vertices.begin() + (v + 1) * floatsPerVertex);
+                break;
+            }
+            if (std::memcmp(&keys[existing * floatsPerVertex], key, keyBytes) == 0) {
+                remap[v] = remap[existing];
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    // 3. Rewrite indices to point at the compacted vertex buffer
+    for (auto& index : indices) {
+        index = remap[index];
+    }
+
+    vertices.swap(welded);
+    stats.verticesAfter = uniqueCount;
+    return stats;
+}
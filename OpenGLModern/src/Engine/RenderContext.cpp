@@ -45,4 +45,9 @@ void RenderContext::SetLightManager(std::shared_ptr<LightManager> lm) {
 
 void RenderContext::SetPerspective(float fov, float aspect, float nearPlane, float farPlane) {
     projection = glm::perspective(glm::radians(fov), aspect, nearPlane, farPlane);
-}
\ No newline at end of file
+}
+
+void RenderContext::SetViewportSize(int width, int height) {
+    viewportWidth = width;
+    viewportHeight = height;
+}
@@ -0,0 +1,142 @@
+#include <Engine/Renderer.hpp>
+#include <Engine/RenderContext.hpp>
+#include <Engine/Material.hpp>
+#include <Engine/GameObjectComponents/MeshRenderer.hpp>
+#include <Engine/Animation/AnimationSystem.hpp>
+#include <Engine/Utils/ParallelFor.hpp>
+#include <Shader/Shader.hpp>
+#include <Texture/Texture.hpp>
+#include <OPENGL/glad/glad.h>
+#include <algorithm>
+#include <chrono>
+
+// Both are bound for every skinned draw, and two sampler types can't share a unit
+static_assert(static_cast<unsigned int>(MaterialSlot::DiffuseArray) != AnimationSystem::kPaletteTextureSlot,
+              "the diffuse array and the bone palette need their own texture units");
+
+MeshHandle Renderer::AddMesh(const RenderMesh& mesh) {
+    return meshes.Insert(mesh);
+}
+
+void Renderer::RemoveMesh(MeshHandle handle) {
+    meshes.Remove(handle);
+}
+
+MaterialHandle Renderer::AddMaterial(Shader* shader, const Material* material, std::shared_ptr<Texture> baseTexture) {
+    // Ids are never reused, a shader keeps its id (and so its place in the draw order)
+    auto [it, inserted] = shaderIds.try_emplace(shader, static_cast<uint32_t>(shaderIds.size()));
+    return materials.Emplace(RenderMaterial{ shader, material, std::move(baseTexture), it->second });
+}
+
+void Renderer::RemoveMaterial(MaterialHandle handle) {
+    materials.Remove(handle);
+}
+
+void Renderer::Register(MeshRenderer* source) {
+    source->renderSlot = static_cast<int32_t>(sources.size());
+    sources.push_back(source);
+}
+
+void Renderer::Unregister(MeshRenderer* source) {
+    const int32_t slot = source->renderSlot;
+    if (slot < 0 || static_cast<size_t>(slot) >= sources.size() || sources[slot] != source) return;
+
+    // Swap-and-pop
+    sources[slot] = sources.back();
+    sources[slot]->renderSlot = slot;
+    sources.pop_back();
+    source->renderSlot = -1;
+}
+
+void Renderer::Extract(const RenderView& newView) {
+    auto start = std::chrono::high_resolution_clock::now();
+    view = newView;
+
+    // 1. Where each source's packets go
+    offsets.resize(sources.size() + 1);
+    offsets[0] = 0;
+    for (size_t i = 0; i < sources.size(); i++) {
+        offsets[i + 1] = offsets[i] + sources[i]->GetPacketCount();
+    }
+    queue.Resize(offsets.back());
+
+    // 2. Copy out; every source writes its own range, so batches can run on any thread
+    const size_t batches = (sources.size() + kExtractBatch - 1) / kExtractBatch;
+    auto extractBatch = [&](size_t batch) {
+        const size_t end = std::min(sources.size(), (batch + 1) * kExtractBatch);
+        for (size_t i = batch * kExtractBatch; i < end; i++) {
+            sources[i]->ExtractPackets(queue.Data() + offsets[i], view);
+        }
+    };
+    if (batches > 1) {
+        ParallelFor(batches, extractBatch);
+    } else if (batches == 1) {
+        extractBatch(0);
+    }
+    stats.extracted = queue.Size();
+
+    // 3. Drop what's out of view, then order the rest by shader / material / distance
+    stats.culled = queue.Cull(Frustum::FromMatrix(view.projection * view.view));
+    queue.Sort();
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    stats.extractMs = std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+void Renderer::Draw() {
+    auto start = std::chrono::high_resolution_clock::now();
+    stats.drawCalls = 0;
+    stats.shaderChanges = 0;
+    stats.materialChanges = 0;
+
+    LightManager& lights = ServiceLocator::GetServiceRef<RenderContext>().GetLightManager();
+    const AnimationSystem* animation = ServiceLocator::TryGetServicePtr<AnimationSystem>();
+
+    const Shader* boundShader = nullptr;
+    MaterialHandle boundMaterial;
+    const TextureArray* boundArray = nullptr;
+    const std::vector<RenderPacket>& packets = queue.GetPackets();
+
+    for (uint32_t index : queue.GetOrder()) {
+        const RenderPacket& packet = packets[index];
+        const RenderMesh* mesh = meshes.Get(packet.mesh);
+        const RenderMaterial* material = materials.Get(packet.material);
+        if (!mesh || !material || !material->shader) continue;
+        const Shader& shader = *material->shader;
+
+        // 1. Per shader: camera and lights
+        if (&shader != boundShader) {
+            shader.use();
+            shader.setMat4("view", view.view);
+            shader.setMat4("projection", view.projection);
+            shader.setVec3("viewPos", view.position);
+            lights.UpdateShader(shader);
+            boundShader = &shader;
+            boundMaterial = {};
+            stats.shaderChanges++;
+        }
+
+        // 2. Per material: textures (packed diffuse maps share one array bind)
+        if (packet.material != boundMaterial) {
+            if (material->baseTexture && material->baseTexture->IsReady()) material->baseTexture->bind(0);
+            if (material->material) material->material->Bind(shader, &boundArray);
+            boundMaterial = packet.material;
+            stats.materialChanges++;
+        }
+
+        // 3. Per packet
+        shader.setMat4("model", packet.world);
+        shader.setMat3("normalMatrix", packet.normal);
+        if (animation && packet.animation != AnimationSystem::kInvalidInstance) {
+            animation->BindPalette(shader, packet.animation);
+        }
+
+        glBindVertexArray(mesh->vao);
+        glDrawElements(GL_TRIANGLES, mesh->indexCount, GL_UNSIGNED_INT, 0);
+        stats.drawCalls++;
+    }
+    glBindVertexArray(0);
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    stats.drawMs = std::chrono::duration<double, std::milli>(finish - start).count();
+}
@@ -0,0 +1,110 @@
+#include <Engine/Utils/ObjectPool.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <bit>
+
+namespace {
+    constexpr size_t kChunkBytes = 64 * 1024;
+    constexpr size_t kMinSlotsPerChunk = 8;
+    constexpr size_t kSizeClassGranularity = 16;
+
+    size_t RoundUp(size_t value, size_t multiple) {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    // Never destroyed, see ObjectPool::For
+    std::vector<ObjectPool*>& Registry() {
+        static std::vector<ObjectPool*>& registry = *new std::vector<ObjectPool*>();
+        return registry;
+    }
+}
+
+ObjectPool::ObjectPool(std::string name, size_t size, size_t alignment)
+    : alignment(std::max(alignment, alignof(ObjectPool*))) {
+    // [padding][ObjectPool*][object], the pool pointer right before the object
+    headerSize = RoundUp(sizeof(ObjectPool*), this->alignment);
+    stats.name = std::move(name);
+    stats.objectSize = size;
+    stats.slotSize = RoundUp(headerSize + std::max(size, sizeof(FreeSlot)), this->alignment);
+    slotsPerChunk = std::max(kMinSlotsPerChunk, kChunkBytes / stats.slotSize);
+}
+
+ObjectPool::~ObjectPool() {
+    for (unsigned char* chunk : chunks) {
+        ::operator delete(chunk, std::align_val_t(alignment));
+    }
+}
+
+ObjectPool& ObjectPool::Leak(std::string name, size_t size, size_t alignment) {
+    ObjectPool* pool = new ObjectPool(std::move(name), size, alignment);
+    Registry().push_back(pool);
+    return *pool;
+}
+
+ObjectPool& ObjectPool::ForSize(size_t size, size_t alignment) {
+    static std::unordered_map<uint64_t, ObjectPool*>& pools = *new std::unordered_map<uint64_t, ObjectPool*>();
+    const size_t rounded = RoundUp(std::max<size_t>(size, 1), std::max(kSizeClassGranularity, alignment));
+    ObjectPool*& pool = pools[uint64_t(rounded) << 8 | std::bit_width(alignment)];
+    if (!pool) {
+        pool = &Leak("size " + std::to_string(rounded) + "/" + std::to_string(alignment), rounded, alignment);
+    }
+    return *pool;
+}
+
+std::vector<ObjectPool::Stats> ObjectPool::GetAllStats() {
+    std::vector<Stats> all;
+    all.reserve(Registry().size());
+    for (const ObjectPool* pool : Registry()) all.push_back(pool->stats);
+    return all;
+}
+
+void* ObjectPool::Allocate() {
+    if (!freeList) Grow(slotsPerChunk);
+
+    FreeSlot* slot = freeList;
+    freeList = slot->next;
+
+    stats.allocations++;
+    stats.live++;
+    stats.peak = std::max(stats.peak, stats.live);
+    return slot;
+}
+
+void ObjectPool::Free(void* object) {
+    if (!object) return;
+    ObjectPool* pool = *reinterpret_cast<ObjectPool**>(static_cast<unsigned char*>(object) - sizeof(ObjectPool*));
+
+    FreeSlot* slot = static_cast<FreeSlot*>(object);
+    slot->next = pool->freeList;
+    pool->freeList = slot;
+
+    pool->stats.frees++;
+    pool->stats.live--;
+}
+
+void ObjectPool::Reserve(size_t count) {
+    const size_t available = stats.capacity - stats.live;
+    if (count > available) Grow(std::max(count - available, slotsPerChunk));
+}
+
+void ObjectPool::Grow(size_t slots) {
+    const size_t bytes = slots * stats.slotSize;
+    unsigned char* chunk = static_cast<unsigned char*>(::operator new(bytes, std::align_val_t(alignment)));
+    chunks.push_back(chunk);
+
+    // 1. Stamp every slot with its pool once; Free reads it back
+    // 2. Link the slots in address order, so a fresh chunk fills front to back
+    FreeSlot* next = freeList;
+    for (size_t i = slots; i-- > 0;) {
+        unsigned char* object = chunk + i * stats.slotSize + headerSize;
+        *reinterpret_cast<ObjectPool**>(object - sizeof(ObjectPool*)) = this;
+        FreeSlot* slot = reinterpret_cast<FreeSlot*>(object);
+        slot->next = next;
+        next = slot;
+    }
+    freeList = next;
+
+    stats.chunks++;
+    stats.capacity += slots;
+    stats.reservedBytes += bytes;
+}
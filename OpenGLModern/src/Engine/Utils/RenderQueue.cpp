@@ -0,0 +1,37 @@
+#include <Engine/Utils/RenderQueue.hpp>
+#include <algorithm>
+#include <bit>
+
+uint64_t RenderQueue::MakeSortKey(uint32_t shaderId, uint32_t materialIndex, float distance) {
+    // A non-negative float's bits grow with its value, so the top 24 keep the order
+    const uint32_t depth = std::bit_cast<uint32_t>(std::max(distance, 0.0f)) >> 8;
+    return uint64_t(shaderId & 0xFFFFu) << 48 | uint64_t(materialIndex & 0xFFFFFFu) << 24 | depth;
+}
+
+void RenderQueue::Resize(size_t count) {
+    packets.resize(count);
+    order.clear();
+}
+
+size_t RenderQueue::Cull(const Frustum& frustum) {
+    const auto visibleEnd = std::remove_if(packets.begin(), packets.end(), [&](const RenderPacket& packet) {
+        return !frustum.IntersectsSphere(glm::vec3(packet.bounds), packet.bounds.w);
+    });
+    const size_t culled = static_cast<size_t>(packets.end() - visibleEnd);
+    packets.erase(visibleEnd, packets.end());
+    return culled;
+}
+
+void RenderQueue::Sort() {
+    // Key + index pairs are 16 bytes: much cheaper to move around than the 144 byte packets
+    keys.resize(packets.size());
+    for (size_t i = 0; i < packets.size(); i++) {
+        keys[i] = { packets[i].sortKey, static_cast<uint32_t>(i) };
+    }
+    std::sort(keys.begin(), keys.end());
+
+    order.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        order[i] = keys[i].second;
+    }
+}
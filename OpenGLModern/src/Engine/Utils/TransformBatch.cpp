@@ -0,0 +1,255 @@
+#include <Engine/Utils/TransformBatch.hpp>
+#include <Engine/Utils/SimdMath.hpp>
+#include <cstring>
+
+void TransformBatch::Clear() {
+    for (std::vector<float>* array : { &positionX, &positionY, &positionZ, &rotationX, &rotationY, &rotationZ,
+                                       &rotationW, &scaleX, &scaleY, &scaleZ }) {
+        array->clear();
+    }
+}
+
+void TransformBatch::Reserve(size_t count) {
+    for (std::vector<float>* array : { &positionX, &positionY, &positionZ, &rotationX, &rotationY, &rotationZ,
+                                       &rotationW, &scaleX, &scaleY, &scaleZ }) {
+        array->reserve(count);
+    }
+}
+
+void TransformBatch::Add(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale) {
+    positionX.push_back(position.x);
+    positionY.push_back(position.y);
+    positionZ.push_back(position.z);
+    rotationX.push_back(rotation.x);
+    rotationY.push_back(rotation.y);
+    rotationZ.push_back(rotation.z);
+    rotationW.push_back(rotation.w);
+    scaleX.push_back(scale.x);
+    scaleY.push_back(scale.y);
+    scaleZ.push_back(scale.z);
+}
+
+namespace {
+    // ==========================================
+    // Scalar reference (also handles the tail)
+    // ==========================================
+
+    float SafeReciprocal(float v) {
+        return v != 0.0f ? 1.0f / v : 0.0f;
+    }
+
+    void ComputeOne(const TransformBatch& b, size_t i, glm::mat4* models, glm::mat3* normals) {
+        const float x = b.rotationX[i], y = b.rotationY[i], z = b.rotationZ[i], w = b.rotationW[i];
+        // Same terms as glm::mat3_cast
+        const glm::vec3 r0(1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + w * z), 2.0f * (x * z - w * y));
+        const glm::vec3 r1(2.0f * (x * y - w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + w * x));
+        const glm::vec3 r2(2.0f * (x * z + w * y), 2.0f * (y * z - w * x), 1.0f - 2.0f * (x * x + y * y));
+
+        models[i] = glm::mat4(
+            glm::vec4(r0 * b.scaleX[i], 0.0f),
+            glm::vec4(r1 * b.scaleY[i], 0.0f),
+            glm::vec4(r2 * b.scaleZ[i], 0.0f),
+            glm::vec4(b.positionX[i], b.positionY[i], b.positionZ[i], 1.0f));
+        if (normals) {
+            normals[i] = glm::mat3(r0 * SafeReciprocal(b.scaleX[i]), r1 * SafeReciprocal(b.scaleY[i]),
+                                   r2 * SafeReciprocal(b.scaleZ[i]));
+        }
+    }
+
+#ifdef ENGINE_SIMD_SSE
+    // ==========================================
+    // SIMD: lane k of every register is object i + k
+    // ==========================================
+
+    // The same math for __m128 and __m256
+    inline __m128 Add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+    inline __m128 Sub(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+    inline __m128 Mul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+    inline __m128 Set1(__m128, float v) { return _mm_set1_ps(v); }
+    inline __m128 Load(__m128, const float* p) { return _mm_loadu_ps(p); }
+    inline __m128 SafeReciprocal(__m128 v) {
+        return _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), v), _mm_cmpneq_ps(v, _mm_setzero_ps()));
+    }
+#ifdef ENGINE_SIMD_AVX2
+    inline __m256 Add(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+    inline __m256 Sub(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+    inline __m256 Mul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+    inline __m256 Set1(__m256, float v) { return _mm256_set1_ps(v); }
+    inline __m256 Load(__m256, const float* p) { return _mm256_loadu_ps(p); }
+    inline __m256 SafeReciprocal(__m256 v) {
+        return _mm256_and_ps(_mm256_div_ps(_mm256_set1_ps(1.0f), v), _mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_NEQ_OQ));
+    }
+#endif
+
+    // Register width as a tag type (vector types as template arguments lose their attributes)
+    struct Sse { using V = __m128; };
+#ifdef ENGINE_SIMD_AVX2
+    struct Avx { using V = __m256; };
+#endif
+
+    // Model columns 0-2 (xyz), translation, and normal columns 0-2, one value per register
+    template <typename Isa>
+    struct TrsLanes {
+        typename Isa::V model[9];
+        typename Isa::V position[3];
+        typename Isa::V normal[9];
+    };
+
+    template <typename Isa>
+    TrsLanes<Isa> ComputeLanes(const TransformBatch& b, size_t i) {
+        using V = typename Isa::V;
+        const V tag{};
+        const V x = Load(tag, &b.rotationX[i]), y = Load(tag, &b.rotationY[i]);
+        const V z = Load(tag, &b.rotationZ[i]), w = Load(tag, &b.rotationW[i]);
+        const V one = Set1(tag, 1.0f), two = Set1(tag, 2.0f);
+
+        const V xx = Mul(x, x), yy = Mul(y, y), zz = Mul(z, z);
+        const V xy = Mul(x, y), xz = Mul(x, z), yz = Mul(y, z);
+        const V wx = Mul(w, x), wy = Mul(w, y), wz = Mul(w, z);
+
+        const V r[9] = {
+            Sub(one, Mul(two, Add(yy, zz))), Mul(two, Add(xy, wz)), Mul(two, Sub(xz, wy)),
+            Mul(two, Sub(xy, wz)), Sub(one, Mul(two, Add(xx, zz))), Mul(two, Add(yz, wx)),
+            Mul(two, Add(xz, wy)), Mul(two, Sub(yz, wx)), Sub(one, Mul(two, Add(xx, yy))),
+        };
+        const V scale[3] = { Load(tag, &b.scaleX[i]), Load(tag, &b.scaleY[i]), Load(tag, &b.scaleZ[i]) };
+
+        TrsLanes<Isa> lanes;
+        for (int column = 0; column < 3; column++) {
+            const V inverse = SafeReciprocal(scale[column]);
+            for (int row = 0; row < 3; row++) {
+                lanes.model[column * 3 + row] = Mul(r[column * 3 + row], scale[column]);
+                lanes.normal[column * 3 + row] = Mul(r[column * 3 + row], inverse);
+            }
+        }
+        lanes.position[0] = Load(tag, &b.positionX[i]);
+        lanes.position[1] = Load(tag, &b.positionY[i]);
+        lanes.position[2] = Load(tag, &b.positionZ[i]);
+        return lanes;
+    }
+
+    // Writes objects i..i+3 from 4-wide lanes: one 4x4 transpose turns lanes into per-object columns
+    void Store4(const TrsLanes<Sse>& lanes, size_t i, glm::mat4* models, glm::mat3* normals) {
+        const __m128 zero = _mm_setzero_ps();
+        __m128 columns[4][4];   // [column][object]
+        for (int column = 0; column < 3; column++) {
+            __m128 x = lanes.model[column * 3], y = lanes.model[column * 3 + 1], z = lanes.model[column * 3 + 2];
+            __m128 w = zero;
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            columns[column][0] = x; columns[column][1] = y; columns[column][2] = z; columns[column][3] = w;
+        }
+        {
+            __m128 x = lanes.position[0], y = lanes.position[1], z = lanes.position[2], w = _mm_set1_ps(1.0f);
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            columns[3][0] = x; columns[3][1] = y; columns[3][2] = z; columns[3][3] = w;
+        }
+        for (int k = 0; k < 4; k++) {
+            float* model = &models[i + k][0][0];
+            for (int column = 0; column < 4; column++) _mm_storeu_ps(model + column * 4, columns[column][k]);
+        }
+
+        if (!normals) return;
+        for (int column = 0; column < 3; column++) {
+            __m128 x = lanes.normal[column * 3], y = lanes.normal[column * 3 + 1], z = lanes.normal[column * 3 + 2];
+            __m128 w = zero;
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            columns[column][0] = x; columns[column][1] = y; columns[column][2] = z; columns[column][3] = w;
+        }
+        // mat3 columns are 12 bytes: each 16 byte store spills one float into the next column,
+        // which the next store overwrites. Only the very last column may not spill (end of array).
+        for (int k = 0; k < 4; k++) {
+            float* normal = &normals[i + k][0][0];
+            _mm_storeu_ps(normal, columns[0][k]);
+            _mm_storeu_ps(normal + 3, columns[1][k]);
+            if (k < 3) {
+                _mm_storeu_ps(normal + 6, columns[2][k]);
+            } else {
+                float tmp[4];
+                _mm_storeu_ps(tmp, columns[2][k]);
+                std::memcpy(normal + 6, tmp, 3 * sizeof(float));
+            }
+        }
+    }
+
+#ifdef ENGINE_SIMD_AVX2
+    // 4x4 transpose inside each 128-bit half: register k ends up holding object k (low) and k + 4 (high).
+    // Same shuffle count as the SSE transpose for twice the objects; the shuffles are what bounds this kernel.
+    void Transpose8(__m256& x, __m256& y, __m256& z, __m256& w) {
+        const __m256 t0 = _mm256_unpacklo_ps(x, y);
+        const __m256 t1 = _mm256_unpackhi_ps(x, y);
+        const __m256 t2 = _mm256_unpacklo_ps(z, w);
+        const __m256 t3 = _mm256_unpackhi_ps(z, w);
+        x = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        y = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        z = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        w = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    // Writes objects i..i+7 from 8-wide lanes
+    void Store8(const TrsLanes<Avx>& lanes, size_t i, glm::mat4* models, glm::mat3* normals) {
+        const __m256 zero = _mm256_setzero_ps();
+        __m256 columns[4][4];   // [column][object k / k + 4]
+        for (int column = 0; column < 4; column++) {
+            const __m256* source = column < 3 ? &lanes.model[column * 3] : lanes.position;
+            __m256 x = source[0], y = source[1], z = source[2];
+            __m256 w = column < 3 ? zero : _mm256_set1_ps(1.0f);
+            Transpose8(x, y, z, w);
+            columns[column][0] = x; columns[column][1] = y; columns[column][2] = z; columns[column][3] = w;
+        }
+        for (int k = 0; k < 4; k++) {
+            float* low = &models[i + k][0][0];
+            float* high = &models[i + k + 4][0][0];
+            for (int column = 0; column < 4; column++) {
+                _mm_storeu_ps(low + column * 4, _mm256_castps256_ps128(columns[column][k]));
+                _mm_storeu_ps(high + column * 4, _mm256_extractf128_ps(columns[column][k], 1));
+            }
+        }
+
+        if (!normals) return;
+        for (int column = 0; column < 3; column++) {
+            __m256 x = lanes.normal[column * 3], y = lanes.normal[column * 3 + 1], z = lanes.normal[column * 3 + 2];
+            __m256 w = zero;
+            Transpose8(x, y, z, w);
+            columns[column][0] = x; columns[column][1] = y; columns[column][2] = z; columns[column][3] = w;
+        }
+        // Objects in ascending order so each spilled float is overwritten by the next store (see Store4)
+        for (int k = 0; k < 8; k++) {
+            float* normal = &normals[i + k][0][0];
+            for (int column = 0; column < 3; column++) {
+                const __m128 value = k < 4 ? _mm256_castps256_ps128(columns[column][k])
+                                           : _mm256_extractf128_ps(columns[column][k - 4], 1);
+                if (k < 7 || column < 2) {
+                    _mm_storeu_ps(normal + column * 3, value);
+                } else {
+                    float tmp[4];
+                    _mm_storeu_ps(tmp, value);
+                    std::memcpy(normal + 6, tmp, 3 * sizeof(float));
+                }
+            }
+        }
+    }
+#endif
+#endif
+}
+
+void ComputeTrsMatrices(const TransformBatch& batch, glm::mat4* models, glm::mat3* normals, bool useSimd) {
+    const size_t count = batch.Size();
+    size_t i = 0;
+
+#ifdef ENGINE_SIMD_SSE
+    if (useSimd) {
+#ifdef ENGINE_SIMD_AVX2
+        for (; i + 8 <= count; i += 8) {
+            Store8(ComputeLanes<Avx>(batch, i), i, models, normals);
+        }
+#endif
+        for (; i + 4 <= count; i += 4) {
+            Store4(ComputeLanes<Sse>(batch, i), i, models, normals);
+        }
+    }
+#endif
+
+    for (; i < count; i++) {
+        ComputeOne(batch, i, models, normals);
+    }
+}
@@ -40,30 +40,30 @@ void Camera::UpdateCameraVectors() {
 }
 
 void Camera::Update(double deltaTime) {
-    // 1. ACCESS SERVICES
-    auto input = ServiceLocator::Get().GetService<InputManager>();
-    auto render = ServiceLocator::Get().GetService<RenderContext>();
+    // 1. ACCESS SERVICES (plain references: no shared_ptr copies every frame)
+    InputManager& input = ServiceLocator::GetServiceRef<InputManager>();
+    RenderContext& render = ServiceLocator::GetServiceRef<RenderContext>();
 
     // 2. MOVEMENT (WASD)
     float velocity = movementSpeed * (float)deltaTime;
 
-    if (input->IsKeyPressed(GLFW_KEY_W))
+    if (input.IsKeyPressed(GLFW_KEY_W))
         position += front * velocity;
-    if (input->IsKeyPressed(GLFW_KEY_S))
+    if (input.IsKeyPressed(GLFW_KEY_S))
         position -= front * velocity;
-    if (input->IsKeyPressed(GLFW_KEY_A))
+    if (input.IsKeyPressed(GLFW_KEY_A))
         position -= right * velocity;
-    if (input->IsKeyPressed(GLFW_KEY_D))
+    if (input.IsKeyPressed(GLFW_KEY_D))
         position += right * velocity;
 
-    if (input->IsKeyPressed(GLFW_KEY_SPACE))
+    if (input.IsKeyPressed(GLFW_KEY_SPACE))
         position += up * velocity;
-    if (input->IsKeyPressed(GLFW_KEY_LEFT_SHIFT))
+    if (input.IsKeyPressed(GLFW_KEY_LEFT_SHIFT))
         position -= up * velocity;
 
     // 3. MOUSE LOOK
-    float mouseDeltaX = input->GetMouseDeltaX();
-    float mouseDeltaY = input->GetMouseDeltaY();
+    float mouseDeltaX = input.GetMouseDeltaX();
+    float mouseDeltaY = input.GetMouseDeltaY();
 
     yaw += mouseDeltaX * mouseSensitivity;
     pitch += mouseDeltaY * mouseSensitivity;
@@ -72,23 +72,25 @@ void Camera::Update(double deltaTime) {
     if (pitch < -89.0f) pitch = -89.0f;
 
     // 4. ZOOM
-    float scrollDelta = input->GetScrollDelta();
+    float scrollDelta = input.GetScrollDelta();
     if (scrollDelta != 0.0f) {
         fov -= scrollDelta;
         if (fov < 1.0f) fov = 1.0f;
         if (fov > 90.0f) fov = 90.0f;
 
-        render->SetPerspective(fov, 800.0f / 600.0f, 0.1f, 100.0f);
+        render.SetPerspective(fov, 800.0f / 600.0f, 0.1f, 100.0f);
     }
 
     UpdateCameraVectors();
 
     // 5. UPDATE RENDER CONTEXT
     glm::mat4 view = glm::lookAt(position, position + front, up);
-    render->SetViewMatrix(view);
+    render.SetViewMatrix(view);
 
     //side
-    spotlight->position = position;
-    spotlight->direction = front;
-    input->ResetDeltas();
+    if (SpotLight* light = render.GetLightManager().Get(spotlight)) {
+        light->position = position;
+        light->direction = front;
+    }
+    input.ResetDeltas();
 }
\ No newline at end of file
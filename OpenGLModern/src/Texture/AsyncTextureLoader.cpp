@@ -0,0 +1,158 @@
+#include <Texture/AsyncTextureLoader.hpp>
+#include <Engine/Utils/Hash.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+AsyncTextureLoader::AsyncTextureLoader(size_t workerCount) {
+    if (workerCount == 0) {
+        const unsigned int cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 1;
+    }
+    for (size_t i = 0; i < workerCount; i++) {
+        workers.emplace_back(&AsyncTextureLoader::WorkerLoop, this);
+    }
+}
+
+AsyncTextureLoader::~AsyncTextureLoader() {
+    {
+        std::lock_guard<std::mutex> lock(requestMutex);
+        stopping = true;
+    }
+    requestReady.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (pbos[0]) {
+        glDeleteBuffers(static_cast<GLsizei>(kPboCount), pbos);
+    }
+}
+
+void AsyncTextureLoader::Enqueue(Request request) {
+    pending++;
+    {
+        std::lock_guard<std::mutex> lock(requestMutex);
+        requests.push_back(std::move(request));
+    }
+    requestReady.notify_one();
+}
+
+void AsyncTextureLoader::WorkerLoop() {
+    while (true) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(requestMutex);
+            requestReady.wait(lock, [&] { return stopping || !requests.empty(); });
+            if (stopping) return;
+            request = std::move(requests.front());
+            requests.pop_front();
+        }
+
+        Decoded decoded;
+        decoded.request = std::move(request);
+
+        // Nobody holds the handle any more: don't bother decoding
+        if (!decoded.request.texture.expired()) {
+            decoded.image = LoadImageFromFile(decoded.request.path.c_str(), true);
+            if (decoded.image.IsValid()) {
+                const int dims[3] = { decoded.image.width, decoded.image.height, decoded.image.channels };
+                decoded.contentHash = HashBytes(dims, sizeof(dims),
+                    HashBytes(decoded.image.pixels.data(), decoded.image.pixels.size()));
+                // Mips are filtered here so the GL thread only copies finished levels
+                decoded.mips = GenerateMipChain(decoded.image, decoded.request.mipSettings);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(finishedMutex);
+        finished.push_back(std::move(decoded));
+    }
+}
+
+void AsyncTextureLoader::Upload(Texture& texture, const Image& image, const std::vector<Image>& mips) {
+    if (!pbos[0]) {
+        glGenBuffers(static_cast<GLsizei>(kPboCount), pbos);
+    }
+
+    texture.AllocateStorage(image.width, image.height, image.channels);
+
+    // Every level goes into one PBO back to back
+    std::vector<const Image*> levels = { &image };
+    for (const Image& mip : mips) levels.push_back(&mip);
+    size_t totalBytes = 0;
+    for (const Image* level : levels) totalBytes += level->pixels.size();
+
+    const GLsizeiptr bytes = static_cast<GLsizeiptr>(totalBytes);
+    const unsigned int pbo = pbos[nextPbo];
+    nextPbo = (nextPbo + 1) % kPboCount;
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+    // Orphan: the driver hands us fresh memory if the previous copy is still in flight
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+    unsigned char* dst = static_cast<unsigned char*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes,
+                                                     GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+    size_t offset = 0;
+    if (dst) {
+        for (const Image* level : levels) {
+            std::memcpy(dst + offset, level->pixels.data(), level->pixels.size());
+            offset += level->pixels.size();
+        }
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    } else {
+        // Mapping failed (out of memory?): fall back to plain client memory uploads
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    // Source is the bound PBO (pixels = offset into it), or client memory in the fallback
+    offset = 0;
+    for (size_t i = 0; i < levels.size(); i++) {
+        const Image& level = *levels[i];
+        const void* pixels = dst ? reinterpret_cast<const void*>(offset) : level.pixels.data();
+        texture.SetLevel(static_cast<int>(i), level.width, level.height, pixels);
+        offset += level.pixels.size();
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    // Only if the worker couldn't build the chain
+    if (static_cast<int>(levels.size()) != texture.levels) {
+        texture.GenerateMipmaps();
+    }
+    texture.unbind();
+}
+
+std::vector<AsyncTextureLoader::Uploaded> AsyncTextureLoader::UploadFinished(size_t byteBudget) {
+    std::vector<Uploaded> uploaded;
+    size_t usedBytes = 0;
+
+    while (usedBytes < byteBudget || uploaded.empty()) {
+        Decoded decoded;
+        {
+            std::lock_guard<std::mutex> lock(finishedMutex);
+            if (finished.empty()) break;
+            decoded = std::move(finished.front());
+            finished.pop_front();
+        }
+        pending--;
+
+        Uploaded result;
+        result.id = decoded.request.id;
+        result.contentHash = decoded.contentHash;
+
+        std::shared_ptr<Texture> texture = decoded.request.texture.lock();
+        if (!texture) continue; // dropped while decoding
+
+        if (!decoded.image.IsValid()) {
+            std::cout << "Failed to load texture: " << decoded.request.path << std::endl;
+            result.failed = true;
+        } else {
+            Upload(*texture, decoded.image, decoded.mips);
+            result.width = decoded.image.width;
+            result.height = decoded.image.height;
+            result.channels = decoded.image.channels;
+            usedBytes += decoded.image.pixels.size();
+            for (const Image& mip : decoded.mips) usedBytes += mip.pixels.size();
+        }
+        uploaded.push_back(result);
+    }
+    return uploaded;
+}
@@ -0,0 +1,550 @@
+#include <Texture/BlockCompression.hpp>
+#include <Engine/Utils/ParallelFor.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+    // ==========================================
+    // Shared helpers
+    // ==========================================
+
+    // Principal axis of a set of points (power iteration on the covariance matrix)
+    template <int N>
+    void PrincipalAxis(const float points[16][N], float mean[N], float axis[N]) {
+        for (int c = 0; c < N; c++) {
+            mean[c] = 0.0f;
+            for (int i = 0; i < 16; i++) mean[c] += points[i][c];
+            mean[c] /= 16.0f;
+        }
+
+        float cov[N][N] = {};
+        for (int i = 0; i < 16; i++) {
+            for (int a = 0; a < N; a++) {
+                for (int b = 0; b < N; b++) {
+                    cov[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+                }
+            }
+        }
+
+        for (int c = 0; c < N; c++) axis[c] = 1.0f;
+        for (int iter = 0; iter < 8; iter++) {
+            float next[N] = {};
+            for (int a = 0; a < N; a++) {
+                for (int b = 0; b < N; b++) next[a] += cov[a][b] * axis[b];
+            }
+            float len = 0.0f;
+            for (int c = 0; c < N; c++) len += next[c] * next[c];
+            if (len < 1e-12f) break;
+            len = 1.0f / std::sqrt(len);
+            for (int c = 0; c < N; c++) axis[c] = next[c] * len;
+        }
+    }
+
+    // Endpoints = extremes of the points projected on the principal axis
+    template <int N>
+    void FitEndpoints(const float points[16][N], float e0[N], float e1[N]) {
+        float mean[N], axis[N];
+        PrincipalAxis<N>(points, mean, axis);
+
+        float lo = 1e30f, hi = -1e30f;
+        for (int i = 0; i < 16; i++) {
+            float t = 0.0f;
+            for (int c = 0; c < N; c++) t += (points[i][c] - mean[c]) * axis[c];
+            lo = std::min(lo, t);
+            hi = std::max(hi, t);
+        }
+        for (int c = 0; c < N; c++) {
+            e0[c] = std::clamp(mean[c] + axis[c] * hi, 0.0f, 255.0f);
+            e1[c] = std::clamp(mean[c] + axis[c] * lo, 0.0f, 255.0f);
+        }
+    }
+
+    // Least squares endpoints for fixed per-texel interpolation weights (0 = e0, 1 = e1)
+    template <int N>
+    bool RefineEndpoints(const float points[16][N], const float weights[16], float e0[N], float e1[N]) {
+        float a = 0.0f, b = 0.0f, c = 0.0f;
+        float x[N] = {}, y[N] = {};
+        for (int i = 0; i < 16; i++) {
+            const float w = weights[i], iw = 1.0f - w;
+            a += iw * iw;
+            b += iw * w;
+            c += w * w;
+            for (int k = 0; k < N; k++) {
+                x[k] += iw * points[i][k];
+                y[k] += w * points[i][k];
+            }
+        }
+        const float det = a * c - b * b;
+        if (std::abs(det) < 1e-6f) return false;
+        for (int k = 0; k < N; k++) {
+            e0[k] = std::clamp((c * x[k] - b * y[k]) / det, 0.0f, 255.0f);
+            e1[k] = std::clamp((a * y[k] - b * x[k]) / det, 0.0f, 255.0f);
+        }
+        return true;
+    }
+
+    constexpr int kRefineIterations = 2;
+
+    // ==========================================
+    // BC1 (color part shared with BC3)
+    // ==========================================
+
+    uint16_t To565(const float c[3]) {
+        const int r = static_cast<int>(std::lround(c[0] * 31.0f / 255.0f));
+        const int g = static_cast<int>(std::lround(c[1] * 63.0f / 255.0f));
+        const int b = static_cast<int>(std::lround(c[2] * 31.0f / 255.0f));
+        return static_cast<uint16_t>((std::clamp(r, 0, 31) << 11) | (std::clamp(g, 0, 63) << 5) | std::clamp(b, 0, 31));
+    }
+
+    void From565(uint16_t v, int out[3]) {
+        const int r = (v >> 11) & 31, g = (v >> 5) & 63, b = v & 31;
+        out[0] = (r << 3) | (r >> 2);
+        out[1] = (g << 2) | (g >> 4);
+        out[2] = (b << 3) | (b >> 2);
+    }
+
+    void ColorPalette(uint16_t c0, uint16_t c1, bool fourColor, int palette[4][3]) {
+        From565(c0, palette[0]);
+        From565(c1, palette[1]);
+        for (int c = 0; c < 3; c++) {
+            if (fourColor) {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            } else {
+                palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+                palette[3][c] = 0;
+            }
+        }
+    }
+
+    // Quantizes endpoints, picks indices, returns the squared error
+    int EvaluateColorBlock(const uint8_t rgba[64], const float e0[3], const float e1[3],
+                           uint16_t& c0, uint16_t& c1, uint32_t& indices) {
+        c0 = To565(e0);
+        c1 = To565(e1);
+        // Four color mode needs c0 > c1
+        if (c0 < c1) std::swap(c0, c1);
+
+        indices = 0;
+        int palette[4][3];
+        ColorPalette(c0, c1, true, palette);
+
+        int total = 0;
+        for (int i = 0; i < 16; i++) {
+            int best = 0, bestError = 1 << 30;
+            for (int p = 0; p < (c0 == c1 ? 1 : 4); p++) {
+                int error = 0;
+                for (int c = 0; c < 3; c++) {
+                    const int d = rgba[i * 4 + c] - palette[p][c];
+                    error += d * d;
+                }
+                if (error < bestError) { bestError = error; best = p; }
+            }
+            indices |= static_cast<uint32_t>(best) << (i * 2);
+            total += bestError;
+        }
+        return total;
+    }
+
+    void EncodeColorBlock(const uint8_t rgba[64], uint8_t* out) {
+        float points[16][3];
+        for (int i = 0; i < 16; i++) {
+            for (int c = 0; c < 3; c++) points[i][c] = rgba[i * 4 + c];
+        }
+
+        float e0[3], e1[3];
+        FitEndpoints<3>(points, e0, e1);
+
+        uint16_t bestC0 = 0, bestC1 = 0;
+        uint32_t bestIndices = 0;
+        int bestError = 1 << 30;
+        for (int iter = 0; iter <= kRefineIterations; iter++) {
+            uint16_t c0, c1;
+            uint32_t indices;
+            const int error = EvaluateColorBlock(rgba, e0, e1, c0, c1, indices);
+            if (error < bestError) {
+                bestError = error;
+                bestC0 = c0; bestC1 = c1; bestIndices = indices;
+            }
+            if (error == 0 || iter == kRefineIterations) break;
+
+            // Palette order is c0, c1, 2/3 c0 + 1/3 c1, 1/3 c0 + 2/3 c1
+            constexpr float kWeights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+            float weights[16];
+            for (int i = 0; i < 16; i++) weights[i] = kWeights[(indices >> (i * 2)) & 3];
+
+            if (!RefineEndpoints<3>(points, weights, e0, e1)) break;
+        }
+
+        out[0] = bestC0 & 0xFF; out[1] = bestC0 >> 8;
+        out[2] = bestC1 & 0xFF; out[3] = bestC1 >> 8;
+        std::memcpy(out + 4, &bestIndices, 4);
+    }
+
+    void DecodeColorBlock(const uint8_t* in, uint8_t rgba[64], bool forceFourColor) {
+        const uint16_t c0 = static_cast<uint16_t>(in[0] | (in[1] << 8));
+        const uint16_t c1 = static_cast<uint16_t>(in[2] | (in[3] << 8));
+        uint32_t indices;
+        std::memcpy(&indices, in + 4, 4);
+
+        int palette[4][3];
+        const bool fourColor = forceFourColor || c0 > c1;
+        ColorPalette(c0, c1, fourColor, palette);
+
+        for (int i = 0; i < 16; i++) {
+            const int p = (indices >> (i * 2)) & 3;
+            for (int c = 0; c < 3; c++) rgba[i * 4 + c] = static_cast<uint8_t>(palette[p][c]);
+            rgba[i * 4 + 3] = (!fourColor && p == 3) ? 0 : 255;
+        }
+    }
+
+    // ==========================================
+    // BC4 (single channel, also BC3 alpha and BC5)
+    // ==========================================
+
+    void EncodeChannelBlock(const uint8_t rgba[64], int channel, uint8_t* out) {
+        int lo = 255, hi = 0;
+        for (int i = 0; i < 16; i++) {
+            lo = std::min<int>(lo, rgba[i * 4 + channel]);
+            hi = std::max<int>(hi, rgba[i * 4 + channel]);
+        }
+
+        // 8 value mode: a0 > a1
+        out[0] = static_cast<uint8_t>(hi);
+        out[1] = static_cast<uint8_t>(lo);
+
+        uint64_t bits = 0;
+        if (hi != lo) {
+            for (int i = 0; i < 16; i++) {
+                // Position along a0 -> a1 in sevenths
+                const int pos = static_cast<int>(std::lround((hi - rgba[i * 4 + channel]) * 7.0f / (hi - lo)));
+                const int index = pos == 0 ? 0 : (pos == 7 ? 1 : pos + 1);
+                bits |= static_cast<uint64_t>(index) << (i * 3);
+            }
+        }
+        for (int b = 0; b < 6; b++) out[2 + b] = static_cast<uint8_t>(bits >> (b * 8));
+    }
+
+    void DecodeChannelBlock(const uint8_t* in, uint8_t rgba[64], int channel) {
+        const int a0 = in[0], a1 = in[1];
+        int palette[8] = { a0, a1 };
+        if (a0 > a1) {
+            for (int k = 1; k <= 6; k++) palette[k + 1] = ((7 - k) * a0 + k * a1) / 7;
+        } else {
+            for (int k = 1; k <= 4; k++) palette[k + 1] = ((5 - k) * a0 + k * a1) / 5;
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        uint64_t bits = 0;
+        for (int b = 0; b < 6; b++) bits |= static_cast<uint64_t>(in[2 + b]) << (b * 8);
+        for (int i = 0; i < 16; i++) {
+            rgba[i * 4 + channel] = static_cast<uint8_t>(palette[(bits >> (i * 3)) & 7]);
+        }
+    }
+
+    // ==========================================
+    // BC7 mode 6: one subset, RGBA 7.7.7.7 + p-bit endpoints, 4-bit indices
+    // ==========================================
+
+    constexpr int kBc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    struct BitWriter {
+        uint8_t* out;
+        int pos = 0;
+        void Write(uint32_t value, int count) {
+            for (int i = 0; i < count; i++, pos++) {
+                if (value & (1u << i)) out[pos >> 3] |= static_cast<uint8_t>(1u << (pos & 7));
+            }
+        }
+    };
+
+    struct BitReader {
+        const uint8_t* in;
+        int pos = 0;
+        uint32_t Read(int count) {
+            uint32_t value = 0;
+            for (int i = 0; i < count; i++, pos++) {
+                value |= static_cast<uint32_t>((in[pos >> 3] >> (pos & 7)) & 1) << i;
+            }
+            return value;
+        }
+    };
+
+    // Picks the p-bit that best represents the endpoint, returns 7-bit channels
+    void QuantizeBc7Endpoint(const float e[4], int out7[4], int& pbit) {
+        int bestError = 1 << 30;
+        for (int p = 0; p < 2; p++) {
+            int q[4], error = 0;
+            for (int c = 0; c < 4; c++) {
+                q[c] = std::clamp(static_cast<int>(std::lround((e[c] - p) / 2.0f)), 0, 127);
+                const int d = ((q[c] << 1) | p) - static_cast<int>(std::lround(e[c]));
+                error += d * d;
+            }
+            if (error < bestError) {
+                bestError = error;
+                pbit = p;
+                std::copy(q, q + 4, out7);
+            }
+        }
+    }
+
+    struct Bc7Candidate {
+        int q0[4], q1[4];
+        int p0 = 0, p1 = 0;
+        int indices[16];
+    };
+
+    int EvaluateBc7Block(const uint8_t rgba[64], const float e0[4], const float e1[4], Bc7Candidate& out) {
+        QuantizeBc7Endpoint(e0, out.q0, out.p0);
+        QuantizeBc7Endpoint(e1, out.q1, out.p1);
+
+        int end0[4], end1[4];
+        for (int c = 0; c < 4; c++) {
+            end0[c] = (out.q0[c] << 1) | out.p0;
+            end1[c] = (out.q1[c] << 1) | out.p1;
+        }
+
+        int total = 0;
+        for (int i = 0; i < 16; i++) {
+            int best = 0, bestError = 1 << 30;
+            for (int k = 0; k < 16; k++) {
+                int error = 0;
+                for (int c = 0; c < 4; c++) {
+                    const int v = ((64 - kBc7Weights4[k]) * end0[c] + kBc7Weights4[k] * end1[c] + 32) >> 6;
+                    const int d = rgba[i * 4 + c] - v;
+                    error += d * d;
+                }
+                if (error < bestError) { bestError = error; best = k; }
+            }
+            out.indices[i] = best;
+            total += bestError;
+        }
+        return total;
+    }
+
+    void EncodeBc7Block(const uint8_t rgba[64], uint8_t* out) {
+        float points[16][4];
+        for (int i = 0; i < 16; i++) {
+            for (int c = 0; c < 4; c++) points[i][c] = rgba[i * 4 + c];
+        }
+
+        float e0[4], e1[4];
+        FitEndpoints<4>(points, e0, e1);
+
+        Bc7Candidate best;
+        int bestError = 1 << 30;
+        for (int iter = 0; iter <= kRefineIterations; iter++) {
+            Bc7Candidate candidate;
+            const int error = EvaluateBc7Block(rgba, e0, e1, candidate);
+            if (error < bestError) {
+                bestError = error;
+                best = candidate;
+            }
+            if (error == 0 || iter == kRefineIterations) break;
+
+            float weights[16];
+            for (int i = 0; i < 16; i++) weights[i] = kBc7Weights4[candidate.indices[i]] / 64.0f;
+            if (!RefineEndpoints<4>(points, weights, e0, e1)) break;
+        }
+
+        // Anchor texel 0 must have its index MSB clear: swap endpoints and invert indices
+        if (best.indices[0] & 8) {
+            std::swap(best.q0, best.q1);
+            std::swap(best.p0, best.p1);
+            for (int& index : best.indices) index = 15 - index;
+        }
+
+        std::memset(out, 0, 16);
+        BitWriter writer{ out };
+        writer.Write(1u << 6, 7); // mode 6
+        for (int c = 0; c < 4; c++) {
+            writer.Write(best.q0[c], 7);
+            writer.Write(best.q1[c], 7);
+        }
+        writer.Write(best.p0, 1);
+        writer.Write(best.p1, 1);
+        writer.Write(best.indices[0], 3);
+        for (int i = 1; i < 16; i++) writer.Write(best.indices[i], 4);
+    }
+
+    void DecodeBc7Block(const uint8_t* in, uint8_t rgba[64]) {
+        BitReader reader{ in };
+        if (reader.Read(7) != (1u << 6)) {
+            // Only mode 6 is produced by our encoder; anything else decodes as opaque magenta
+            for (int i = 0; i < 16; i++) {
+                rgba[i * 4 + 0] = 255; rgba[i * 4 + 1] = 0; rgba[i * 4 + 2] = 255; rgba[i * 4 + 3] = 255;
+            }
+            return;
+        }
+
+        int q0[4], q1[4];
+        for (int c = 0; c < 4; c++) {
+            q0[c] = static_cast<int>(reader.Read(7));
+            q1[c] = static_cast<int>(reader.Read(7));
+        }
+        const int p0 = static_cast<int>(reader.Read(1));
+        const int p1 = static_cast<int>(reader.Read(1));
+
+        for (int i = 0; i < 16; i++) {
+            const int index = static_cast<int>(reader.Read(i == 0 ? 3 : 4));
+            const int w = kBc7Weights4[index];
+            for (int c = 0; c < 4; c++) {
+                const int a = (q0[c] << 1) | p0, b = (q1[c] << 1) | p1;
+                rgba[i * 4 + c] = static_cast<uint8_t>(((64 - w) * a + w * b + 32) >> 6);
+            }
+        }
+    }
+
+    void FetchBlock(const uint8_t* rgba, int width, int height, int bx, int by, uint8_t block[64]) {
+        for (int y = 0; y < 4; y++) {
+            const int sy = std::min(by * 4 + y, height - 1);
+            for (int x = 0; x < 4; x++) {
+                const int sx = std::min(bx * 4 + x, width - 1);
+                std::memcpy(block + (y * 4 + x) * 4, rgba + (static_cast<size_t>(sy) * width + sx) * 4, 4);
+            }
+        }
+    }
+}
+
+size_t BlockBytes(BlockFormat format) {
+    return (format == BlockFormat::BC1 || format == BlockFormat::BC4) ? 8 : 16;
+}
+
+const char* BlockFormatName(BlockFormat format) {
+    switch (format) {
+    case BlockFormat::BC1: return "bc1";
+    case BlockFormat::BC3: return "bc3";
+    case BlockFormat::BC4: return "bc4";
+    case BlockFormat::BC5: return "bc5";
+    case BlockFormat::BC7: return "bc7";
+    }
+    return "?";
+}
+
+bool ParseBlockFormat(const std::string& name, BlockFormat& outFormat) {
+    for (BlockFormat f : { BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC4, BlockFormat::BC5, BlockFormat::BC7 }) {
+        if (name == BlockFormatName(f)) {
+            outFormat = f;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t VkFormatFor(BlockFormat format, bool srgb) {
+    switch (format) {
+    case BlockFormat::BC1: return srgb ? 132 : 131; // VK_FORMAT_BC1_RGB_{SRGB,UNORM}_BLOCK
+    case BlockFormat::BC3: return srgb ? 138 : 137; // VK_FORMAT_BC3_{SRGB,UNORM}_BLOCK
+    case BlockFormat::BC4: return 139;              // VK_FORMAT_BC4_UNORM_BLOCK
+    case BlockFormat::BC5: return 141;              // VK_FORMAT_BC5_UNORM_BLOCK
+    case BlockFormat::BC7: return srgb ? 146 : 145; // VK_FORMAT_BC7_{SRGB,UNORM}_BLOCK
+    }
+    return 0;
+}
+
+bool BlockFormatFromVk(uint32_t vkFormat, BlockFormat& outFormat, bool& outSrgb) {
+    outSrgb = vkFormat == 132 || vkFormat == 138 || vkFormat == 146;
+    switch (vkFormat) {
+    case 131: case 132: outFormat = BlockFormat::BC1; return true;
+    case 137: case 138: outFormat = BlockFormat::BC3; return true;
+    case 139: outFormat = BlockFormat::BC4; return true;
+    case 141: outFormat = BlockFormat::BC5; return true;
+    case 145: case 146: outFormat = BlockFormat::BC7; return true;
+    default: return false;
+    }
+}
+
+void EncodeBlock(BlockFormat format, const uint8_t rgba[64], uint8_t* out) {
+    switch (format) {
+    case BlockFormat::BC1:
+        EncodeColorBlock(rgba, out);
+        break;
+    case BlockFormat::BC3:
+        EncodeChannelBlock(rgba, 3, out);
+        EncodeColorBlock(rgba, out + 8);
+        break;
+    case BlockFormat::BC4:
+        EncodeChannelBlock(rgba, 0, out);
+        break;
+    case BlockFormat::BC5:
+        EncodeChannelBlock(rgba, 0, out);
+        EncodeChannelBlock(rgba, 1, out + 8);
+        break;
+    case BlockFormat::BC7:
+        EncodeBc7Block(rgba, out);
+        break;
+    }
+}
+
+void DecodeBlock(BlockFormat format, const uint8_t* in, uint8_t rgba[64]) {
+    // Channels a format doesn't store decode like the GPU does: 0 for color, 255 for alpha
+    for (int i = 0; i < 16; i++) {
+        rgba[i * 4 + 0] = rgba[i * 4 + 1] = rgba[i * 4 + 2] = 0;
+        rgba[i * 4 + 3] = 255;
+    }
+
+    switch (format) {
+    case BlockFormat::BC1:
+        DecodeColorBlock(in, rgba, false);
+        break;
+    case BlockFormat::BC3:
+        DecodeColorBlock(in + 8, rgba, true);
+        DecodeChannelBlock(in, rgba, 3);
+        break;
+    case BlockFormat::BC4:
+        DecodeChannelBlock(in, rgba, 0);
+        break;
+    case BlockFormat::BC5:
+        DecodeChannelBlock(in, rgba, 0);
+        DecodeChannelBlock(in + 8, rgba, 1);
+        break;
+    case BlockFormat::BC7:
+        DecodeBc7Block(in, rgba);
+        break;
+    }
+}
+
+size_t CompressedSize(BlockFormat format, int width, int height) {
+    const size_t blocksX = (std::max(width, 1) + 3) / 4;
+    const size_t blocksY = (std::max(height, 1) + 3) / 4;
+    return blocksX * blocksY * BlockBytes(format);
+}
+
+std::vector<uint8_t> CompressSurface(BlockFormat format, const uint8_t* rgba, int width, int height) {
+    const int blocksX = (width + 3) / 4;
+    const int blocksY = (height + 3) / 4;
+    const size_t blockBytes = BlockBytes(format);
+    std::vector<uint8_t> out(CompressedSize(format, width, height));
+
+    ParallelFor(static_cast<size_t>(blocksY), [&](size_t by) {
+        uint8_t block[64];
+        for (int bx = 0; bx < blocksX; bx++) {
+            FetchBlock(rgba, width, height, bx, static_cast<int>(by), block);
+            EncodeBlock(format, block, &out[(by * blocksX + bx) * blockBytes]);
+        }
+    });
+    return out;
+}
+
+std::vector<uint8_t> DecompressSurface(BlockFormat format, const uint8_t* blocks, int width, int height) {
+    const int blocksX = (width + 3) / 4;
+    const int blocksY = (height + 3) / 4;
+    const size_t blockBytes = BlockBytes(format);
+    std::vector<uint8_t> out(static_cast<size_t>(width) * height * 4);
+
+    uint8_t block[64];
+    for (int by = 0; by < blocksY; by++) {
+        for (int bx = 0; bx < blocksX; bx++) {
+            DecodeBlock(format, blocks + (static_cast<size_t>(by) * blocksX + bx) * blockBytes, block);
+            for (int y = 0; y < 4 && by * 4 + y < height; y++) {
+                for (int x = 0; x < 4 && bx * 4 + x < width; x++) {
+                    std::memcpy(&out[(static_cast<size_t>(by * 4 + y) * width + bx * 4 + x) * 4], block + (y * 4 + x) * 4, 4);
+                }
+            }
+        }
+    }
+    return out;
+}
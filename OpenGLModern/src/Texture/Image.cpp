@@ -0,0 +1,44 @@
+#include <Texture/Image.hpp>
+#include <iostream>
+#include <cstring>
+
+// Define this ONLY in one cpp file (like here) to include the implementation
+#define STB_IMAGE_IMPLEMENTATION
+#include <STB/stb_image.h>
+
+namespace {
+    Image TakeStbResult(unsigned char* data, int width, int height, int channels) {
+        Image image;
+        if (!data) return image;
+
+        image.width = width;
+        image.height = height;
+        image.channels = channels;
+        image.pixels.assign(data, data + static_cast<size_t>(width) * height * channels);
+        stbi_image_free(data);
+        return image;
+    }
+}
+
+Image LoadImageFromFile(const char* path, bool flipVertically) {
+    // The _thread variant only affects the calling thread, so workers don't race on the flag
+    stbi_set_flip_vertically_on_load_thread(flipVertically);
+
+    int width, height, channels;
+    unsigned char* data = stbi_load(path, &width, &height, &channels, 0);
+    if (!data) {
+        std::cerr << "Failed to load image: " << path << " (" << stbi_failure_reason() << ")" << std::endl;
+    }
+    return TakeStbResult(data, width, height, channels);
+}
+
+Image LoadImageFromMemory(const unsigned char* bytes, size_t size, bool flipVertically) {
+    stbi_set_flip_vertically_on_load_thread(flipVertically);
+
+    int width, height, channels;
+    unsigned char* data = stbi_load_from_memory(bytes, static_cast<int>(size), &width, &height, &channels, 0);
+    if (!data) {
+        std::cerr << "Failed to decode image from memory (" << stbi_failure_reason() << ")" << std::endl;
+    }
+    return TakeStbResult(data, width, height, channels);
+}
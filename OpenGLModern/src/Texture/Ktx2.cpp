@@ -0,0 +1,128 @@
+#include <Texture/Ktx2.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+    constexpr uint8_t kIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    // Everything up to (not including) the level index
+    struct Header {
+        uint8_t identifier[12];
+        uint32_t vkFormat;
+        uint32_t typeSize;
+        uint32_t pixelWidth;
+        uint32_t pixelHeight;
+        uint32_t pixelDepth;
+        uint32_t layerCount;
+        uint32_t faceCount;
+        uint32_t levelCount;
+        uint32_t supercompressionScheme;
+        uint32_t dfdByteOffset;
+        uint32_t dfdByteLength;
+        uint32_t kvdByteOffset;
+        uint32_t kvdByteLength;
+        uint64_t sgdByteOffset;
+        uint64_t sgdByteLength;
+    };
+    static_assert(sizeof(Header) == 80, "KTX2 header must be 80 bytes");
+
+    struct LevelIndex {
+        uint64_t byteOffset;
+        uint64_t byteLength;
+        uint64_t uncompressedByteLength;
+    };
+
+    constexpr size_t kLevelAlignment = 16;
+
+    size_t AlignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+bool WriteKtx2(const std::string& path, uint32_t vkFormat, int width, int height,
+               const std::vector<std::vector<uint8_t>>& levels) {
+    if (levels.empty()) return false;
+
+    Header header{};
+    std::memcpy(header.identifier, kIdentifier, sizeof(kIdentifier));
+    header.vkFormat = vkFormat;
+    header.typeSize = 1;
+    header.pixelWidth = static_cast<uint32_t>(width);
+    header.pixelHeight = static_cast<uint32_t>(height);
+    header.faceCount = 1;
+    header.levelCount = static_cast<uint32_t>(levels.size());
+
+    // 1. Lay out the data: smallest mip first, each level aligned
+    std::vector<LevelIndex> index(levels.size());
+    size_t offset = sizeof(Header) + sizeof(LevelIndex) * levels.size();
+    for (size_t i = levels.size(); i-- > 0;) {
+        offset = AlignUp(offset, kLevelAlignment);
+        index[i] = { offset, levels[i].size(), levels[i].size() };
+        offset += levels[i].size();
+    }
+
+    // 2. Write header, index, then the padded level data
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "ERROR::KTX2::CANNOT_OPEN_FOR_WRITE " << path << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(index.data()), sizeof(LevelIndex) * index.size());
+
+    size_t written = sizeof(Header) + sizeof(LevelIndex) * index.size();
+    const char padding[kLevelAlignment] = {};
+    for (size_t i = levels.size(); i-- > 0;) {
+        file.write(padding, static_cast<std::streamsize>(index[i].byteOffset - written));
+        file.write(reinterpret_cast<const char*>(levels[i].data()), static_cast<std::streamsize>(levels[i].size()));
+        written = index[i].byteOffset + levels[i].size();
+    }
+    return static_cast<bool>(file);
+}
+
+bool ParseKtx2(const uint8_t* bytes, size_t size, Ktx2Texture& outTexture) {
+    if (size < sizeof(Header)) return false;
+
+    Header header;
+    std::memcpy(&header, bytes, sizeof(header));
+    if (std::memcmp(header.identifier, kIdentifier, sizeof(kIdentifier)) != 0) return false;
+
+    // Only plain 2D textures without supercompression
+    if (header.pixelDepth != 0 || header.layerCount > 1 || header.faceCount != 1 ||
+        header.supercompressionScheme != 0 || header.pixelWidth == 0 || header.pixelHeight == 0) {
+        std::cerr << "ERROR::KTX2::UNSUPPORTED_LAYOUT" << std::endl;
+        return false;
+    }
+
+    // A chain never has more levels than halvings of the larger side (and width >> 32 is UB)
+    const uint32_t levelCount = std::max(header.levelCount, 1u);
+    if (levelCount > static_cast<uint32_t>(std::bit_width(std::max(header.pixelWidth, header.pixelHeight)))) {
+        std::cerr << "ERROR::KTX2::TOO_MANY_LEVELS " << levelCount << std::endl;
+        return false;
+    }
+    if (size < sizeof(Header) + sizeof(LevelIndex) * levelCount) return false;
+
+    outTexture.vkFormat = header.vkFormat;
+    outTexture.width = static_cast<int>(header.pixelWidth);
+    outTexture.height = static_cast<int>(header.pixelHeight);
+    outTexture.levels.resize(levelCount);
+
+    for (uint32_t i = 0; i < levelCount; i++) {
+        LevelIndex level;
+        std::memcpy(&level, bytes + sizeof(Header) + sizeof(LevelIndex) * i, sizeof(level));
+        if (level.byteOffset > size || level.byteLength > size - level.byteOffset) {
+            std::cerr << "ERROR::KTX2::LEVEL_OUT_OF_RANGE " << i << std::endl;
+            return false;
+        }
+
+        Ktx2Level& out = outTexture.levels[i];
+        out.data = bytes + level.byteOffset;
+        out.size = static_cast<size_t>(level.byteLength);
+        out.width = std::max(1, outTexture.width >> i);
+        out.height = std::max(1, outTexture.height >> i);
+    }
+    return true;
+}
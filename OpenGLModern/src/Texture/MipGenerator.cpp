@@ -0,0 +1,381 @@
+#include <Texture/MipGenerator.hpp>
+#include <Engine/Utils/SimdMath.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace {
+
+    // ==========================================
+    // Filter kernels (x in destination texels)
+    // ==========================================
+
+    constexpr float kPi = 3.14159265358979f;
+    constexpr float kKaiserAlpha = 4.0f;
+    constexpr float kSincRadius = 3.0f;
+
+    float Sinc(float x) {
+        x = std::abs(x) * kPi;
+        return x < 1e-5f ? 1.0f : std::sin(x) / x;
+    }
+
+    // Modified Bessel function of the first kind, order 0 (series expansion)
+    float BesselI0(float x) {
+        float sum = 1.0f, term = 1.0f;
+        const float halfSq = x * x * 0.25f;
+        for (int k = 1; k < 32 && term > sum * 1e-8f; k++) {
+            term *= halfSq / static_cast<float>(k * k);
+            sum += term;
+        }
+        return sum;
+    }
+
+    float FilterSupport(MipFilter filter) {
+        return filter == MipFilter::Box ? 0.5f : kSincRadius;
+    }
+
+    float FilterWeight(MipFilter filter, float x) {
+        x = std::abs(x);
+        switch (filter) {
+        case MipFilter::Box:
+            return x <= 0.5f ? 1.0f : 0.0f;
+        case MipFilter::Kaiser: {
+            if (x >= kSincRadius) return 0.0f;
+            const float t = x / kSincRadius;
+            return Sinc(x) * BesselI0(kKaiserAlpha * std::sqrt(1.0f - t * t)) / BesselI0(kKaiserAlpha);
+        }
+        case MipFilter::Lanczos:
+            return x < kSincRadius ? Sinc(x) * Sinc(x / kSincRadius) : 0.0f;
+        }
+        return 0.0f;
+    }
+
+    // Per destination texel: a contiguous run of source texels and their weights.
+    // Taps past the edge are folded into the edge texel (clamp), so kernels never branch on bounds.
+    struct FilterTable {
+        int stride = 0;
+        std::vector<int> first;
+        std::vector<int> count;
+        std::vector<float> weights; // dstSize * stride
+    };
+
+    FilterTable BuildFilterTable(int srcSize, int dstSize, MipFilter filter) {
+        const float scale = static_cast<float>(srcSize) / static_cast<float>(dstSize);
+        const float support = FilterSupport(filter) * scale;
+
+        FilterTable table;
+        table.stride = static_cast<int>(std::ceil(support * 2.0f)) + 2;
+        table.first.resize(dstSize);
+        table.count.resize(dstSize);
+        table.weights.assign(static_cast<size_t>(dstSize) * table.stride, 0.0f);
+
+        for (int i = 0; i < dstSize; i++) {
+            const float center = (i + 0.5f) * scale;
+            const int lo = static_cast<int>(std::floor(center - support));
+            const int hi = static_cast<int>(std::ceil(center + support));
+            const int first = std::clamp(lo, 0, srcSize - 1);
+            const int last = std::clamp(hi, 0, srcSize - 1);
+            float* weights = &table.weights[static_cast<size_t>(i) * table.stride];
+
+            float sum = 0.0f;
+            for (int j = lo; j <= hi; j++) {
+                const float w = FilterWeight(filter, (j + 0.5f - center) / scale);
+                weights[std::clamp(j, 0, srcSize - 1) - first] += w;
+                sum += w;
+            }
+            if (std::abs(sum) < 1e-6f) {
+                // Degenerate (can't happen for our kernels): nearest texel
+                std::fill(weights, weights + table.stride, 0.0f);
+                weights[std::clamp(static_cast<int>(center), first, last) - first] = 1.0f;
+                sum = 1.0f;
+            }
+            for (int k = 0; k <= last - first; k++) weights[k] /= sum;
+
+            // Drop zero taps at both ends (the kernel's zero crossings land on texel centers)
+            int begin = 0, end = last - first + 1;
+            while (end - begin > 1 && weights[begin] == 0.0f) begin++;
+            while (end - begin > 1 && weights[end - 1] == 0.0f) end--;
+            std::copy(weights + begin, weights + end, weights);
+            std::fill(weights + (end - begin), weights + table.stride, 0.0f);
+
+            table.first[i] = first + begin;
+            table.count[i] = end - begin;
+        }
+        return table;
+    }
+
+    // ==========================================
+    // Kernels: pixels are 4 floats, rows tightly packed
+    // ==========================================
+
+    // Horizontal: dst[x] = sum w * src[first + k]
+    void FilterRowScalar(const float* src, const FilterTable& table, float* dst, int dstWidth) {
+        for (int x = 0; x < dstWidth; x++) {
+            const float* weights = &table.weights[static_cast<size_t>(x) * table.stride];
+            const float* p = src + static_cast<size_t>(table.first[x]) * 4;
+            float acc[4] = {};
+            for (int k = 0; k < table.count[x]; k++) {
+                for (int c = 0; c < 4; c++) acc[c] += weights[k] * p[k * 4 + c];
+            }
+            for (int c = 0; c < 4; c++) dst[x * 4 + c] = acc[c];
+        }
+    }
+
+    // Vertical: dst = sum w * rows[k]
+    void FilterColumnScalar(const float* const* rows, const float* weights, int count, float* dst, size_t rowFloats) {
+        std::fill(dst, dst + rowFloats, 0.0f);
+        for (int k = 0; k < count; k++) {
+            for (size_t i = 0; i < rowFloats; i++) dst[i] += weights[k] * rows[k][i];
+        }
+    }
+
+#ifdef ENGINE_SIMD_SSE
+    // One pixel is one __m128; with AVX2 two neighbouring taps go through one 256-bit FMA
+    void FilterRowSimd(const float* src, const FilterTable& table, float* dst, int dstWidth) {
+        for (int x = 0; x < dstWidth; x++) {
+            const float* weights = &table.weights[static_cast<size_t>(x) * table.stride];
+            const float* p = src + static_cast<size_t>(table.first[x]) * 4;
+            const int count = table.count[x];
+            int k = 0;
+            __m128 acc = _mm_setzero_ps();
+#ifdef ENGINE_SIMD_AVX2
+            __m256 acc2 = _mm256_setzero_ps();
+            for (; k + 1 < count; k += 2) {
+                const __m256 w = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(weights[k])),
+                                                      _mm_set1_ps(weights[k + 1]), 1);
+                acc2 = _mm256_fmadd_ps(w, _mm256_loadu_ps(p + k * 4), acc2);
+            }
+            acc = _mm_add_ps(_mm256_castps256_ps128(acc2), _mm256_extractf128_ps(acc2, 1));
+#endif
+            for (; k < count; k++) {
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(p + k * 4)));
+            }
+            _mm_storeu_ps(dst + x * 4, acc);
+        }
+    }
+
+    void FilterColumnSimd(const float* const* rows, const float* weights, int count, float* dst, size_t rowFloats) {
+        // Accumulate in registers across taps, one store per output vector
+        size_t i = 0;
+#ifdef ENGINE_SIMD_AVX2
+        for (; i + 8 <= rowFloats; i += 8) {
+            __m256 acc = _mm256_setzero_ps();
+            for (int k = 0; k < count; k++) {
+                acc = _mm256_fmadd_ps(_mm256_set1_ps(weights[k]), _mm256_loadu_ps(rows[k] + i), acc);
+            }
+            _mm256_storeu_ps(dst + i, acc);
+        }
+#endif
+        for (; i < rowFloats; i += 4) {
+            __m128 acc = _mm_setzero_ps();
+            for (int k = 0; k < count; k++) {
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(rows[k] + i)));
+            }
+            _mm_storeu_ps(dst + i, acc);
+        }
+    }
+#endif
+
+    // ==========================================
+    // Color space conversion
+    // ==========================================
+
+    float SrgbToLinear(float v) {
+        return v <= 0.04045f ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+    }
+
+    float LinearToSrgb(float v) {
+        return v <= 0.0031308f ? v * 12.92f : 1.055f * std::pow(v, 1.0f / 2.4f) - 0.055f;
+    }
+
+    // Byte -> float for sRGB encoded and for linear channels
+    struct DecodeTables {
+        std::array<float, 256> srgb;
+        std::array<float, 256> linear;
+    };
+
+    const DecodeTables& Decode() {
+        static const DecodeTables tables = [] {
+            DecodeTables t{};
+            for (int i = 0; i < 256; i++) {
+                t.srgb[i] = SrgbToLinear(i / 255.0f);
+                t.linear[i] = i / 255.0f;
+            }
+            return t;
+        }();
+        return tables;
+    }
+
+    // Linear [0,1] quantized to 4096 steps -> sRGB byte; finer than one output step everywhere
+    constexpr int kEncodeSteps = 4096;
+    const std::array<unsigned char, kEncodeSteps>& EncodeTable() {
+        static const std::array<unsigned char, kEncodeSteps> table = [] {
+            std::array<unsigned char, kEncodeSteps> t{};
+            for (int i = 0; i < kEncodeSteps; i++) {
+                t[i] = static_cast<unsigned char>(std::lround(LinearToSrgb(i / float(kEncodeSteps - 1)) * 255.0f));
+            }
+            return t;
+        }();
+        return table;
+    }
+
+    struct Layout {
+        int channels = 0;
+        int colorChannels = 0; // leading channels stored as sRGB
+        int alphaChannel = -1;
+    };
+
+    Layout MakeLayout(const Image& image, const MipSettings& settings) {
+        Layout layout;
+        layout.channels = image.channels;
+        layout.colorChannels = (settings.srgb && image.channels >= 3) ? 3 : 0;
+        if (image.channels == 4) layout.alphaChannel = 3;
+        if (image.channels == 2) layout.alphaChannel = 1; // grey + alpha
+        return layout;
+    }
+
+    // One row of the 8-bit base level -> linear float RGBA
+    void DecodeRow(const Image& image, int y, const Layout& layout, float* out) {
+        const DecodeTables& tables = Decode();
+        const float* lut[4];
+        for (int c = 0; c < 4; c++) lut[c] = c < layout.colorChannels ? tables.srgb.data() : tables.linear.data();
+
+        const unsigned char* p = &image.pixels[static_cast<size_t>(y) * image.width * layout.channels];
+        for (int x = 0; x < image.width; x++, p += layout.channels) {
+            for (int c = 0; c < 4; c++) out[x * 4 + c] = c < layout.channels ? lut[c][p[c]] : 0.0f;
+        }
+    }
+
+    Image FromLinear(const std::vector<float>& rgba, int width, int height, const Layout& layout, float alphaScale) {
+        const auto& encode = EncodeTable();
+        Image image;
+        image.width = width;
+        image.height = height;
+        image.channels = layout.channels;
+        const size_t texels = static_cast<size_t>(width) * height;
+        image.pixels.resize(texels * layout.channels);
+
+        float scale[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        if (layout.alphaChannel >= 0) scale[layout.alphaChannel] = alphaScale;
+
+        unsigned char* out = image.pixels.data();
+        for (size_t i = 0; i < texels; i++, out += layout.channels) {
+            const float* p = &rgba[i * 4];
+            int c = 0;
+            for (; c < layout.colorChannels; c++) {
+                out[c] = encode[static_cast<int>(std::clamp(p[c], 0.0f, 1.0f) * (kEncodeSteps - 1) + 0.5f)];
+            }
+            for (; c < layout.channels; c++) {
+                out[c] = static_cast<unsigned char>(std::clamp(p[c] * scale[c], 0.0f, 1.0f) * 255.0f + 0.5f);
+            }
+        }
+        return image;
+    }
+
+    // ==========================================
+    // Alpha coverage preservation
+    // ==========================================
+
+    float AlphaCoverage(const float* rgba, size_t texels, int alphaChannel, float cutoff, float scale) {
+        size_t passing = 0;
+        for (size_t i = 0; i < texels; i++) {
+            if (rgba[i * 4 + alphaChannel] * scale >= cutoff) passing++;
+        }
+        return static_cast<float>(passing) / static_cast<float>(texels);
+    }
+
+    float BaseAlphaCoverage(const Image& image, int alphaChannel, float cutoff) {
+        size_t passing = 0;
+        const size_t texels = static_cast<size_t>(image.width) * image.height;
+        for (size_t i = 0; i < texels; i++) {
+            if (image.pixels[i * image.channels + alphaChannel] / 255.0f >= cutoff) passing++;
+        }
+        return static_cast<float>(passing) / static_cast<float>(texels);
+    }
+
+    // Coverage grows with the scale, so binary search the scale that matches the target
+    float FindAlphaScale(const float* rgba, size_t texels, int alphaChannel, float cutoff, float targetCoverage) {
+        float lo = 0.0f, hi = 4.0f;
+        for (int iter = 0; iter < 16; iter++) {
+            const float mid = (lo + hi) * 0.5f;
+            if (AlphaCoverage(rgba, texels, alphaChannel, cutoff, mid) < targetCoverage) lo = mid;
+            else hi = mid;
+        }
+        return hi;
+    }
+}
+
+std::vector<Image> GenerateMipChain(const Image& base, const MipSettings& settings) {
+    std::vector<Image> levels;
+    if (!base.IsValid() || base.channels < 1 || base.channels > 4) return levels;
+
+    const Layout layout = MakeLayout(base, settings);
+    const bool preserveCoverage = settings.alphaCoverageCutoff > 0.0f && layout.alphaChannel >= 0;
+
+    auto filterRow = FilterRowScalar;
+    auto filterColumn = FilterColumnScalar;
+#ifdef ENGINE_SIMD_SSE
+    if (settings.useSimd) {
+        filterRow = FilterRowSimd;
+        filterColumn = FilterColumnSimd;
+    }
+#endif
+
+    const float targetCoverage = preserveCoverage
+        ? BaseAlphaCoverage(base, layout.alphaChannel, settings.alphaCoverageCutoff)
+        : 0.0f;
+
+    // current: previous level in linear float (the base level is decoded row by row instead)
+    // ring: horizontally filtered rows, only as many as the vertical filter needs at once
+    std::vector<float> current, next, ring, decodedRow(static_cast<size_t>(base.width) * 4);
+    std::vector<const float*> taps;
+    int width = base.width, height = base.height;
+    while (width > 1 || height > 1) {
+        const int nextWidth = std::max(1, width / 2);
+        const int nextHeight = std::max(1, height / 2);
+        const size_t rowFloats = static_cast<size_t>(nextWidth) * 4;
+
+        const FilterTable rowTable = BuildFilterTable(width, nextWidth, settings.filter);
+        const FilterTable columnTable = BuildFilterTable(height, nextHeight, settings.filter);
+        const int ringRows = columnTable.stride;
+        ring.resize(ringRows * rowFloats);
+        next.resize(nextHeight * rowFloats);
+        taps.resize(ringRows);
+
+        int filtered = 0; // source rows [0, filtered) went through the horizontal pass
+        for (int y = 0; y < nextHeight; y++) {
+            const int first = columnTable.first[y];
+            const int count = columnTable.count[y];
+
+            // 1. Horizontal pass for the source rows this output row needs (in order, each once)
+            for (; filtered < first + count; filtered++) {
+                const float* src;
+                if (levels.empty()) {
+                    DecodeRow(base, filtered, layout, decodedRow.data());
+                    src = decodedRow.data();
+                } else {
+                    src = current.data() + static_cast<size_t>(filtered) * width * 4;
+                }
+                filterRow(src, rowTable, ring.data() + (filtered % ringRows) * rowFloats, nextWidth);
+            }
+
+            // 2. Vertical pass over those rows
+            for (int k = 0; k < count; k++) taps[k] = ring.data() + ((first + k) % ringRows) * rowFloats;
+            filterColumn(taps.data(), &columnTable.weights[static_cast<size_t>(y) * columnTable.stride],
+                         count, next.data() + y * rowFloats, rowFloats);
+        }
+
+        // 3. Scale alpha for the stored level only; the next level filters the unscaled values
+        float alphaScale = 1.0f;
+        if (preserveCoverage) {
+            alphaScale = FindAlphaScale(next.data(), next.size() / 4, layout.alphaChannel,
+                                        settings.alphaCoverageCutoff, targetCoverage);
+        }
+
+        levels.push_back(FromLinear(next, nextWidth, nextHeight, layout, alphaScale));
+        current.swap(next);
+        width = nextWidth;
+        height = nextHeight;
+    }
+    return levels;
+}
@@ -0,0 +1,100 @@
+#include <Texture/StreamingPlanner.hpp>
+#include <algorithm>
+#include <numeric>
+
+size_t ResidentBytes(const StreamingEntry& entry, int top) {
+    size_t bytes = 0;
+    for (size_t level = static_cast<size_t>(std::max(top, 0)); level < entry.levelBytes.size(); level++) {
+        bytes += entry.levelBytes[level];
+    }
+    return bytes;
+}
+
+namespace {
+    // Picks the entry whose finest resident level is the best thing to drop, or -1.
+    // Unwanted levels (oldest request first) beat wanted ones; wanted levels may only be taken
+    // from textures requested before the one we're loading for.
+    int FindVictim(const std::vector<StreamingEntry>& entries, const std::vector<int>& target,
+                   size_t loading, uint64_t loadingFrame) {
+        int best = -1;
+        bool bestUnwanted = false;
+        for (size_t i = 0; i < entries.size(); i++) {
+            const StreamingEntry& entry = entries[i];
+            if (target[i] >= entry.tailLevel) continue; // nothing evictable
+
+            const bool unwanted = target[i] < entry.wantedTop;
+            if (i == loading && !unwanted) continue;
+            if (!unwanted && entry.lastRequestFrame >= loadingFrame) continue;
+
+            if (best < 0 || (unwanted && !bestUnwanted) ||
+                (unwanted == bestUnwanted && entry.lastRequestFrame < entries[best].lastRequestFrame)) {
+                best = static_cast<int>(i);
+                bestUnwanted = unwanted;
+            }
+        }
+        return best;
+    }
+}
+
+StreamingPlan PlanResidency(const std::vector<StreamingEntry>& entries, size_t budgetBytes, size_t uploadBudget) {
+    StreamingPlan plan;
+    plan.targetTop.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        plan.targetTop[i] = entries[i].residentTop;
+        plan.residentBytes += ResidentBytes(entries[i], entries[i].residentTop);
+        plan.wantedBytes += ResidentBytes(entries[i], std::min(entries[i].wantedTop, entries[i].tailLevel));
+    }
+
+    auto evictOne = [&](size_t loading, uint64_t loadingFrame) {
+        const int victim = FindVictim(entries, plan.targetTop, loading, loadingFrame);
+        if (victim < 0) return false;
+        const size_t bytes = entries[victim].levelBytes[plan.targetTop[victim]];
+        plan.targetTop[victim]++;
+        plan.residentBytes -= bytes;
+        plan.evictedBytes += bytes;
+        return true;
+    };
+
+    // 1. Budget shrank (or was exceeded): drop LRU levels until we fit, wanted or not
+    while (plan.residentBytes > budgetBytes && evictOne(entries.size(), UINT64_MAX)) {}
+
+    // 2. Loads, most recently requested first, then the biggest deficit
+    std::vector<size_t> order(entries.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        if (entries[a].lastRequestFrame != entries[b].lastRequestFrame) {
+            return entries[a].lastRequestFrame > entries[b].lastRequestFrame;
+        }
+        return entries[a].residentTop - entries[a].wantedTop > entries[b].residentTop - entries[b].wantedTop;
+    });
+
+    bool uploadsExhausted = false;
+    for (size_t i : order) {
+        const StreamingEntry& entry = entries[i];
+        while (!uploadsExhausted && plan.targetTop[i] > entry.wantedTop) {
+            const size_t bytes = entry.levelBytes[plan.targetTop[i] - 1];
+            if (plan.uploadBytes > 0 && plan.uploadBytes + bytes > uploadBudget) {
+                uploadsExhausted = true;
+                break;
+            }
+
+            bool fits = true;
+            while (plan.residentBytes + bytes > budgetBytes) {
+                if (!evictOne(i, entry.lastRequestFrame)) {
+                    fits = false;
+                    break;
+                }
+            }
+            if (!fits) break;
+
+            plan.targetTop[i]--;
+            plan.residentBytes += bytes;
+            plan.uploadBytes += bytes;
+        }
+    }
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (plan.targetTop[i] > entries[i].wantedTop) plan.starved++;
+    }
+    return plan;
+}
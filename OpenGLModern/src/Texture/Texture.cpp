@@ -1,14 +1,117 @@
 #include <Texture/Texture.hpp>
+#include <Texture/Image.hpp>
+#include <Texture/BlockCompression.hpp>
+#include <Texture/MipGenerator.hpp>
 #include <iostream>
+#include <algorithm>
 
-// Define this ONLY in one cpp file (like here) to include the implementation
-#define STB_IMAGE_IMPLEMENTATION
-#include <STB/stb_image.h>
+// S3TC isn't core GL (glad is generated without extensions), but every desktop driver exposes it
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+Texture::Texture(const char* imagePath) : Texture() {
+    // Load image, create texture and generate mipmaps
+    // OpenGL expects 0.0 y-axis on bottom, images usually have 0.0 at top. Flip it.
+    Image image = LoadImageFromFile(imagePath, true);
+    if (!image.IsValid()) {
+        std::cout << "Failed to load texture: " << imagePath << std::endl;
+        return;
+    }
+    Upload(image, GenerateMipChain(image));
+}
+
+Texture::Texture(const Image& image, const std::vector<Image>& mips) : Texture() {
+    if (image.IsValid()) {
+        Upload(image, mips);
+    }
+}
+
+Texture::Texture() : ID(0), width(0), height(0), nrChannels(0), levels(0), compressedFormat(GL_NONE), baseLevel(0) {}
+
+Texture::~Texture() {
+    if (ID) {
+        glDeleteTextures(1, &ID);
+    }
+}
+
+int Texture::MipLevelCount(int width, int height) {
+    int count = 1;
+    for (int size = std::max(width, height); size > 1; size >>= 1) {
+        count++;
+    }
+    return count;
+}
+
+GLenum Texture::PixelFormat(int channels) {
+    switch (channels) {
+    case 1: return GL_RED;
+    case 2: return GL_RG;
+    case 3: return GL_RGB;
+    case 4: return GL_RGBA;
+    default:
+        std::cerr << "BAD TEXTURE FORMAT" << std::endl;
+        return GL_RGBA;
+    }
+}
+
+GLenum Texture::InternalFormat(int channels) {
+    switch (channels) {
+    case 1: return GL_R8;
+    case 2: return GL_RG8;
+    case 3: return GL_RGB8;
+    default: return GL_RGBA8;
+    }
+}
+
+GLenum Texture::CompressedInternalFormat(uint32_t vkFormat) {
+    BlockFormat format;
+    bool srgb;
+    if (!BlockFormatFromVk(vkFormat, format, srgb)) return 0;
+
+    switch (format) {
+    case BlockFormat::BC1: return srgb ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    case BlockFormat::BC3: return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case BlockFormat::BC4: return GL_COMPRESSED_RED_RGTC1;
+    case BlockFormat::BC5: return GL_COMPRESSED_RG_RGTC2;
+    case BlockFormat::BC7: return srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GL_COMPRESSED_RGBA_BPTC_UNORM;
+    }
+    return 0;
+}
+
+void Texture::AllocateStorage(int w, int h, int channels) {
+    width = w;
+    height = h;
+    nrChannels = channels;
+    levels = MipLevelCount(w, h);
+    compressedFormat = GL_NONE;
+    CreateStorage(InternalFormat(channels));
+}
+
+void Texture::AllocateCompressedStorage(int w, int h, int levelCount, GLenum internalFormat) {
+    width = w;
+    height = h;
+    nrChannels = 0;
+    levels = levelCount;
+    compressedFormat = internalFormat;
+    CreateStorage(internalFormat);
+}
+
+void Texture::CreateStorage(GLenum internalFormat) {
+    if (ID) {
+        glDeleteTextures(1, &ID);
+    }
 
-Texture::Texture(const char* imagePath) {
     glGenTextures(1, &ID);
     glBindTexture(GL_TEXTURE_2D, ID);
-    std::cout << ID << std::endl;
+
+    // Immutable storage: size/format can't change, so the driver can skip completeness checks
+    glTexStorage2D(GL_TEXTURE_2D, levels, internalFormat, width, height);
 
     // Set texture wrapping parameters
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
@@ -17,34 +120,84 @@ Texture::Texture(const char* imagePath) {
     // Set texture filtering parameters
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
 
-    // Load image, create texture and generate mipmaps
-    // OpenGL expects 0.0 y-axis on bottom, images usually have 0.0 at top. Flip it.
-    stbi_set_flip_vertically_on_load(true);
-
-    unsigned char* data = stbi_load(imagePath, &width, &height, &nrChannels, 0);
-    GLenum format = GL_RGBA;
-    if (data) {
-       
-        if (nrChannels == 1)
-            format = GL_RED;
-        else if (nrChannels == 3) {
-            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-            format = GL_RGB;
-        }
-        else if (nrChannels == 4)
-            format = GL_RGBA;
-        else
-            std::cerr << "BAD TEXTURE FORMAT" << std::endl;
+void Texture::SetLevel(int level, int levelWidth, int levelHeight, const void* pixels) {
+    glBindTexture(GL_TEXTURE_2D, ID);
+    // Rows are tightly packed (3 channel rows are not 4-byte aligned)
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, levelWidth, levelHeight,
+                    PixelFormat(nrChannels), GL_UNSIGNED_BYTE, pixels);
+}
 
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
+void Texture::SetCompressedLevel(int level, int levelWidth, int levelHeight, const void* data, size_t size) {
+    glBindTexture(GL_TEXTURE_2D, ID);
+    glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, levelWidth, levelHeight,
+                              compressedFormat, static_cast<GLsizei>(size), data);
+}
+
+void Texture::GenerateMipmaps() {
+    glBindTexture(GL_TEXTURE_2D, ID);
+    glGenerateMipmap(GL_TEXTURE_2D);
+}
+
+void Texture::CreateStreamed(int w, int h, int levelCount, int channels, GLenum format) {
+    if (ID) {
+        glDeleteTextures(1, &ID);
     }
-    else {
-        std::cout << "Failed to load texture: " << imagePath << std::endl;
+
+    width = w;
+    height = h;
+    nrChannels = channels;
+    levels = levelCount;
+    compressedFormat = format;
+
+    // Mutable storage on purpose: levels that aren't resident take no memory
+    glGenTextures(1, &ID);
+    glBindTexture(GL_TEXTURE_2D, ID);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    SetResidentLevels(levelCount - 1, levelCount - 1);
+}
+
+void Texture::DefineLevel(int level, int levelWidth, int levelHeight, const void* data, size_t size) {
+    glBindTexture(GL_TEXTURE_2D, ID);
+    if (compressedFormat != GL_NONE) {
+        glCompressedTexImage2D(GL_TEXTURE_2D, level, compressedFormat, levelWidth, levelHeight, 0,
+                               static_cast<GLsizei>(size), data);
+    } else {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, level, InternalFormat(nrChannels), levelWidth, levelHeight, 0,
+                     PixelFormat(nrChannels), GL_UNSIGNED_BYTE, data);
     }
+}
 
-    stbi_image_free(data);
+void Texture::ReleaseLevel(int level) {
+    // A 0x0 image frees the level; its format doesn't matter outside BASE/MAX_LEVEL
+    glBindTexture(GL_TEXTURE_2D, ID);
+    glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+}
+
+void Texture::SetResidentLevels(int base, int maxLevel) {
+    baseLevel = base;
+    glBindTexture(GL_TEXTURE_2D, ID);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, base);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel);
+}
+
+void Texture::Upload(const Image& image, const std::vector<Image>& mips) {
+    AllocateStorage(image.width, image.height, image.channels);
+    SetLevel(0, width, height, image.pixels.data());
+
+    if (static_cast<int>(mips.size()) == levels - 1) {
+        for (size_t i = 0; i < mips.size(); i++) {
+            SetLevel(static_cast<int>(i) + 1, mips[i].width, mips[i].height, mips[i].pixels.data());
+        }
+    } else {
+        GenerateMipmaps();
+    }
     this->unbind();
 }
 
@@ -55,4 +208,4 @@ void Texture::bind(unsigned int slot) const {
 
 void Texture::unbind() const {
     glBindTexture(GL_TEXTURE_2D, 0);
-}
\ No newline at end of file
+}
@@ -0,0 +1,69 @@
+#include <Texture/TextureArray.hpp>
+#include <Texture/Texture.hpp>
+#include <Texture/Image.hpp>
+#include <algorithm>
+#include <iostream>
+
+TextureArray::TextureArray(int w, int h, int channels, int layerCount, int levelCount)
+    : ID(0), width(w), height(h), nrChannels(channels), layers(layerCount),
+      levels(levelCount > 0 ? std::min(levelCount, Texture::MipLevelCount(w, h)) : Texture::MipLevelCount(w, h)) {
+    glGenTextures(1, &ID);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, ID);
+
+    // Immutable storage for every layer and level up front
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY, levels, Texture::InternalFormat(channels), width, height, layers);
+
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, levels - 1);
+}
+
+TextureArray::~TextureArray() {
+    if (ID) {
+        glDeleteTextures(1, &ID);
+    }
+}
+
+void TextureArray::SetLayer(int layer, const Image& image, const std::vector<Image>& mips) {
+    if (image.width != width || image.height != height || image.channels != nrChannels) {
+        std::cerr << "ERROR::TEXTURE_ARRAY::LAYER_MISMATCH " << image.width << "x" << image.height
+                  << "x" << image.channels << std::endl;
+        return;
+    }
+
+    SetLayerLevel(layer, 0, image);
+    const int mipCount = std::min(static_cast<int>(mips.size()), levels - 1);
+    for (int i = 0; i < mipCount; i++) {
+        SetLayerLevel(layer, i + 1, mips[i]);
+    }
+}
+
+void TextureArray::SetLayerLevel(int layer, int level, const Image& image) {
+    glBindTexture(GL_TEXTURE_2D_ARRAY, ID);
+    // Rows are tightly packed (3 channel rows are not 4-byte aligned)
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, image.width, image.height, 1,
+                    Texture::PixelFormat(nrChannels), GL_UNSIGNED_BYTE, image.pixels.data());
+}
+
+void TextureArray::GenerateMipmaps() {
+    glBindTexture(GL_TEXTURE_2D_ARRAY, ID);
+    glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+}
+
+void TextureArray::SetWrap(GLenum wrap) {
+    glBindTexture(GL_TEXTURE_2D_ARRAY, ID);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, wrap);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, wrap);
+}
+
+void TextureArray::bind(unsigned int slot) const {
+    glActiveTexture(GL_TEXTURE0 + slot);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, ID);
+}
+
+void TextureArray::unbind() const {
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+}
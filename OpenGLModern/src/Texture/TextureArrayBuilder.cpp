@@ -0,0 +1,117 @@
+#include <Texture/TextureArrayBuilder.hpp>
+#include <Texture/MipGenerator.hpp>
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+size_t TextureArrayBuilder::Add(Image image, std::vector<Image> mips, bool allowAtlas) {
+    pending.push_back({ std::move(image), std::move(mips), allowAtlas });
+    return pending.size() - 1;
+}
+
+std::vector<TextureArrayBinding> TextureArrayBuilder::Build() {
+    return Build(Settings{});
+}
+
+std::vector<TextureArrayBinding> TextureArrayBuilder::Build(const Settings& settings) {
+    std::vector<TextureArrayBinding> bindings(pending.size());
+    stats = Stats{};
+
+    // 1. Group by (width, height, channels)
+    std::map<std::tuple<int, int, int>, std::vector<size_t>> groups;
+    for (size_t i = 0; i < pending.size(); i++) {
+        const Image& image = pending[i].image;
+        if (!image.IsValid()) continue;
+        groups[{ image.width, image.height, image.channels }].push_back(i);
+        stats.images++;
+    }
+
+    // Uploads `members` as layers of new arrays, maxLayers at a time
+    const size_t maxLayers = static_cast<size_t>(std::max(settings.maxLayers, 1));
+    auto uploadLayers = [&](const std::vector<size_t>& members) {
+        for (size_t first = 0; first < members.size(); first += maxLayers) {
+            const size_t count = std::min(maxLayers, members.size() - first);
+            const Image& front = pending[members[first]].image;
+            auto array = std::make_shared<TextureArray>(front.width, front.height, front.channels,
+                                                        static_cast<int>(count));
+            for (size_t layer = 0; layer < count; layer++) {
+                Pending& source = pending[members[first + layer]];
+                if (static_cast<int>(source.mips.size()) < array->levels - 1) {
+                    source.mips = GenerateMipChain(source.image);
+                }
+                array->SetLayer(static_cast<int>(layer), source.image, source.mips);
+                bindings[members[first + layer]] = { array, static_cast<int>(layer), glm::vec4(1, 1, 0, 0) };
+            }
+            array->unbind();
+            stats.arrays++;
+        }
+    };
+
+    // 2. Big enough groups become arrays of whole layers, the rest is left over for the atlas
+    std::map<int, std::vector<size_t>> leftoversByChannels;
+    for (auto& [key, members] : groups) {
+        if (static_cast<int>(members.size()) >= settings.minLayers || !settings.useAtlas) {
+            uploadLayers(members);
+            stats.layerImages += static_cast<uint32_t>(members.size());
+            continue;
+        }
+        for (size_t index : members) {
+            if (pending[index].allowAtlas) {
+                leftoversByChannels[std::get<2>(key)].push_back(index);
+            } else {
+                uploadLayers({ index });
+                stats.layerImages++;
+            }
+        }
+    }
+
+    // 3. Atlas pages per channel count, all pages of one atlas are layers of one array
+    size_t occupiedPages = 0;
+    for (auto& [channels, members] : leftoversByChannels) {
+        std::vector<glm::ivec2> sizes;
+        std::vector<AtlasImage> images;
+        for (size_t index : members) {
+            sizes.push_back({ pending[index].image.width, pending[index].image.height });
+            images.push_back({ &pending[index].image, &pending[index].mips });
+        }
+
+        const AtlasLayout layout = PackAtlas(sizes, settings.atlas);
+        std::vector<size_t> tooBig;
+        for (size_t i = 0; i < members.size(); i++) {
+            if (layout.entries[i].page < 0) tooBig.push_back(members[i]);
+        }
+        for (size_t index : tooBig) uploadLayers({ index });
+        stats.layerImages += static_cast<uint32_t>(tooBig.size());
+        if (layout.pageCount == 0) continue;
+
+        const std::vector<std::vector<Image>> pages = ComposeAtlas(layout, images, channels);
+        for (size_t first = 0; first < pages.size(); first += maxLayers) {
+            const size_t count = std::min(maxLayers, pages.size() - first);
+            auto array = std::make_shared<TextureArray>(layout.pageWidth, layout.pageHeight, channels,
+                                                        static_cast<int>(count), layout.levelCount);
+            // Nothing may wrap into the neighbouring cell
+            array->SetWrap(GL_CLAMP_TO_EDGE);
+            for (size_t layer = 0; layer < count; layer++) {
+                const std::vector<Image>& levels = pages[first + layer];
+                array->SetLayer(static_cast<int>(layer), levels[0],
+                                std::vector<Image>(levels.begin() + 1, levels.end()));
+            }
+            array->unbind();
+            stats.arrays++;
+
+            for (size_t i = 0; i < members.size(); i++) {
+                const AtlasEntry& entry = layout.entries[i];
+                if (entry.page < static_cast<int>(first) || entry.page >= static_cast<int>(first + count)) continue;
+                bindings[members[i]] = { array, entry.page - static_cast<int>(first), entry.uvTransform };
+                stats.atlasImages++;
+            }
+        }
+        stats.atlasPages += static_cast<uint32_t>(layout.pageCount);
+        stats.atlasOccupancy += layout.occupancy * layout.pageCount;
+        occupiedPages += layout.pageCount;
+    }
+    if (occupiedPages) stats.atlasOccupancy /= static_cast<float>(occupiedPages);
+
+    pending.clear();
+    return bindings;
+}
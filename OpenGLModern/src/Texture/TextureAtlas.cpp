@@ -0,0 +1,181 @@
+#include <Texture/TextureAtlas.hpp>
+#include <Texture/MipGenerator.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+
+namespace {
+    int AlignUp(int value, int alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    int NextPowerOfTwo(int value) {
+        int result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+
+    int Log2(int value) {
+        int result = 0;
+        while ((1 << (result + 1)) <= value) result++;
+        return result;
+    }
+
+    // Cell = image + gutter on every side, rounded up to the grid
+    glm::ivec2 CellSize(int width, int height, int gutter) {
+        return { AlignUp(width + 2 * gutter, gutter), AlignUp(height + 2 * gutter, gutter) };
+    }
+
+    // Copies src into its cell at (imageX, imageY) and fills the rest of the cell by clamping
+    // to the image's edge texels
+    void BlitCell(const Image& src, Image& page, int cellX, int cellY, int cellWidth, int cellHeight,
+                  int imageX, int imageY) {
+        const size_t c = static_cast<size_t>(page.channels);
+        const size_t rowBytes = static_cast<size_t>(src.width) * c;
+        for (int y = cellY; y < cellY + cellHeight; y++) {
+            const int sourceY = std::clamp(y - imageY, 0, src.height - 1);
+            const unsigned char* sourceRow = src.pixels.data() + static_cast<size_t>(sourceY) * rowBytes;
+            unsigned char* row = page.pixels.data() + static_cast<size_t>(y) * page.width * c;
+
+            for (int x = cellX; x < imageX; x++) {
+                std::memcpy(row + x * c, sourceRow, c);
+            }
+            std::memcpy(row + imageX * c, sourceRow, rowBytes);
+            const unsigned char* lastTexel = sourceRow + rowBytes - c;
+            for (int x = imageX + src.width; x < cellX + cellWidth; x++) {
+                std::memcpy(row + x * c, lastTexel, c);
+            }
+        }
+    }
+}
+
+AtlasLayout PackAtlas(const std::vector<glm::ivec2>& sizes, const AtlasSettings& settings) {
+    AtlasLayout layout;
+    layout.entries.resize(sizes.size());
+    layout.gutter = NextPowerOfTwo(std::max(settings.gutter, 1));
+    const int gutter = layout.gutter;
+    const int pageSize = AlignUp(settings.pageSize, gutter);
+
+    // 1. Tallest cells first so every shelf is as tall as its first cell
+    std::vector<size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        if (sizes[a].y != sizes[b].y) return sizes[a].y > sizes[b].y;
+        return sizes[a].x > sizes[b].x;
+    });
+
+    struct Shelf {
+        int page, y, height, usedWidth;
+    };
+    std::vector<Shelf> shelves;
+    std::vector<int> pageUsedHeight;
+    size_t imageTexels = 0;
+
+    // 2. First shelf with room, else a new shelf on the first page with room, else a new page
+    for (size_t index : order) {
+        const glm::ivec2 size = sizes[index];
+        if (size.x <= 0 || size.y <= 0) continue;
+        const glm::ivec2 cell = CellSize(size.x, size.y, gutter);
+        if (cell.x > pageSize || cell.y > pageSize) continue;
+
+        Shelf* target = nullptr;
+        for (Shelf& shelf : shelves) {
+            if (shelf.height >= cell.y && shelf.usedWidth + cell.x <= pageSize) {
+                target = &shelf;
+                break;
+            }
+        }
+        if (!target) {
+            int page = 0;
+            while (page < static_cast<int>(pageUsedHeight.size()) && pageUsedHeight[page] + cell.y > pageSize) {
+                page++;
+            }
+            if (page == static_cast<int>(pageUsedHeight.size())) pageUsedHeight.push_back(0);
+            shelves.push_back({ page, pageUsedHeight[page], cell.y, 0 });
+            pageUsedHeight[page] += cell.y;
+            target = &shelves.back();
+        }
+
+        AtlasEntry& entry = layout.entries[index];
+        entry.page = target->page;
+        entry.x = target->usedWidth + gutter;
+        entry.y = target->y + gutter;
+        entry.width = size.x;
+        entry.height = size.y;
+        target->usedWidth += cell.x;
+        imageTexels += static_cast<size_t>(size.x) * size.y;
+    }
+
+    layout.pageCount = static_cast<int>(pageUsedHeight.size());
+    if (layout.pageCount == 0) return layout;
+
+    // 3. A lone page only needs to cover what's on it (power of two keeps the mip chain even)
+    layout.pageWidth = pageSize;
+    layout.pageHeight = pageSize;
+    if (layout.pageCount == 1) {
+        int usedWidth = 0;
+        for (const Shelf& shelf : shelves) usedWidth = std::max(usedWidth, shelf.usedWidth);
+        layout.pageWidth = std::min(NextPowerOfTwo(usedWidth), pageSize);
+        layout.pageHeight = std::min(NextPowerOfTwo(pageUsedHeight[0]), pageSize);
+    }
+
+    const float invWidth = 1.0f / layout.pageWidth;
+    const float invHeight = 1.0f / layout.pageHeight;
+    for (AtlasEntry& entry : layout.entries) {
+        if (entry.page < 0) continue;
+        entry.uvTransform = glm::vec4(entry.width * invWidth, entry.height * invHeight,
+                                      entry.x * invWidth, entry.y * invHeight);
+    }
+
+    const int pageLevels = Log2(std::max(layout.pageWidth, layout.pageHeight)) + 1;
+    layout.levelCount = std::min(Log2(gutter) + 1, pageLevels);
+    layout.occupancy = static_cast<float>(imageTexels) /
+        (static_cast<float>(layout.pageWidth) * layout.pageHeight * layout.pageCount);
+    return layout;
+}
+
+std::vector<std::vector<Image>> ComposeAtlas(const AtlasLayout& layout, const std::vector<AtlasImage>& images,
+                                             int channels) {
+    // 1. Blank pages, every level
+    std::vector<std::vector<Image>> pages(layout.pageCount);
+    for (auto& levels : pages) {
+        levels.resize(layout.levelCount);
+        for (int level = 0; level < layout.levelCount; level++) {
+            Image& image = levels[level];
+            image.width = std::max(1, layout.pageWidth >> level);
+            image.height = std::max(1, layout.pageHeight >> level);
+            image.channels = channels;
+            image.pixels.assign(static_cast<size_t>(image.width) * image.height * channels, 0);
+        }
+    }
+
+    // 2. Each image's own mips into its cell, level by level
+    const int gutter = layout.gutter;
+    for (size_t i = 0; i < images.size() && i < layout.entries.size(); i++) {
+        const AtlasEntry& entry = layout.entries[i];
+        const Image* base = images[i].image;
+        if (entry.page < 0 || !base || !base->IsValid()) continue;
+        if (base->channels != channels || base->width != entry.width || base->height != entry.height) {
+            std::cerr << "ERROR::TEXTURE_ATLAS::IMAGE_MISMATCH " << i << std::endl;
+            continue;
+        }
+
+        std::vector<Image> generated;
+        const std::vector<Image>* mips = images[i].mips;
+        if (layout.levelCount > 1 && (!mips || static_cast<int>(mips->size()) < layout.levelCount - 1)) {
+            generated = GenerateMipChain(*base);
+            mips = &generated;
+        }
+
+        const glm::ivec2 cell = CellSize(entry.width, entry.height, gutter);
+        const int cellX = entry.x - gutter;
+        const int cellY = entry.y - gutter;
+        for (int level = 0; level < layout.levelCount; level++) {
+            const Image& source = level == 0 ? *base : (*mips)[level - 1];
+            BlitCell(source, pages[entry.page][level], cellX >> level, cellY >> level,
+                     cell.x >> level, cell.y >> level, entry.x >> level, entry.y >> level);
+        }
+    }
+    return pages;
+}
@@ -0,0 +1,284 @@
+#include <Texture/TextureCache.hpp>
+#include <Texture/AsyncTextureLoader.hpp>
+#include <Texture/Image.hpp>
+#include <Texture/Ktx2.hpp>
+#include <Texture/MipGenerator.hpp>
+#include <Engine/Utils/Hash.hpp>
+#include <Engine/Utils/MappedFile.hpp>
+#include <filesystem>
+#include <iostream>
+#include <algorithm>
+#include <cctype>
+
+TextureCache::TextureCache() : state(std::make_shared<State>()) {}
+
+TextureCache::~TextureCache() = default;
+
+size_t TextureCache::EstimateResidentBytes(int width, int height, int channels) {
+    // 3 channel textures are padded to 4 bytes per texel by every driver we care about
+    const size_t bytesPerTexel = channels == 3 ? 4 : static_cast<size_t>(channels);
+    size_t total = 0;
+    for (int w = width, h = height; ; w = std::max(1, w / 2), h = std::max(1, h / 2)) {
+        total += static_cast<size_t>(w) * h * bytesPerTexel;
+        if (w == 1 && h == 1) break;
+    }
+    return total;
+}
+
+uint64_t TextureCache::HashImage(const Image& image) {
+    uint64_t h = HashBytes(image.pixels.data(), image.pixels.size());
+    const int dims[3] = { image.width, image.height, image.channels };
+    return HashBytes(dims, sizeof(dims), h);
+}
+
+std::string TextureCache::CanonicalPath(const std::string& path) {
+    std::error_code error;
+    std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+    return error ? path : canonical.generic_string();
+}
+
+bool TextureCache::IsCompressedContainer(const std::string& path) {
+    std::string extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".ktx2";
+}
+
+TextureHandle TextureCache::FindAlive(const std::unordered_map<std::string, uint64_t>& index, const std::string& key) const {
+    auto it = index.find(key);
+    if (it == index.end()) return nullptr;
+    auto entry = state->entries.find(it->second);
+    return entry != state->entries.end() ? entry->second.texture.lock() : nullptr;
+}
+
+TextureHandle TextureCache::FindAliveByHash(uint64_t hash) const {
+    auto it = state->idByHash.find(hash);
+    if (it == state->idByHash.end()) return nullptr;
+    auto entry = state->entries.find(it->second);
+    return entry != state->entries.end() ? entry->second.texture.lock() : nullptr;
+}
+
+TextureHandle TextureCache::Register(Texture* texture, const std::string& name, const std::string& path,
+                                     uint64_t contentHash, size_t residentBytes, uint64_t& outId) {
+    const uint64_t id = state->nextId++;
+    std::weak_ptr<State> weakState = state;
+
+    // Custom deleter: free the GL texture and drop the cache entry with the last reference
+    TextureHandle handle(texture, [weakState, id](Texture* t) {
+        delete t;
+        auto s = weakState.lock();
+        if (!s) return;
+
+        std::lock_guard<std::mutex> lock(s->mutex);
+        auto it = s->entries.find(id);
+        if (it == s->entries.end()) return;
+
+        const Entry& entry = it->second;
+        s->residentBytes -= entry.residentBytes;
+        auto byHash = s->idByHash.find(entry.contentHash);
+        if (byHash != s->idByHash.end() && byHash->second == id) s->idByHash.erase(byHash);
+        auto byPath = s->idByPath.find(entry.path);
+        if (byPath != s->idByPath.end() && byPath->second == id) s->idByPath.erase(byPath);
+        s->entries.erase(it);
+    });
+
+    Entry& entry = state->entries[id];
+    entry.texture = handle;
+    entry.name = name;
+    entry.path = path;
+    entry.contentHash = contentHash;
+    entry.residentBytes = residentBytes;
+    state->residentBytes += residentBytes;
+
+    if (contentHash) state->idByHash.emplace(contentHash, id);
+    if (!path.empty()) state->idByPath[path] = id;
+
+    outId = id;
+    return handle;
+}
+
+TextureHandle TextureCache::Load(const std::string& path) {
+    const std::string canonical = CanonicalPath(path);
+
+    // 1. Path hit: no file IO, no decode
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (TextureHandle texture = FindAlive(state->idByPath, canonical)) return texture;
+    }
+
+    if (IsCompressedContainer(path)) {
+        return LoadCompressed(path, canonical);
+    }
+
+    // 2. Decode, then dedupe by pixel content
+    Image image = LoadImageFromFile(path.c_str(), true);
+    if (!image.IsValid()) {
+        std::cout << "Failed to load texture: " << path << std::endl;
+        return nullptr;
+    }
+
+    const uint64_t hash = HashImage(image);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (TextureHandle texture = FindAliveByHash(hash)) {
+            auto it = state->idByHash.find(hash);
+            state->idByPath[canonical] = it->second;
+            return texture;
+        }
+    }
+
+    // GL upload outside the lock (deleters of other handles may need it)
+    Texture* texture = new Texture(image, GenerateMipChain(image));
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    uint64_t id;
+    return Register(texture, canonical, canonical, hash,
+                    EstimateResidentBytes(image.width, image.height, image.channels), id);
+}
+
+TextureHandle TextureCache::LoadCompressed(const std::string& path, const std::string& canonical) {
+    // 1. Map the file; the parsed levels point straight into the mapping
+    MappedFile file;
+    Ktx2Texture ktx;
+    if (!file.Open(path) || !ParseKtx2(file.Data(), file.Size(), ktx)) {
+        std::cout << "Failed to load compressed texture: " << path << std::endl;
+        return nullptr;
+    }
+
+    const GLenum internalFormat = Texture::CompressedInternalFormat(ktx.vkFormat);
+    if (!internalFormat) {
+        std::cerr << "ERROR::TEXTURE_CACHE::UNSUPPORTED_VK_FORMAT " << ktx.vkFormat << " in " << path << std::endl;
+        return nullptr;
+    }
+
+    // 2. Dedupe by the cooked bytes (same source cooked twice with the same settings)
+    const uint64_t hash = HashBytes(file.Data(), file.Size());
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (TextureHandle texture = FindAliveByHash(hash)) {
+            state->idByPath[canonical] = state->idByHash.find(hash)->second;
+            return texture;
+        }
+    }
+
+    // 3. Upload every level as is, no decode and no mip generation
+    Texture* texture = new Texture();
+    texture->AllocateCompressedStorage(ktx.width, ktx.height, static_cast<int>(ktx.levels.size()), internalFormat);
+    size_t residentBytes = 0;
+    for (size_t i = 0; i < ktx.levels.size(); i++) {
+        const Ktx2Level& level = ktx.levels[i];
+        texture->SetCompressedLevel(static_cast<int>(i), level.width, level.height, level.data, level.size);
+        residentBytes += level.size;
+    }
+    texture->unbind();
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    uint64_t id;
+    return Register(texture, canonical, canonical, hash, residentBytes, id);
+}
+
+TextureHandle TextureCache::LoadAsync(const std::string& path) {
+    if (IsCompressedContainer(path)) {
+        return Load(path);
+    }
+
+    const std::string canonical = CanonicalPath(path);
+
+    TextureHandle handle;
+    uint64_t id;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (TextureHandle texture = FindAlive(state->idByPath, canonical)) return texture;
+
+        // Empty placeholder; size and content hash are filled in after the decode
+        handle = Register(new Texture(), canonical, canonical, 0, 0, id);
+    }
+
+    if (!loader) {
+        loader = std::make_unique<AsyncTextureLoader>();
+    }
+    loader->Enqueue({ id, path, handle, MipSettings{} });
+    return handle;
+}
+
+void TextureCache::ProcessUploads(size_t byteBudget) {
+    if (!loader) return;
+
+    for (const auto& uploaded : loader->UploadFinished(byteBudget)) {
+        if (uploaded.failed) continue;
+
+        std::lock_guard<std::mutex> lock(state->mutex);
+        auto it = state->entries.find(uploaded.id);
+        if (it == state->entries.end()) continue;
+
+        Entry& entry = it->second;
+        entry.contentHash = uploaded.contentHash;
+        entry.residentBytes = EstimateResidentBytes(uploaded.width, uploaded.height, uploaded.channels);
+        state->residentBytes += entry.residentBytes;
+
+        // Same pixels as a live texture (another file, or loaded meanwhile): the handles already
+        // given out keep this copy, later loads of the path get the original like Load() does.
+        // No weak_ptr lock here: dropping the last reference under the mutex would deadlock.
+        auto original = state->entries.end();
+        if (auto byHash = state->idByHash.find(uploaded.contentHash); byHash != state->idByHash.end()) {
+            original = state->entries.find(byHash->second);
+        }
+        if (original != state->entries.end() && original->first != uploaded.id && !original->second.texture.expired()) {
+            entry.duplicate = true;
+            if (!entry.path.empty()) state->idByPath[entry.path] = original->first;
+            continue;
+        }
+        // Later loads of identical pixels can share this one
+        state->idByHash[uploaded.contentHash] = uploaded.id;
+    }
+}
+
+TextureHandle TextureCache::FromImage(const Image& image, const std::string& name, const std::vector<Image>& mips) {
+    if (!image.IsValid()) return nullptr;
+
+    const uint64_t hash = HashImage(image);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (TextureHandle texture = FindAliveByHash(hash)) return texture;
+    }
+
+    Texture* texture = new Texture(image, mips);
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    uint64_t id;
+    return Register(texture, name, "", hash,
+                    EstimateResidentBytes(image.width, image.height, image.channels), id);
+}
+
+size_t TextureCache::GetTextureCount() const {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->entries.size();
+}
+
+size_t TextureCache::GetResidentBytes() const {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->residentBytes;
+}
+
+size_t TextureCache::GetDuplicateBytes() const {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    size_t total = 0;
+    for (const auto& [id, entry] : state->entries) {
+        if (entry.duplicate) total += entry.residentBytes;
+    }
+    return total;
+}
+
+size_t TextureCache::GetPendingCount() const {
+    return loader ? loader->GetPendingCount() : 0;
+}
+
+std::vector<TextureCache::TextureInfo> TextureCache::GetTextureInfo() const {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    std::vector<TextureInfo> info;
+    info.reserve(state->entries.size());
+    for (const auto& [id, entry] : state->entries) {
+        info.push_back({ entry.name, entry.contentHash, entry.residentBytes, entry.texture.use_count(), entry.duplicate });
+    }
+    return info;
+}
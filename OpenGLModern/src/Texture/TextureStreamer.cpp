@@ -0,0 +1,258 @@
+#include <Texture/TextureStreamer.hpp>
+#include <Texture/Image.hpp>
+#include <Texture/Ktx2.hpp>
+#include <Texture/MipGenerator.hpp>
+#include <Engine/Utils/MappedFile.hpp>
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+
+struct TextureStreamer::Record {
+    std::weak_ptr<Texture> texture;
+    std::string name;
+    std::string path;
+
+    // Level source: a mapped .ktx2, or decoded levels kept in system memory
+    MappedFile file;
+    Ktx2Texture ktx;
+    std::vector<Image> images;
+
+    StreamingEntry entry;
+    int requestedTop = INT_MAX; // finest level asked for since the last Update
+
+    int LevelCount() const { return static_cast<int>(entry.levelBytes.size()); }
+
+    void LevelData(int level, const void*& data, size_t& size, int& width, int& height) const {
+        if (!images.empty()) {
+            const Image& image = images[level];
+            data = image.pixels.data();
+            size = image.pixels.size();
+            width = image.width;
+            height = image.height;
+        } else {
+            const Ktx2Level& ktxLevel = ktx.levels[level];
+            data = ktxLevel.data;
+            size = ktxLevel.size;
+            width = ktxLevel.width;
+            height = ktxLevel.height;
+        }
+    }
+};
+
+TextureStreamer::TextureStreamer() : state(std::make_shared<State>()) {}
+
+TextureStreamer::~TextureStreamer() = default;
+
+float TextureStreamer::ProjectedSizePixels(float worldRadius, float distance, float projectionYScale, float viewportHeight) {
+    // NDC height is 2, so the diameter 2r/d * projY spans (2r/d * projY) / 2 * viewportHeight pixels
+    return worldRadius * projectionYScale * viewportHeight / std::max(distance, 1e-3f);
+}
+
+int TextureStreamer::LevelForScreenSize(int textureSize, float screenPixels, float uvCoverage, int levelCount) {
+    // One texel per pixel is the sharpest anything can look; every halving of that is one level
+    const float texelsPerPixel = textureSize * uvCoverage / std::max(screenPixels, 1.0f);
+    const int level = texelsPerPixel <= 1.0f ? 0 : static_cast<int>(std::floor(std::log2(texelsPerPixel)));
+    return std::clamp(level, 0, levelCount - 1);
+}
+
+TextureHandle TextureStreamer::Open(const std::string& path) {
+    std::error_code error;
+    std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(path, error);
+    const std::string canonical = error ? path : canonicalPath.generic_string();
+
+    auto existing = state->idByPath.find(canonical);
+    if (existing != state->idByPath.end()) {
+        if (TextureHandle texture = state->records.at(existing->second)->texture.lock()) return texture;
+    }
+
+    auto record = std::make_unique<Record>();
+    record->name = canonical;
+    record->path = canonical;
+
+    // 1. Open the level source
+    std::string extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    int width, height, channels = 0;
+    GLenum compressedFormat = GL_NONE;
+    if (extension == ".ktx2") {
+        if (!record->file.Open(path) || !ParseKtx2(record->file.Data(), record->file.Size(), record->ktx)) {
+            std::cout << "Failed to open streamed texture: " << path << std::endl;
+            return nullptr;
+        }
+        compressedFormat = Texture::CompressedInternalFormat(record->ktx.vkFormat);
+        if (!compressedFormat) {
+            std::cerr << "ERROR::TEXTURE_STREAMER::UNSUPPORTED_VK_FORMAT " << record->ktx.vkFormat << std::endl;
+            return nullptr;
+        }
+        width = record->ktx.width;
+        height = record->ktx.height;
+        for (const Ktx2Level& level : record->ktx.levels) record->entry.levelBytes.push_back(level.size);
+    } else {
+        Image base = LoadImageFromFile(path.c_str(), true);
+        if (!base.IsValid()) {
+            std::cout << "Failed to open streamed texture: " << path << std::endl;
+            return nullptr;
+        }
+        std::vector<Image> mips = GenerateMipChain(base);
+        width = base.width;
+        height = base.height;
+        channels = base.channels;
+        record->images.push_back(std::move(base));
+        for (Image& mip : mips) record->images.push_back(std::move(mip));
+        // Same padding rule as TextureCache::EstimateResidentBytes (RGB takes 4 bytes per texel)
+        const size_t bytesPerTexel = channels == 3 ? 4 : static_cast<size_t>(channels);
+        for (const Image& image : record->images) {
+            record->entry.levelBytes.push_back(static_cast<size_t>(image.width) * image.height * bytesPerTexel);
+        }
+    }
+
+    // 2. Tail: the small levels that stay resident for the texture's whole lifetime
+    const int levelCount = record->LevelCount();
+    int tail = levelCount - 1;
+    for (int level = 0; level < levelCount; level++) {
+        if (std::max(std::max(1, width >> level), std::max(1, height >> level)) <= settings.alwaysResidentSize) {
+            tail = level;
+            break;
+        }
+    }
+    record->entry.tailLevel = tail;
+    record->entry.residentTop = tail;
+    record->entry.wantedTop = tail;
+
+    Texture* texture = new Texture();
+    texture->CreateStreamed(width, height, levelCount, channels, compressedFormat);
+    for (int level = levelCount - 1; level >= tail; level--) {
+        const void* data;
+        size_t size;
+        int levelWidth, levelHeight;
+        record->LevelData(level, data, size, levelWidth, levelHeight);
+        texture->DefineLevel(level, levelWidth, levelHeight, data, size);
+    }
+    texture->SetResidentLevels(tail, levelCount - 1);
+    texture->unbind();
+
+    // 3. Handle: the deleter drops the record (and its mapping) with the last reference
+    const uint64_t id = state->nextId++;
+    std::weak_ptr<State> weakState = state;
+    TextureHandle handle(texture, [weakState, id](Texture* t) {
+        auto s = weakState.lock();
+        if (s) {
+            auto it = s->records.find(id);
+            if (it != s->records.end()) {
+                auto byPath = s->idByPath.find(it->second->path);
+                if (byPath != s->idByPath.end() && byPath->second == id) s->idByPath.erase(byPath);
+                s->records.erase(it);
+            }
+            s->idByTexture.erase(t);
+        }
+        delete t;
+    });
+
+    record->texture = handle;
+    state->records[id] = std::move(record);
+    state->idByTexture[texture] = id;
+    state->idByPath[canonical] = id;
+    return handle;
+}
+
+TextureStreamer::Record* TextureStreamer::Find(const TextureHandle& texture) const {
+    if (!texture) return nullptr;
+    auto it = state->idByTexture.find(texture.get());
+    return it != state->idByTexture.end() ? state->records.at(it->second).get() : nullptr;
+}
+
+void TextureStreamer::RequestScreenSize(const TextureHandle& texture, float screenPixels, float uvCoverage) {
+    if (Record* record = Find(texture)) {
+        const int size = std::max(texture->width, texture->height);
+        record->requestedTop = std::min(record->requestedTop,
+                                        LevelForScreenSize(size, screenPixels, uvCoverage, record->LevelCount()));
+    }
+}
+
+void TextureStreamer::RequestLevel(const TextureHandle& texture, int level) {
+    if (Record* record = Find(texture)) {
+        record->requestedTop = std::min(record->requestedTop, std::max(level, 0));
+    }
+}
+
+void TextureStreamer::Apply(Record& record, int targetTop) {
+    TextureHandle texture = record.texture.lock();
+    const int current = record.entry.residentTop;
+    if (!texture || targetTop == current) return;
+
+    const int lastLevel = record.LevelCount() - 1;
+    if (targetTop < current) {
+        // Upload finer levels first, then widen the sampled range
+        for (int level = current - 1; level >= targetTop; level--) {
+            const void* data;
+            size_t size;
+            int width, height;
+            record.LevelData(level, data, size, width, height);
+            texture->DefineLevel(level, width, height, data, size);
+        }
+        texture->SetResidentLevels(targetTop, lastLevel);
+    } else {
+        // Narrow the sampled range first, then free the levels
+        texture->SetResidentLevels(targetTop, lastLevel);
+        for (int level = current; level < targetTop; level++) {
+            texture->ReleaseLevel(level);
+        }
+    }
+    texture->unbind();
+    record.entry.residentTop = targetTop;
+}
+
+void TextureStreamer::Update() {
+    // 1. Turn this frame's requests into wanted levels
+    std::vector<Record*> records;
+    std::vector<StreamingEntry> entries;
+    records.reserve(state->records.size());
+    entries.reserve(state->records.size());
+    for (auto& [id, record] : state->records) {
+        StreamingEntry& entry = record->entry;
+        if (record->requestedTop != INT_MAX) {
+            entry.wantedTop = std::min(record->requestedTop, entry.tailLevel);
+            entry.lastRequestFrame = frame;
+            record->requestedTop = INT_MAX;
+        } else if (frame - entry.lastRequestFrame > settings.keepFrames) {
+            entry.wantedTop = entry.tailLevel;
+        }
+        records.push_back(record.get());
+        entries.push_back(entry);
+    }
+
+    // 2. Plan against the budget, 3. evict first so uploads land in freed memory
+    const StreamingPlan plan = PlanResidency(entries, settings.budgetBytes, settings.uploadBytesPerFrame);
+    for (size_t i = 0; i < records.size(); i++) {
+        if (plan.targetTop[i] > records[i]->entry.residentTop) Apply(*records[i], plan.targetTop[i]);
+    }
+    for (size_t i = 0; i < records.size(); i++) {
+        if (plan.targetTop[i] < records[i]->entry.residentTop) Apply(*records[i], plan.targetTop[i]);
+    }
+
+    stats.budgetBytes = settings.budgetBytes;
+    stats.residentBytes = plan.residentBytes;
+    stats.wantedBytes = plan.wantedBytes;
+    stats.uploadedBytes = plan.uploadBytes;
+    stats.evictedBytes = plan.evictedBytes;
+    stats.totalEvictedBytes += plan.evictedBytes;
+    stats.textures = static_cast<uint32_t>(records.size());
+    stats.starved = plan.starved;
+    frame++;
+}
+
+std::vector<TextureStreamer::Residency> TextureStreamer::GetResidency() const {
+    std::vector<Residency> residency;
+    residency.reserve(state->records.size());
+    for (const auto& [id, record] : state->records) {
+        const StreamingEntry& entry = record->entry;
+        residency.push_back({ record->name, record->LevelCount(), entry.residentTop, entry.wantedTop,
+                              ResidentBytes(entry, entry.residentTop), entry.lastRequestFrame });
+    }
+    return residency;
+}
@@ -0,0 +1,309 @@
+#include <Texture/VirtualTexture.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+VirtualTexture::VirtualTexture(const std::string& path) : VirtualTexture(path, Settings{}) {}
+
+VirtualTexture::VirtualTexture(const std::string& path, const Settings& newSettings)
+    : settings(newSettings), scheduler(newSettings.forgetFrames) {
+    if (!file.Open(path)) return;
+
+    const VirtualTextureInfo& info = file.GetInfo();
+    const int pageCount = settings.poolPagesPerSide * settings.poolPagesPerSide;
+    cache = std::make_unique<TileCache>(pageCount);
+    pageTable = std::make_unique<VirtualPageTable>(info.TilesPerSide(0), info.levelCount, settings.poolPagesPerSide);
+    CreateGpuResources();
+
+    // The root tile covers everything: load it now and keep it, so every lookup has a fallback
+    const TileId root{ static_cast<uint8_t>(info.levelCount - 1), 0, 0 };
+    std::vector<uint8_t> texels;
+    if (file.ReadTile(root.level, root.x, root.y, texels)) {
+        UploadTile(root, texels);
+        cache->Pin(root);
+    }
+    UploadPageTable();
+
+    for (int i = 0; i < std::max(settings.loaderThreads, 1); i++) {
+        loaders.emplace_back(&VirtualTexture::LoaderLoop, this);
+    }
+}
+
+VirtualTexture::~VirtualTexture() {
+    {
+        std::lock_guard<std::mutex> lock(loadMutex);
+        stopping = true;
+    }
+    loadReady.notify_all();
+    for (auto& loader : loaders) {
+        loader.join();
+    }
+
+    for (GLsync fence : feedbackFences) {
+        if (fence) glDeleteSync(fence);
+    }
+    if (feedbackPbos[0]) glDeleteBuffers(static_cast<GLsizei>(kFeedbackBuffers), feedbackPbos);
+    if (feedbackFbo) glDeleteFramebuffers(1, &feedbackFbo);
+    if (feedbackColor) glDeleteTextures(1, &feedbackColor);
+    if (feedbackDepth) glDeleteRenderbuffers(1, &feedbackDepth);
+    if (pageTableTexture) glDeleteTextures(1, &pageTableTexture);
+    if (poolTexture) glDeleteTextures(1, &poolTexture);
+}
+
+void VirtualTexture::CreateGpuResources() {
+    const VirtualTextureInfo& info = file.GetInfo();
+
+    // 1. Page pool: bilinear inside a page is safe thanks to the tile borders
+    const int poolSize = settings.poolPagesPerSide * info.PaddedTileSize();
+    glGenTextures(1, &poolTexture);
+    glBindTexture(GL_TEXTURE_2D, poolTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, poolSize, poolSize);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // 2. Page table: one texel per tile, level for level; read with texelFetch only
+    glGenTextures(1, &pageTableTexture);
+    glBindTexture(GL_TEXTURE_2D, pageTableTexture);
+    glTexStorage2D(GL_TEXTURE_2D, info.levelCount, GL_RGBA8, info.TilesPerSide(0), info.TilesPerSide(0));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // 3. Feedback readback buffers (the target itself is sized on first use)
+    glGenBuffers(static_cast<GLsizei>(kFeedbackBuffers), feedbackPbos);
+    glGenFramebuffers(1, &feedbackFbo);
+}
+
+void VirtualTexture::ResizeFeedback(int width, int height) {
+    if (width == feedbackWidth && height == feedbackHeight) return;
+    feedbackWidth = width;
+    feedbackHeight = height;
+
+    if (feedbackColor) glDeleteTextures(1, &feedbackColor);
+    if (feedbackDepth) glDeleteRenderbuffers(1, &feedbackDepth);
+
+    glGenTextures(1, &feedbackColor);
+    glBindTexture(GL_TEXTURE_2D, feedbackColor);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenRenderbuffers(1, &feedbackDepth);
+    glBindRenderbuffer(GL_RENDERBUFFER, feedbackDepth);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, feedbackFbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, feedbackColor, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, feedbackDepth);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "ERROR::VIRTUAL_TEXTURE::FEEDBACK_FRAMEBUFFER_INCOMPLETE" << std::endl;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void VirtualTexture::BeginFeedback(int width, int height) {
+    if (!IsValid()) return;
+    viewportWidth = width;
+    viewportHeight = height;
+    const int divisor = std::max(settings.feedbackDivisor, 1);
+    ResizeFeedback(std::max(width / divisor, 1), std::max(height / divisor, 1));
+
+    glBindFramebuffer(GL_FRAMEBUFFER, feedbackFbo);
+    glViewport(0, 0, feedbackWidth, feedbackHeight);
+    // Alpha 0 = nothing virtual textured here
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void VirtualTexture::EndFeedback() {
+    if (!IsValid()) return;
+
+    // A slot whose previous readback was never consumed just gets overwritten
+    const size_t slot = nextFeedback;
+    nextFeedback = (nextFeedback + 1) % kFeedbackBuffers;
+    if (feedbackFences[slot]) glDeleteSync(feedbackFences[slot]);
+
+    const GLsizeiptr bytes = static_cast<GLsizeiptr>(feedbackWidth) * feedbackHeight * 4;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, feedbackPbos[slot]);
+    glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    // Into the PBO: returns immediately, the copy happens when the GPU gets there
+    glReadPixels(0, 0, feedbackWidth, feedbackHeight, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    feedbackFences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    feedbackSizes[slot][0] = feedbackWidth;
+    feedbackSizes[slot][1] = feedbackHeight;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, viewportWidth, viewportHeight);
+}
+
+void VirtualTexture::ReadFeedback() {
+    // Newest readback the GPU has finished; older ones are stale by now
+    const VirtualTextureInfo& info = file.GetInfo();
+    for (size_t age = 1; age <= kFeedbackBuffers; age++) {
+        const size_t slot = (nextFeedback + kFeedbackBuffers - age) % kFeedbackBuffers;
+        GLsync fence = feedbackFences[slot];
+        if (!fence) continue;
+        if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) continue;
+
+        const size_t pixels = static_cast<size_t>(feedbackSizes[slot][0]) * feedbackSizes[slot][1];
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, feedbackPbos[slot]);
+        const uint8_t* rgba = static_cast<const uint8_t*>(
+            glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(pixels * 4), GL_MAP_READ_BIT));
+        std::vector<TileRequest> requests;
+        if (rgba) {
+            requests = ParseFeedback(rgba, pixels, info.TilesPerSide(0), info.levelCount);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        // Consume this one and everything older
+        for (size_t older = age; older <= kFeedbackBuffers; older++) {
+            const size_t olderSlot = (nextFeedback + kFeedbackBuffers - older) % kFeedbackBuffers;
+            if (feedbackFences[olderSlot]) glDeleteSync(feedbackFences[olderSlot]);
+            feedbackFences[olderSlot] = nullptr;
+        }
+
+        // Tiles on screen (or the ancestors standing in for them) are in use this frame
+        for (const TileRequest& request : requests) {
+            for (TileId tile = request.tile; tile.level < info.levelCount; tile = tile.Parent()) {
+                cache->Touch(tile, frame);
+            }
+        }
+        scheduler.Submit(requests, info.levelCount, frame);
+        stats.requestedTiles = requests.size();
+        return;
+    }
+}
+
+void VirtualTexture::UploadTile(const TileId& tile, const std::vector<uint8_t>& texels) {
+    TileId evicted;
+    bool evictedValid;
+    const int page = cache->Allocate(tile, frame, evicted, evictedValid);
+    if (page < 0) {
+        stats.droppedTiles++;
+        return;
+    }
+    if (evictedValid) {
+        pageTable->Unmap(evicted);
+        stats.evictedTiles++;
+    }
+
+    const VirtualTextureInfo& info = file.GetInfo();
+    const int padded = info.PaddedTileSize();
+    glBindTexture(GL_TEXTURE_2D, poolTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, (page % settings.poolPagesPerSide) * padded,
+                    (page / settings.poolPagesPerSide) * padded, padded, padded,
+                    GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+    pageTable->Map(tile, page);
+    stats.uploadedTiles++;
+}
+
+void VirtualTexture::UploadPageTable() {
+    const int changed = pageTable->Resolve();
+    if (changed < 0) return;
+
+    // A change at level L shows through every finer level
+    glBindTexture(GL_TEXTURE_2D, pageTableTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    for (int level = 0; level <= changed; level++) {
+        glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, pageTable->LevelSize(level), pageTable->LevelSize(level),
+                        GL_RGBA, GL_UNSIGNED_BYTE, pageTable->GetLevel(level).data());
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void VirtualTexture::Update() {
+    if (!IsValid()) return;
+    stats.uploadedTiles = 0;
+    stats.evictedTiles = 0;
+
+    // 1. What did the GPU ask for
+    ReadFeedback();
+
+    // 2. Finished loads into the pool
+    for (int i = 0; i < settings.uploadsPerFrame; i++) {
+        LoadedTile tile;
+        {
+            std::lock_guard<std::mutex> lock(loadedMutex);
+            if (loaded.empty()) break;
+            tile = std::move(loaded.front());
+            loaded.pop_front();
+        }
+        inFlight.erase(tile.tile.Key());
+        scheduler.Complete(tile.tile);
+        if (tile.ok) UploadTile(tile.tile, tile.texels);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // 3. New loads, best first
+    const size_t maxInFlight = static_cast<size_t>(std::max(settings.loadsInFlight, 0));
+    if (inFlight.size() < maxInFlight) {
+        const std::vector<TileId> next = scheduler.Next(maxInFlight - inFlight.size(), frame, [&](TileId tile) {
+            return cache->Contains(tile) || inFlight.count(tile.Key()) != 0;
+        });
+        if (!next.empty()) {
+            std::lock_guard<std::mutex> lock(loadMutex);
+            for (const TileId& tile : next) {
+                inFlight.insert(tile.Key());
+                loadQueue.push_back(tile);
+            }
+        }
+        for (size_t i = 0; i < next.size(); i++) loadReady.notify_one();
+    }
+
+    // 4. Page table levels that changed
+    UploadPageTable();
+
+    stats.residentTiles = cache->GetResidentCount();
+    stats.pendingTiles = scheduler.GetPendingCount();
+    stats.loadsInFlight = inFlight.size();
+    frame++;
+}
+
+void VirtualTexture::Bind(const Shader& shader, unsigned int poolSlot, unsigned int pageTableSlot) const {
+    if (!IsValid()) return;
+    const VirtualTextureInfo& info = file.GetInfo();
+
+    glActiveTexture(GL_TEXTURE0 + poolSlot);
+    glBindTexture(GL_TEXTURE_2D, poolTexture);
+    glActiveTexture(GL_TEXTURE0 + pageTableSlot);
+    glBindTexture(GL_TEXTURE_2D, pageTableTexture);
+
+    shader.setInt("vtPool", static_cast<int>(poolSlot));
+    shader.setInt("vtPageTable", static_cast<int>(pageTableSlot));
+    shader.setFloat("vtSize", static_cast<float>(info.size));
+    shader.setFloat("vtTileSize", static_cast<float>(info.tileSize));
+    shader.setFloat("vtBorder", static_cast<float>(info.border));
+    shader.setFloat("vtPaddedTileSize", static_cast<float>(info.PaddedTileSize()));
+    shader.setFloat("vtLevelCount", static_cast<float>(info.levelCount));
+    shader.setFloat("vtPoolSize", static_cast<float>(settings.poolPagesPerSide * info.PaddedTileSize()));
+    // Derivatives in the feedback pass are feedbackDivisor times bigger than on screen
+    shader.setFloat("vtFeedbackLodBias", -std::log2(static_cast<float>(std::max(settings.feedbackDivisor, 1))));
+}
+
+void VirtualTexture::LoaderLoop() {
+    while (true) {
+        TileId tile;
+        {
+            std::unique_lock<std::mutex> lock(loadMutex);
+            loadReady.wait(lock, [&] { return stopping || !loadQueue.empty(); });
+            if (stopping) return;
+            tile = loadQueue.front();
+            loadQueue.pop_front();
+        }
+
+        LoadedTile result;
+        result.tile = tile;
+        result.ok = file.ReadTile(tile.level, tile.x, tile.y, result.texels);
+
+        std::lock_guard<std::mutex> lock(loadedMutex);
+        loaded.push_back(std::move(result));
+    }
+}
@@ -0,0 +1,212 @@
+#include <Texture/VirtualTextureFile.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+    constexpr char kMagic[4] = { 'V', 'T', 'E', 'X' };
+    constexpr uint32_t kVersion = 1;
+    constexpr uint32_t kMaxTilesPerSide = 1024; // what the feedback encoding can address
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t size;
+        uint32_t tileSize;
+        uint32_t border;
+        uint32_t levelCount;
+        uint32_t tileCount;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(Header) == 32, "VTEX header must be 32 bytes");
+
+    struct TileIndex {
+        uint64_t offset;
+        uint32_t size;
+        uint32_t reserved;
+    };
+
+    bool IsPowerOfTwo(int value) {
+        return value > 0 && (value & (value - 1)) == 0;
+    }
+
+    int LevelCountFor(int size, int tileSize) {
+        int count = 1;
+        for (int tiles = size / tileSize; tiles > 1; tiles >>= 1) count++;
+        return count;
+    }
+
+    Image ToRgba(const Image& image) {
+        if (image.channels == 4) return image;
+
+        Image rgba;
+        rgba.width = image.width;
+        rgba.height = image.height;
+        rgba.channels = 4;
+        rgba.pixels.resize(static_cast<size_t>(image.width) * image.height * 4);
+        const size_t texels = static_cast<size_t>(image.width) * image.height;
+        for (size_t i = 0; i < texels; i++) {
+            // Same as sampling GL_R8 / GL_RG8 / GL_RGB8: missing channels read 0, alpha 1
+            const unsigned char* src = &image.pixels[i * image.channels];
+            unsigned char* dst = &rgba.pixels[i * 4];
+            dst[0] = src[0];
+            dst[1] = image.channels >= 2 ? src[1] : 0;
+            dst[2] = image.channels >= 3 ? src[2] : 0;
+            dst[3] = 255;
+        }
+        return rgba;
+    }
+
+    // Tile texels plus border, clamped to the level's edges
+    void CutTile(const Image& level, int tileX, int tileY, int tileSize, int border, uint8_t* out) {
+        const int padded = tileSize + 2 * border;
+        const int originX = tileX * tileSize - border;
+        const int originY = tileY * tileSize - border;
+        for (int y = 0; y < padded; y++) {
+            const int sourceY = std::clamp(originY + y, 0, level.height - 1);
+            const unsigned char* row = &level.pixels[static_cast<size_t>(sourceY) * level.width * 4];
+            for (int x = 0; x < padded; x++) {
+                const int sourceX = std::clamp(originX + x, 0, level.width - 1);
+                std::memcpy(out + (static_cast<size_t>(y) * padded + x) * 4, row + sourceX * 4, 4);
+            }
+        }
+    }
+}
+
+bool WriteVirtualTexture(const std::string& path, const Image& image, int tileSize, int border,
+                         const MipSettings& mipSettings) {
+    if (!image.IsValid() || image.width != image.height || !IsPowerOfTwo(tileSize) ||
+        image.width % tileSize != 0 || !IsPowerOfTwo(image.width / tileSize) ||
+        image.width / tileSize > static_cast<int>(kMaxTilesPerSide)) {
+        std::cerr << "ERROR::VIRTUAL_TEXTURE::BAD_SIZE " << image.width << "x" << image.height
+                  << " (needs square, tile size " << tileSize << " * 2^n)" << std::endl;
+        return false;
+    }
+
+    // 1. RGBA levels down to the root tile
+    VirtualTextureInfo info;
+    info.size = image.width;
+    info.tileSize = tileSize;
+    info.border = border;
+    info.levelCount = LevelCountFor(image.width, tileSize);
+
+    std::vector<Image> levels;
+    levels.push_back(ToRgba(image));
+    std::vector<Image> mips = GenerateMipChain(levels[0], mipSettings);
+    for (int level = 1; level < info.levelCount; level++) {
+        levels.push_back(std::move(mips[level - 1]));
+    }
+
+    // 2. Index: tiles stored coarsest level first, so the root tile is at the front of the file
+    size_t tileCount = 0;
+    std::vector<size_t> firstTile(info.levelCount);
+    for (int level = 0; level < info.levelCount; level++) {
+        firstTile[level] = tileCount;
+        tileCount += static_cast<size_t>(info.TilesPerSide(level)) * info.TilesPerSide(level);
+    }
+
+    std::vector<TileIndex> index(tileCount);
+    uint64_t offset = sizeof(Header) + sizeof(TileIndex) * tileCount;
+    for (int level = info.levelCount - 1; level >= 0; level--) {
+        const size_t count = static_cast<size_t>(info.TilesPerSide(level)) * info.TilesPerSide(level);
+        for (size_t i = 0; i < count; i++) {
+            index[firstTile[level] + i] = { offset, static_cast<uint32_t>(info.TileBytes()), 0 };
+            offset += info.TileBytes();
+        }
+    }
+
+    // 3. Write
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "ERROR::VIRTUAL_TEXTURE::CANNOT_OPEN_FOR_WRITE " << path << std::endl;
+        return false;
+    }
+
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.size = static_cast<uint32_t>(info.size);
+    header.tileSize = static_cast<uint32_t>(tileSize);
+    header.border = static_cast<uint32_t>(border);
+    header.levelCount = static_cast<uint32_t>(info.levelCount);
+    header.tileCount = static_cast<uint32_t>(tileCount);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(sizeof(TileIndex) * tileCount));
+
+    std::vector<uint8_t> tile(info.TileBytes());
+    for (int level = info.levelCount - 1; level >= 0; level--) {
+        const int tiles = info.TilesPerSide(level);
+        for (int y = 0; y < tiles; y++) {
+            for (int x = 0; x < tiles; x++) {
+                CutTile(levels[level], x, y, tileSize, border, tile.data());
+                file.write(reinterpret_cast<const char*>(tile.data()), static_cast<std::streamsize>(tile.size()));
+            }
+        }
+    }
+    return static_cast<bool>(file);
+}
+
+bool VirtualTextureFile::Open(const std::string& path) {
+    if (!file.Open(path)) {
+        std::cerr << "ERROR::VIRTUAL_TEXTURE::CANNOT_OPEN " << path << std::endl;
+        return false;
+    }
+    if (!Parse(file.Data(), file.Size())) {
+        std::cerr << "ERROR::VIRTUAL_TEXTURE::INVALID_FILE " << path << std::endl;
+        file.Close();
+        return false;
+    }
+    return true;
+}
+
+bool VirtualTextureFile::Parse(const uint8_t* data, size_t size) {
+    bytes = nullptr;
+    tiles = nullptr;
+    levelFirstTile.clear();
+
+    if (size < sizeof(Header)) return false;
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion) return false;
+    if (header.tileSize == 0 || header.tileSize > 4096 || header.size % header.tileSize != 0 ||
+        header.size / header.tileSize > kMaxTilesPerSide || !IsPowerOfTwo(static_cast<int>(header.size / header.tileSize)) ||
+        header.border > header.tileSize) {
+        return false;
+    }
+
+    info.size = static_cast<int>(header.size);
+    info.tileSize = static_cast<int>(header.tileSize);
+    info.border = static_cast<int>(header.border);
+    info.levelCount = static_cast<int>(header.levelCount);
+    if (info.levelCount != LevelCountFor(info.size, info.tileSize)) return false;
+
+    size_t tileCount = 0;
+    for (int level = 0; level < info.levelCount; level++) {
+        levelFirstTile.push_back(tileCount);
+        tileCount += static_cast<size_t>(info.TilesPerSide(level)) * info.TilesPerSide(level);
+    }
+    if (tileCount != header.tileCount || size < sizeof(Header) + sizeof(TileIndex) * tileCount) return false;
+
+    // Every tile must lie inside the file and hold a whole padded tile
+    const TileRange* ranges = reinterpret_cast<const TileRange*>(data + sizeof(Header));
+    for (size_t i = 0; i < tileCount; i++) {
+        if (ranges[i].size != info.TileBytes() || ranges[i].offset > size || size - ranges[i].offset < ranges[i].size) {
+            return false;
+        }
+    }
+
+    bytes = data;
+    tiles = ranges;
+    return true;
+}
+
+bool VirtualTextureFile::ReadTile(int level, int x, int y, std::vector<uint8_t>& out) const {
+    if (!tiles || level < 0 || level >= info.levelCount) return false;
+    const int perSide = info.TilesPerSide(level);
+    if (x < 0 || y < 0 || x >= perSide || y >= perSide) return false;
+
+    const TileRange& range = tiles[levelFirstTile[level] + static_cast<size_t>(y) * perSide + x];
+    out.assign(bytes + range.offset, bytes + range.offset + range.size);
+    return true;
+}
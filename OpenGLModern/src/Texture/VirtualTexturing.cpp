@@ -0,0 +1,200 @@
+#include <Texture/VirtualTexturing.hpp>
+#include <algorithm>
+#include <numeric>
+
+// --- Feedback ---
+
+uint32_t EncodeFeedback(TileId tile) {
+    const uint32_t r = tile.x & 0xFF;
+    const uint32_t g = tile.y & 0xFF;
+    const uint32_t b = (tile.level & 0xF) | ((tile.x >> 8) & 0x3) << 4 | ((tile.y >> 8) & 0x3) << 6;
+    return r | g << 8 | b << 16 | 0xFFu << 24;
+}
+
+std::vector<TileRequest> ParseFeedback(const uint8_t* rgba, size_t pixelCount, int tilesPerSide, int levelCount) {
+    std::vector<TileRequest> requests;
+    std::unordered_map<uint32_t, size_t> indexByKey;
+
+    // Neighbouring texels usually hit the same tile: skip the map lookup for repeats
+    uint32_t lastTexel = 0;
+    size_t lastIndex = 0;
+    for (size_t i = 0; i < pixelCount; i++) {
+        const uint8_t* texel = rgba + i * 4;
+        if (texel[3] == 0) continue;
+
+        const uint32_t packed = texel[0] | texel[1] << 8 | texel[2] << 16;
+        if (!requests.empty() && packed == lastTexel) {
+            requests[lastIndex].pixels++;
+            continue;
+        }
+
+        TileId tile;
+        tile.level = texel[2] & 0xF;
+        tile.x = static_cast<uint16_t>(texel[0] | ((texel[2] >> 4) & 0x3) << 8);
+        tile.y = static_cast<uint16_t>(texel[1] | ((texel[2] >> 6) & 0x3) << 8);
+        if (tile.level >= levelCount || tile.x >= (tilesPerSide >> tile.level) ||
+            tile.y >= (tilesPerSide >> tile.level)) {
+            continue;
+        }
+
+        auto [it, inserted] = indexByKey.try_emplace(tile.Key(), requests.size());
+        if (inserted) requests.push_back({ tile, 0 });
+        requests[it->second].pixels++;
+        lastTexel = packed;
+        lastIndex = it->second;
+    }
+    return requests;
+}
+
+// --- Scheduling ---
+
+void TileScheduler::Submit(const std::vector<TileRequest>& requests, int levelCount, uint64_t frame) {
+    for (const TileRequest& request : requests) {
+        for (TileId tile = request.tile; tile.level < levelCount; tile = tile.Parent()) {
+            auto [it, inserted] = pending.try_emplace(tile.Key());
+            Pending& entry = it->second;
+            if (inserted) entry.firstFrame = frame;
+            if (entry.lastFrame != frame) entry.pixels = 0; // counts are per frame
+            entry.pixels += request.pixels;
+            entry.lastFrame = frame;
+        }
+    }
+}
+
+std::vector<TileId> TileScheduler::Next(size_t maxCount, uint64_t frame, const std::function<bool(TileId)>& skip) {
+    struct Candidate {
+        TileId tile;
+        Pending entry;
+    };
+    std::vector<Candidate> candidates;
+
+    for (auto it = pending.begin(); it != pending.end();) {
+        const TileId tile = TileId::FromKey(it->first);
+        if (frame - it->second.lastFrame > forgetFrames) {
+            it = pending.erase(it);
+            continue;
+        }
+        if (!skip(tile)) candidates.push_back({ tile, it->second });
+        ++it;
+    }
+
+    // Coarse first: one coarse tile fixes the blur of many fine ones
+    const size_t count = std::min(maxCount, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(),
+        [](const Candidate& a, const Candidate& b) {
+            if (a.tile.level != b.tile.level) return a.tile.level > b.tile.level;
+            if (a.entry.firstFrame != b.entry.firstFrame) return a.entry.firstFrame < b.entry.firstFrame;
+            if (a.entry.pixels != b.entry.pixels) return a.entry.pixels > b.entry.pixels;
+            return a.tile.Key() < b.tile.Key();
+        });
+
+    std::vector<TileId> next;
+    next.reserve(count);
+    for (size_t i = 0; i < count; i++) next.push_back(candidates[i].tile);
+    return next;
+}
+
+// --- Page pool ---
+
+TileCache::TileCache(int pageCount) : pageCount(pageCount) {
+    freePages.resize(pageCount);
+    // Hand out page 0 first
+    std::iota(freePages.rbegin(), freePages.rend(), 0);
+}
+
+int TileCache::Touch(TileId tile, uint64_t frame) {
+    auto pin = pinned.find(tile.Key());
+    if (pin != pinned.end()) return pin->second;
+
+    auto it = slots.find(tile.Key());
+    if (it == slots.end()) return -1;
+    it->second->lastFrame = frame;
+    lru.splice(lru.begin(), lru, it->second);
+    return it->second->page;
+}
+
+int TileCache::Allocate(TileId tile, uint64_t frame, TileId& evicted, bool& evictedValid) {
+    evictedValid = false;
+    if (pinned.count(tile.Key())) return pinned[tile.Key()];
+    if (slots.count(tile.Key())) return Touch(tile, frame);
+
+    int page;
+    if (!freePages.empty()) {
+        page = freePages.back();
+        freePages.pop_back();
+    } else {
+        // Back of the list is the least recently used; if even that was used this frame, the
+        // pool is too small for what's on screen and we'd only thrash
+        if (lru.empty() || lru.back().lastFrame >= frame) return -1;
+        const Slot victim = lru.back();
+        lru.pop_back();
+        slots.erase(victim.key);
+        evicted = TileId::FromKey(victim.key);
+        evictedValid = true;
+        page = victim.page;
+    }
+
+    lru.push_front({ tile.Key(), page, frame });
+    slots[tile.Key()] = lru.begin();
+    return page;
+}
+
+void TileCache::Pin(TileId tile) {
+    auto it = slots.find(tile.Key());
+    if (it == slots.end()) return;
+    pinned[tile.Key()] = it->second->page;
+    lru.erase(it->second);
+    slots.erase(it);
+}
+
+// --- Indirection ---
+
+VirtualPageTable::VirtualPageTable(int tilesPerSide, int levelCount, int poolPagesPerRow)
+    : tilesPerSide(tilesPerSide), levelCount(levelCount), poolPagesPerRow(poolPagesPerRow) {
+    pages.resize(levelCount);
+    resolved.resize(levelCount);
+    for (int level = 0; level < levelCount; level++) {
+        const size_t count = static_cast<size_t>(LevelSize(level)) * LevelSize(level);
+        pages[level].assign(count, -1);
+        resolved[level].assign(count, 0);
+    }
+}
+
+void VirtualPageTable::Map(TileId tile, int page) {
+    pages[tile.level][static_cast<size_t>(tile.y) * LevelSize(tile.level) + tile.x] = page;
+    dirtyLevel = std::max(dirtyLevel, static_cast<int>(tile.level));
+}
+
+void VirtualPageTable::Unmap(TileId tile) {
+    Map(tile, -1);
+}
+
+int VirtualPageTable::GetPage(TileId tile) const {
+    return pages[tile.level][static_cast<size_t>(tile.y) * LevelSize(tile.level) + tile.x];
+}
+
+int VirtualPageTable::Resolve() {
+    const int changed = dirtyLevel;
+    // Coarse to fine: every level inherits from the one above it
+    for (int level = changed; level >= 0; level--) {
+        const int size = LevelSize(level);
+        const int parentSize = LevelSize(level + 1);
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                const size_t index = static_cast<size_t>(y) * size + x;
+                const int page = pages[level][index];
+                if (page >= 0) {
+                    const uint32_t pageX = static_cast<uint32_t>(page % poolPagesPerRow);
+                    const uint32_t pageY = static_cast<uint32_t>(page / poolPagesPerRow);
+                    resolved[level][index] = pageX | pageY << 8 | uint32_t(level) << 16 | 0xFFu << 24;
+                } else if (level + 1 < levelCount) {
+                    resolved[level][index] = resolved[level + 1][static_cast<size_t>(y >> 1) * parentSize + (x >> 1)];
+                } else {
+                    resolved[level][index] = 0;
+                }
+            }
+        }
+    }
+    dirtyLevel = -1;
+    return changed;
+}
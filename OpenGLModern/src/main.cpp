@@ -7,7 +7,12 @@
 #include <Engine/Managers/ServiceLocator.hpp>
 #include <Engine/Managers/GameObjectManager.hpp>
 #include <Engine/Managers/InputManager.hpp>
+#include <Engine/Jobs/JobSystem.hpp>
 #include <Engine/RenderContext.hpp>
+#include <Engine/Renderer.hpp>
+#include <Engine/Animation/AnimationSystem.hpp>
+#include <Texture/TextureCache.hpp>
+#include <Texture/TextureStreamer.hpp>
 #include <Cube/Cube.hpp> 
 #include "GameObjects/Camera/Camera.hpp"
 
@@ -21,6 +26,7 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
     try {
         auto render = ServiceLocator::Get().GetService<RenderContext>();
         render->SetPerspective(45.0f, (float)width / (float)height, 0.1f, 100.0f);
+        render->SetViewportSize(width, height);
     } catch(...) {
         // RenderContext might not be ready yet
     }
@@ -59,14 +65,25 @@ int main() {
 
     // --- 2. SERVICE REGISTRATION (Composition Root) ---
     
-    // Create the services
+    // Create the services (the job system first: it's created on, and so owned by, the main thread)
+    auto jobSystem = ServiceLocator::Get().Create<JobSystem>();
     auto inputSystem = ServiceLocator::Get().Create<InputManager>();
     auto renderSystem = ServiceLocator::Get().Create<RenderContext>();
     auto objectSystem = ServiceLocator::Get().Create<GameObjectManager>();
+    auto animationSystem = ServiceLocator::Get().Create<AnimationSystem>();
+    auto textureCache = ServiceLocator::Get().Create<TextureCache>();
+    auto textureStreamer = ServiceLocator::Get().Create<TextureStreamer>();
+    auto renderer = ServiceLocator::Get().Create<Renderer>();
 
     // Initialize the services
     inputSystem->Initialize(window);
     renderSystem->SetPerspective(45.0f, (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
+    renderSystem->SetViewportSize(SCR_WIDTH, SCR_HEIGHT);
+
+    // Far and off-screen objects update less often (the camera is the viewer, set every frame)
+    UpdateLodSettings updateLod;
+    updateLod.enabled = true;
+    objectSystem->SetUpdateLod(updateLod);
 
     // --- 3. GAME SETUP ---
 
@@ -78,7 +95,12 @@ int main() {
     std::cout << "Engine started...\n";
 
     // Create a Cube (It will auto-register because GameObjectManager is now in the Locator)
-    auto cube1 = std::make_shared<Cube>(glm::vec3(0.0f, 0.0f, 0.0f));
+    std::shared_ptr<Cube> cube1(ObjectPool::New<Cube>(glm::vec3(0.0f, 0.0f, 0.0f)));
+    const MeshLoadStats& modelStats = cube1->GetMeshRenderer().GetLoadStats();
+    std::cout << "Model: " << cube1->GetMeshRenderer().GetSubMeshCount() << " submeshes, welded "
+              << modelStats.weld.verticesBefore << " -> " << modelStats.weld.verticesAfter << " vertices ("
+              << modelStats.weld.ReductionPercent() << "% reduction), " << modelStats.uniqueTextures
+              << " unique textures\n";
 
     // Add Lights
     //renderSystem->GetLightManager().addPointLight(glm::vec3(0.0f, 1.5f, 0.0f), glm::vec3(1.0f, 1.0f, 1.0f));
@@ -102,9 +124,33 @@ int main() {
             camera->Update(deltaTime);
         }
 
-        // Update All GameObjects
+        // GL work queued by jobs since the last frame
+        jobSystem->RunMainThreadJobs();
+
+        // Upload textures that finished decoding on the worker threads
+        textureCache->ProcessUploads();
+
+        // Evaluate all skinned characters and upload their palettes before anything draws
+        animationSystem->Update(deltaTime);
+        animationSystem->Upload();
+
+        // Settle transforms moved since the last frame (parents first) before anything draws
+        objectSystem->UpdateTransforms();
+
+        // Update All GameObjects (throttled by distance to / visibility from the camera)
+        const glm::vec3 viewPosition = camera ? camera->GetPosition() : glm::vec3(0.0f);
+        objectSystem->SetUpdateViewer(viewPosition, renderSystem->GetProjectionMatrix() * renderSystem->GetViewMatrix());
         objectSystem->UpdateAll(deltaTime);
 
+        // Copy what's in view out of the objects into render packets (after settling whatever
+        // the updates moved), then draw from the packets alone
+        objectSystem->UpdateTransforms();
+        renderer->Extract(RenderView{ renderSystem->GetViewMatrix(), renderSystem->GetProjectionMatrix(), viewPosition });
+        renderer->Draw();
+
+        // Stream mips for what was drawn this frame (requests come from the updates above)
+        textureStreamer->Update();
+
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <Engine/Animation/AnimationClip.hpp>
+#include <cmath>
+
+TEST(AnimationClip, SmallestThreeRoundTrip) {
+    const glm::quat q = glm::normalize(glm::quat(0.3f, -0.5f, 0.7f, 0.2f));
+    float out[4];
+    AnimationClip::UnpackQuat(AnimationClip::PackQuat(q), out);
+
+    // q and -q are the same rotation
+    const float sign = (out[3] * q.w + out[0] * q.x + out[1] * q.y + out[2] * q.z) < 0.0f ? -1.0f : 1.0f;
+    EXPECT_NEAR(out[0] * sign, q.x, 1e-4f);
+    EXPECT_NEAR(out[1] * sign, q.y, 1e-4f);
+    EXPECT_NEAR(out[2] * sign, q.z, 1e-4f);
+    EXPECT_NEAR(out[3] * sign, q.w, 1e-4f);
+}
+
+// Linear motion and a constant rotation collapse to a handful of keys but sample back exactly
+TEST(AnimationClip, CurveFittingDropsRedundantKeys) {
+    const size_t frames = 61;
+    std::vector<RawJointTrack> tracks(1);
+    for (size_t f = 0; f < frames; f++) {
+        tracks[0].translations.push_back(glm::vec3(f * 0.1f, 1.0f, 0.0f));
+        tracks[0].rotations.push_back(glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    }
+
+    AnimationClip clip = AnimationClip::Compress("walk", 30.0f, frames, tracks);
+    EXPECT_EQ(clip.GetRawKeyCount(), frames * 2);
+    EXPECT_EQ(clip.GetKeyCount(), 3u); // 2 translation + 1 rotation
+    EXPECT_FLOAT_EQ(clip.GetDuration(), 2.0f);
+
+    JointPose bind, pose;
+    clip.SamplePose(1.0f, &bind, &pose);
+    EXPECT_NEAR(pose.translation[0], 3.0f, 1e-3f);
+    EXPECT_NEAR(pose.translation[1], 1.0f, 1e-3f);
+    EXPECT_NEAR(pose.rotation[3], 1.0f, 1e-4f);
+}
+
+TEST(AnimationClip, SampledRotationStaysWithinTolerance) {
+    const size_t frames = 31;
+    std::vector<RawJointTrack> tracks(1);
+    for (size_t f = 0; f < frames; f++) {
+        const float angle = std::sin(f * 0.3f) * 1.5f;
+        tracks[0].rotations.push_back(glm::angleAxis(angle, glm::vec3(0.0f, 1.0f, 0.0f)));
+    }
+
+    ClipCompressionSettings settings;
+    settings.rotationTolerance = 2e-3f;
+    AnimationClip clip = AnimationClip::Compress("swing", 30.0f, frames, tracks, settings);
+    EXPECT_LT(clip.GetKeyCount(), frames);
+
+    JointPose bind, pose;
+    for (size_t f = 0; f < frames; f++) {
+        clip.SamplePose(f / 30.0f, &bind, &pose);
+        const glm::quat& expected = tracks[0].rotations[f];
+        const float dot = std::abs(pose.rotation[0] * expected.x + pose.rotation[1] * expected.y +
+                                   pose.rotation[2] * expected.z + pose.rotation[3] * expected.w);
+        EXPECT_GT(dot, 0.9999f) << "frame " << f;
+    }
+}
+
+// Frame numbers are 16 bits: samples past frame 65535 are cut, not wrapped around to early frames
+TEST(AnimationClip, LongTracksAreCutAtTheFrameLimit) {
+    // A zigzag with a key every 32 frames, all the way past the limit
+    auto zigzag = [](float frame) { return std::abs(std::fmod(frame + 32.0f, 64.0f) - 32.0f) * 0.01f; };
+    const size_t frames = 70000;
+    std::vector<RawJointTrack> tracks(1);
+    for (size_t f = 0; f < frames; f++) {
+        tracks[0].translations.push_back(glm::vec3(zigzag(float(f)), 0.0f, 0.0f));
+    }
+
+    AnimationClip clip = AnimationClip::Compress("long", 30.0f, frames, tracks);
+    EXPECT_EQ(clip.GetRawKeyCount(), 65535u);
+    EXPECT_FLOAT_EQ(clip.GetDuration(), 65534.0f / 30.0f);
+
+    JointPose bind, pose;
+    for (float frame : { 8.0f, 30008.0f, 65000.0f, 65534.0f }) {
+        clip.SamplePose(frame / 30.0f, &bind, &pose);
+        EXPECT_NEAR(pose.translation[0], zigzag(frame), 2e-3f) << "frame " << frame;
+    }
+}
+
+// Joints without curves keep their bind pose
+TEST(AnimationClip, UnanimatedJointsUseBindPose) {
+    std::vector<RawJointTrack> tracks(2);
+    tracks[1].translations = { glm::vec3(0.0f), glm::vec3(1.0f) };
+    AnimationClip clip = AnimationClip::Compress("partial", 30.0f, 2, tracks);
+
+    JointPose bind[2], pose[2];
+    bind[0].translation[2] = 5.0f;
+    clip.SamplePose(0.0f, bind, pose);
+    EXPECT_FLOAT_EQ(pose[0].translation[2], 5.0f);
+}
+
+TEST(SkinWeights, KeepsFourStrongestAndSumsTo255) {
+    const int bones[5] = { 7, 3, 9, 1, 4 };
+    const float weights[5] = { 0.05f, 0.4f, 0.2f, 0.25f, 0.1f };
+    PackedSkinWeights packed = PackSkinWeights(bones, weights, 5);
+
+    int sum = 0;
+    for (int k = 0; k < 4; k++) {
+        sum += packed.weights[k];
+        EXPECT_NE(packed.bones[k], 7) << "weakest influence should be dropped";
+    }
+    EXPECT_EQ(sum, 255);
+}
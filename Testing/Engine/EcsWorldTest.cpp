@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <Engine/ECS/EcsWorld.hpp>
+#include <string>
+#include <memory>
+#include <set>
+
+namespace {
+    struct Position { float x = 0.0f, y = 0.0f, z = 0.0f; };
+    struct Velocity { float x = 0.0f, y = 0.0f, z = 0.0f; };
+    struct Name { std::string value; };
+    struct Tracked {
+        std::shared_ptr<int> counter;  // use_count tells how many live copies exist
+    };
+}
+
+TEST(EcsWorld, GroupsEntitiesByComponentSet) {
+    EcsWorld world;
+    const Entity a = world.Create(Position{ 1, 0, 0 }, Velocity{ 1, 0, 0 });
+    const Entity b = world.Create(Position{ 2, 0, 0 });
+    const Entity c = world.Create(Velocity{ 0, 0, 0 }, Position{ 3, 0, 0 });  // same set as a, other order
+
+    EXPECT_EQ(world.GetArchetypeCount(), 2u);
+    EXPECT_EQ(world.GetEntityCount(), 3u);
+    EXPECT_FLOAT_EQ(world.Get<Position>(c)->x, 3.0f);
+    EXPECT_EQ(world.Get<Velocity>(b), nullptr);
+    EXPECT_TRUE(world.Has<Velocity>(a));
+
+    // Only a and c have both
+    std::set<uint32_t> seen;
+    world.Each<Position, const Velocity>([&](Entity entity, Position& position, const Velocity& velocity) {
+        position.x += velocity.x;
+        seen.insert(entity.index);
+    });
+    EXPECT_EQ(seen, (std::set<uint32_t>{ a.index, c.index }));
+    EXPECT_FLOAT_EQ(world.Get<Position>(a)->x, 2.0f);
+    EXPECT_FLOAT_EQ(world.Get<Position>(b)->x, 2.0f);
+}
+
+TEST(EcsWorld, DestroyKeepsRowsPackedAndDetectsStaleEntities) {
+    EcsWorld world;
+    std::vector<Entity> entities;
+    // Several chunks' worth so the hole is filled from another chunk
+    for (int i = 0; i < 3000; i++) {
+        entities.push_back(world.Create(Position{ float(i), 0, 0 }, Name{ std::to_string(i) }));
+    }
+
+    world.Destroy(entities[10]);
+    EXPECT_FALSE(world.IsAlive(entities[10]));
+    EXPECT_EQ(world.Get<Position>(entities[10]), nullptr);
+
+    // The moved entity is still found through its handle
+    EXPECT_EQ(world.Get<Name>(entities.back())->value, "2999");
+    EXPECT_FLOAT_EQ(world.Get<Position>(entities.back())->x, 2999.0f);
+
+    // The slot is reused with a new generation; the old handle stays dead
+    const Entity reused = world.Create(Position{ -1, 0, 0 });
+    EXPECT_EQ(reused.index, entities[10].index);
+    EXPECT_NE(reused.generation, entities[10].generation);
+    EXPECT_FALSE(world.IsAlive(entities[10]));
+
+    size_t count = 0;
+    world.EachChunk<Name>([&](uint32_t rows, const Entity*, Name* names) {
+        for (uint32_t i = 0; i < rows; i++) EXPECT_FALSE(names[i].value.empty());
+        count += rows;
+    });
+    EXPECT_EQ(count, 2999u);
+}
+
+TEST(EcsWorld, AddAndRemoveMoveBetweenArchetypes) {
+    EcsWorld world;
+    const Entity first = world.Create(Position{ 1, 2, 3 });
+    const Entity second = world.Create(Position{ 4, 5, 6 });
+
+    Velocity* velocity = world.Add<Velocity>(first, Velocity{ 0, 1, 0 });
+    ASSERT_NE(velocity, nullptr);
+    EXPECT_FLOAT_EQ(velocity->y, 1.0f);
+    EXPECT_FLOAT_EQ(world.Get<Position>(first)->z, 3.0f);
+    EXPECT_FLOAT_EQ(world.Get<Position>(second)->x, 4.0f);
+
+    // Adding again replaces
+    world.Add<Velocity>(first, Velocity{ 0, 7, 0 });
+    EXPECT_FLOAT_EQ(world.Get<Velocity>(first)->y, 7.0f);
+
+    world.Remove<Position>(first);
+    EXPECT_FALSE(world.Has<Position>(first));
+    EXPECT_FLOAT_EQ(world.Get<Velocity>(first)->y, 7.0f);
+    EXPECT_EQ(world.GetEntityCount(), 2u);
+}
+
+TEST(EcsWorld, RunsComponentDestructors) {
+    auto counter = std::make_shared<int>(0);
+    {
+        EcsWorld world;
+        const Entity a = world.Create(Tracked{ counter });
+        const Entity b = world.Create(Tracked{ counter }, Position{});
+        world.Create(Tracked{ counter });
+        EXPECT_EQ(counter.use_count(), 4);
+
+        world.Destroy(a);
+        EXPECT_EQ(counter.use_count(), 3);
+
+        // Moving between archetypes relocates rather than copies
+        world.Remove<Position>(b);
+        EXPECT_EQ(counter.use_count(), 3);
+        world.Remove<Tracked>(b);
+        EXPECT_EQ(counter.use_count(), 2);
+    }
+    // World teardown destroys what's left
+    EXPECT_EQ(counter.use_count(), 1);
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "GameObjectManagerFixture.hpp"
+#include <thread>
+#include <vector>
+
+namespace {
+    struct Marker : Component {
+        int value = 0;
+        explicit Marker(int value) : value(value) {}
+    };
+    struct Doomed : Component {};
+
+    // Records structural changes from inside its own update
+    struct Recorder : Component {
+        GameObject* victim = nullptr;
+        void Update(double) override {
+            auto& commands = ServiceLocator::Get().GetService<GameObjectManager>()->GetCommands();
+            commands.Spawn<GameObject>();
+            commands.AddComponent<Marker>(owner, 7);
+            commands.RemoveComponent<Doomed>(owner);
+            if (victim) commands.Destroy(victim);
+            // Nothing applied yet: we're inside the update pass
+            EXPECT_FALSE(owner->HasComponent<Marker>());
+            EXPECT_TRUE(owner->HasComponent<Doomed>());
+        }
+    };
+
+    class GameObjectCommandBufferTest : public GameObjectManagerFixture {};
+}
+
+TEST_F(GameObjectCommandBufferTest, AppliesRecordedChangesAfterTheUpdatePass) {
+    GameObject* victim = manager->Adopt(std::make_unique<GameObject>());
+    GameObject actor;
+    actor.AddComponent<Doomed>();
+    Recorder* recorder = actor.AddComponent<Recorder>();
+    recorder->victim = victim;
+    EXPECT_EQ(manager->GetObjectCount(), 2u);
+
+    manager->UpdateAll(0.016);
+    recorder->victim = nullptr;
+
+    ASSERT_NE(actor.GetComponent<Marker>(), nullptr);
+    EXPECT_EQ(actor.GetComponent<Marker>()->value, 7);
+    EXPECT_FALSE(actor.HasComponent<Doomed>());
+    // victim gone, one spawned
+    EXPECT_EQ(manager->GetObjectCount(), 2u);
+    EXPECT_EQ(manager->GetCommands().GetPendingCount(), 0u);
+}
+
+TEST_F(GameObjectCommandBufferTest, WorkerThreadsRecordWithoutLocks) {
+    constexpr int kThreads = 4;
+    constexpr int kSpawnsPerThread = 500;
+
+    std::vector<GameObject*> owned;
+    for (int i = 0; i < kThreads; i++) owned.push_back(manager->Adopt(std::make_unique<GameObject>()));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&, t] {
+            auto& commands = manager->GetCommands();
+            for (int i = 0; i < kSpawnsPerThread; i++) commands.Spawn<GameObject>();
+            // Every thread destroys every owned object: each must die exactly once
+            for (GameObject* object : owned) commands.Destroy(object);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(manager->GetCommands().GetPendingCount(), size_t(kThreads * kSpawnsPerThread + kThreads));
+    manager->FlushCommands();
+    EXPECT_EQ(manager->GetObjectCount(), size_t(kThreads * kSpawnsPerThread));
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include "GameObjectManagerFixture.hpp"
+
+namespace {
+    struct Health : Component { int value = 100; };
+    struct Armor : Component { int value = 5; };
+    struct Tag : Component { int value = 0; explicit Tag(int value) : value(value) {} };
+    struct Unused : Component {};
+
+    class ComponentLookupTest : public GameObjectManagerFixture {};
+}
+
+TEST_F(ComponentLookupTest, FindsComponentsByType) {
+    GameObject object;
+    // Added in reverse type id order on purpose: slots must stay sorted by id
+    Component::GetTypeId<Health>();
+    Component::GetTypeId<Armor>();
+    Component::GetTypeId<Tag>();
+    Tag* tag = object.AddComponent<Tag>(3);
+    Armor* armor = object.AddComponent<Armor>();
+    Health* health = object.AddComponent<Health>();
+
+    EXPECT_EQ(object.GetComponent<Health>(), health);
+    EXPECT_EQ(object.GetComponent<Armor>(), armor);
+    EXPECT_EQ(object.GetComponent<Tag>(), tag);
+    EXPECT_EQ(object.GetComponent<Unused>(), nullptr);
+    EXPECT_TRUE(object.HasComponent<Armor>());
+    EXPECT_FALSE(object.HasComponent<Unused>());
+    EXPECT_EQ(tag->GetOwner(), &object);
+}
+
+TEST_F(ComponentLookupTest, FirstComponentOfATypeWins) {
+    GameObject object;
+    Tag* first = object.AddComponent<Tag>(1);
+    object.AddComponent<Tag>(2);
+    EXPECT_EQ(object.GetComponent<Tag>(), first);
+}
+
+TEST_F(ComponentLookupTest, TypeIdsAreStableAndDistinct) {
+    EXPECT_EQ(Component::GetTypeId<Health>(), Component::GetTypeId<Health>());
+    EXPECT_NE(Component::GetTypeId<Health>(), Component::GetTypeId<Armor>());
+    EXPECT_LT(Component::GetTypeId<Unused>(), Component::kMaxTypes);
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <Engine/GameObject.hpp>
+#include <Engine/Managers/GameObjectManager.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <memory>
+
+// Gives every test a fresh GameObjectManager; GameObjects register with whichever one the
+// ServiceLocator holds, so nothing leaks from one test into the next.
+// Derive a fixture named after the file (one suite per file) and extend SetUp as needed.
+class GameObjectManagerFixture : public ::testing::Test {
+protected:
+    std::shared_ptr<GameObjectManager> manager;
+    void SetUp() override { manager = ServiceLocator::Get().Create<GameObjectManager>(); }
+};
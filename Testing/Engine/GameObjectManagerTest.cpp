@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "GameObjectManagerFixture.hpp"
+#include <memory>
+#include <vector>
+#include <functional>
+
+namespace {
+    // Counts its updates and runs an optional action from inside UpdateAll
+    class Probe : public GameObject {
+    public:
+        int updates = 0;
+        std::function<void()> onUpdate;
+
+        void Update(double) override {
+            updates++;
+            if (onUpdate) {
+                auto action = std::move(onUpdate);
+                action();
+            }
+        }
+    };
+
+    class GameObjectManagerTest : public GameObjectManagerFixture {};
+}
+
+TEST_F(GameObjectManagerTest, RegistersAndRemovesInConstantTime) {
+    std::vector<std::unique_ptr<Probe>> probes;
+    for (int i = 0; i < 5; i++) probes.push_back(std::make_unique<Probe>());
+    EXPECT_EQ(manager->GetObjectCount(), 5u);
+
+    // Remove from the middle: the last object takes the slot and must still be updated
+    probes[1].reset();
+    manager->UpdateAll(0.016);
+    EXPECT_EQ(manager->GetObjectCount(), 4u);
+    for (auto& probe : probes) {
+        if (probe) {
+            EXPECT_EQ(probe->updates, 1);
+        }
+    }
+}
+
+TEST_F(GameObjectManagerTest, ObjectsCanBeDestroyedDuringUpdate) {
+    std::vector<std::unique_ptr<Probe>> probes;
+    for (int i = 0; i < 6; i++) probes.push_back(std::make_unique<Probe>());
+
+    // Object 0 destroys a later object (never updated) and itself, object 3 destroys the last one
+    probes[0]->onUpdate = [&] { probes[2].reset(); probes[0].reset(); };
+    probes[3]->onUpdate = [&] { probes[5].reset(); };
+    manager->UpdateAll(0.016);
+
+    EXPECT_EQ(manager->GetObjectCount(), 3u);
+    EXPECT_EQ(probes[1]->updates, 1);
+    EXPECT_EQ(probes[3]->updates, 1);
+    EXPECT_EQ(probes[4]->updates, 1);
+
+    // Survivors keep updating exactly once per frame after compaction
+    manager->UpdateAll(0.016);
+    EXPECT_EQ(probes[1]->updates, 2);
+    EXPECT_EQ(probes[3]->updates, 2);
+    EXPECT_EQ(probes[4]->updates, 2);
+}
+
+TEST_F(GameObjectManagerTest, ObjectsSpawnedDuringUpdateStartNextFrame) {
+    auto spawner = std::make_unique<Probe>();
+    std::unique_ptr<Probe> spawned;
+    spawner->onUpdate = [&] { spawned = std::make_unique<Probe>(); };
+
+    manager->UpdateAll(0.016);
+    ASSERT_NE(spawned, nullptr);
+    EXPECT_EQ(spawned->updates, 0);
+    manager->UpdateAll(0.016);
+    EXPECT_EQ(spawned->updates, 1);
+    EXPECT_EQ(manager->GetObjectCount(), 2u);
+}
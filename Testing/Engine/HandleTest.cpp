@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "GameObjectManagerFixture.hpp"
+#include <Engine/Utils/Handle.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Health : Component {
+        int value = 100;
+    };
+    struct Armor : Component {};
+
+    class HandleTest : public GameObjectManagerFixture {};
+}
+
+TEST_F(HandleTest, SlotMapRemovedHandlesGoStaleEvenWhenTheSlotIsReused) {
+    SlotMap<std::string> map;
+    const auto a = map.Insert("a");
+    const auto b = map.Insert("b");
+    const auto c = map.Insert("c");
+
+    // Swap-and-pop: "c" moves into a's place and keeps resolving
+    EXPECT_TRUE(map.Remove(a));
+    EXPECT_FALSE(map.Remove(a));
+    EXPECT_EQ(map.Get(a), nullptr);
+    ASSERT_NE(map.Get(c), nullptr);
+    EXPECT_EQ(*map.Get(c), "c");
+    EXPECT_EQ(*map.Get(b), "b");
+    EXPECT_EQ(map.Size(), 2u);
+
+    // Same slot, new generation
+    const auto d = map.Insert("d");
+    EXPECT_EQ(d.index, a.index);
+    EXPECT_NE(d, a);
+    EXPECT_EQ(map.Get(a), nullptr);
+    EXPECT_EQ(*map.Get(d), "d");
+
+    // Dense storage iterates live values only, and knows their handles
+    std::vector<std::string> values(map.begin(), map.end());
+    EXPECT_EQ(values.size(), 3u);
+    for (size_t i = 0; i < map.Size(); i++) EXPECT_EQ(*map.Get(map.HandleAt(i)), values[i]);
+
+    map.Clear();
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(map.Get(b), nullptr);
+    EXPECT_EQ(map.Get(Handle<std::string>()), nullptr);
+    EXPECT_EQ(map.Get(Handle<std::string>::FromValue(d.Value())), nullptr);
+}
+
+TEST_F(HandleTest, GameObjectHandlesResolveUntilDestroyed) {
+    auto object = std::make_unique<GameObject>();
+    const GameObjectHandle handle = object->GetHandle();
+    ASSERT_TRUE(handle.IsValid());
+    EXPECT_EQ(manager->Resolve(handle), object.get());
+
+    object.reset();
+    EXPECT_EQ(manager->Resolve(handle), nullptr);
+
+    // The next object may take the slot, not the handle
+    auto next = std::make_unique<GameObject>();
+    EXPECT_EQ(manager->Resolve(handle), nullptr);
+    EXPECT_EQ(manager->Resolve(next->GetHandle()), next.get());
+}
+
+TEST_F(HandleTest, ComponentHandlesFollowAddAndRemove) {
+    GameObject object;
+    Health* health = object.AddComponent<Health>();
+    const ComponentHandle handle = health->GetHandle();
+
+    EXPECT_EQ(manager->Resolve(handle), health);
+    EXPECT_EQ(manager->Resolve<Health>(handle), health);
+    EXPECT_EQ(manager->Resolve<Armor>(handle), nullptr);
+
+    object.RemoveComponent<Health>();
+    EXPECT_EQ(manager->Resolve(handle), nullptr);
+
+    // Destroying the owner retires every component handle, even mid-update
+    const ComponentHandle armor = object.AddComponent<Armor>()->GetHandle();
+    GameObject* spawned = manager->Adopt(std::make_unique<GameObject>());
+    const ComponentHandle spawnedHealth = spawned->AddComponent<Health>()->GetHandle();
+    EXPECT_NE(manager->Resolve<Armor>(armor), nullptr);
+    manager->GetCommands().Destroy(spawned);
+    manager->UpdateAll(0.016);
+    EXPECT_EQ(manager->Resolve(spawnedHealth), nullptr);
+    EXPECT_NE(manager->Resolve<Armor>(armor), nullptr);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "GameObjectManagerFixture.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Mesh {
+        std::string name;
+    };
+
+    // Shares its asset between copies, like a MeshRenderer's model
+    struct Visual : Component {
+        std::shared_ptr<const Mesh> mesh;
+        float tint = 0.0f;
+    };
+
+    struct Spinner : Component {
+        void Update(double deltaTime) override { angle += static_cast<float>(deltaTime); }
+        void PostUpdate(double) override { posts++; }
+        float angle = 0.0f;
+        int posts = 0;
+    };
+
+    // Owns something: not copyable
+    struct Unique : Component {
+        std::unique_ptr<int> value = std::make_unique<int>(1);
+    };
+
+    class InstantiateTest : public GameObjectManagerFixture {
+    protected:
+        void SetUp() override {
+            GameObjectManagerFixture::SetUp();
+            manager->SetParallelUpdate(false);
+        }
+    };
+}
+
+TEST_F(InstantiateTest, CopiesThePrototypeOncePerPose) {
+    GameObject prototype{ GameObject::Unregistered{} };
+    Visual* visual = prototype.AddComponent<Visual>();
+    visual->mesh = std::make_shared<Mesh>(Mesh{ "rock" });
+    visual->tint = 0.5f;
+    prototype.AddComponent<Spinner>()->angle = 1.0f;
+    prototype.SetUpdateImportance(2.0f);
+
+    TransformBatch poses;
+    for (int i = 0; i < 100; i++) {
+        poses.Add(glm::vec3(float(i), 0.0f, 0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f + i));
+    }
+    const std::vector<GameObject*> spawned = manager->Instantiate(prototype, poses);
+    ASSERT_EQ(spawned.size(), 100u);
+    EXPECT_EQ(manager->GetObjectCount(), 100u);
+    EXPECT_EQ(manager->GetTickCount(TickGroup::PostUpdate), 100u);
+    // 100 copies + the prototype, one Mesh
+    EXPECT_EQ(visual->mesh.use_count(), 101);
+
+    GameObject* last = spawned.back();
+    EXPECT_EQ(last->GetTransform().GetLocalPosition(), glm::vec3(99.0f, 0.0f, 0.0f));
+    EXPECT_EQ(last->GetTransform().GetLocalScale(), glm::vec3(100.0f));
+    EXPECT_EQ(last->GetUpdateImportance(), 2.0f);
+    EXPECT_EQ(manager->Resolve(last->GetHandle()), last);
+    ASSERT_NE(last->GetComponent<Visual>(), nullptr);
+    EXPECT_EQ(last->GetComponent<Visual>()->tint, 0.5f);
+    EXPECT_EQ(last->GetComponent<Visual>()->GetOwner(), last);
+    EXPECT_EQ(manager->Resolve<Spinner>(last->GetComponent<Spinner>()->GetHandle()), last->GetComponent<Spinner>());
+
+    // The copies update, the prototype doesn't
+    manager->UpdateAll(0.25);
+    EXPECT_FLOAT_EQ(last->GetComponent<Spinner>()->angle, 1.25f);
+    EXPECT_EQ(last->GetComponent<Spinner>()->posts, 1);
+    EXPECT_FLOAT_EQ(prototype.GetComponent<Spinner>()->angle, 1.0f);
+
+    // Owned by the manager
+    EXPECT_TRUE(manager->DestroyOwned(spawned.front()));
+    EXPECT_EQ(manager->GetObjectCount(), 99u);
+}
+
+TEST_F(InstantiateTest, ReservesPoolStorageUpFront) {
+    GameObject prototype{ GameObject::Unregistered{} };
+    prototype.AddComponent<Visual>();
+
+    const size_t chunksBefore = ObjectPool::For<Visual>().GetStats().chunks;
+    TransformBatch poses;
+    for (int i = 0; i < 5000; i++) poses.Add(glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+    const std::vector<GameObject*> spawned = manager->Instantiate(prototype, poses);
+    ASSERT_EQ(spawned.size(), 5000u);
+
+    // One new chunk, however many 64 KiB chunks 5000 of them take, filled front to back
+    EXPECT_EQ(ObjectPool::For<Visual>().GetStats().chunks, chunksBefore + 1);
+    const size_t slotSize = ObjectPool::For<Visual>().GetStats().slotSize;
+    for (size_t i = 1; i < 1000; i++) {
+        const auto* previous = reinterpret_cast<const unsigned char*>(spawned[i - 1]->GetComponent<Visual>());
+        const auto* current = reinterpret_cast<const unsigned char*>(spawned[i]->GetComponent<Visual>());
+        ASSERT_EQ(current - previous, static_cast<ptrdiff_t>(slotSize));
+    }
+}
+
+TEST_F(InstantiateTest, RefusesPrototypesWithUncopyableComponents) {
+    GameObject prototype{ GameObject::Unregistered{} };
+    prototype.AddComponent<Visual>();
+    prototype.AddComponent<Unique>();
+    EXPECT_FALSE(Component::IsCopyable(Component::GetTypeId<Unique>()));
+
+    TransformBatch poses;
+    poses.Add(glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+    EXPECT_TRUE(manager->Instantiate(prototype, poses).empty());
+    EXPECT_EQ(manager->GetObjectCount(), 0u);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <Engine/Jobs/JobSystem.hpp>
+#include <Engine/Utils/ParallelFor.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+    class JobSystemTest : public ::testing::Test {
+    protected:
+        std::shared_ptr<JobSystem> jobs;
+        void SetUp() override { jobs = ServiceLocator::Get().Create<JobSystem>(3u); }
+    };
+}
+
+TEST_F(JobSystemTest, RunsEveryJobBeforeTheCounterIsDone) {
+    std::atomic<int> sum{ 0 };
+    JobCounter counter;
+    for (int i = 1; i <= 1000; i++) {
+        jobs->Schedule([&sum, i] { sum.fetch_add(i); }, &counter);
+    }
+    jobs->Wait(counter);
+
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(sum.load(), 500500);
+    EXPECT_GE(jobs->GetStats().executed, 1000u);
+
+    // Reusable once done
+    jobs->Schedule([&sum] { sum.store(0); }, &counter);
+    jobs->Wait(counter);
+    EXPECT_EQ(sum.load(), 0);
+}
+
+TEST_F(JobSystemTest, DependentJobsWaitForTheirCounters) {
+    // Diamond: load -> (left, right) -> merge
+    std::atomic<int> step{ 0 };
+    int loadStep = -1, leftStep = -1, rightStep = -1, mergeStep = -1;
+    JobCounter loaded, sides, merged;
+
+    jobs->Schedule([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        loadStep = step++;
+    }, &loaded);
+    jobs->Schedule([&] { leftStep = step++; }, { &loaded }, &sides);
+    jobs->Schedule([&] { rightStep = step++; }, { &loaded, nullptr }, &sides);
+    jobs->Schedule([&] { mergeStep = step++; }, { &sides }, &merged);
+    jobs->Wait(merged);
+
+    EXPECT_EQ(loadStep, 0);
+    EXPECT_GT(leftStep, loadStep);
+    EXPECT_GT(rightStep, loadStep);
+    EXPECT_EQ(mergeStep, 3);
+
+    // Nothing to wait for: queued straight away
+    JobCounter done;
+    bool ran = false;
+    jobs->Schedule([&] { ran = true; }, { &loaded, &sides }, &done);
+    jobs->Wait(done);
+    EXPECT_TRUE(ran);
+}
+
+TEST_F(JobSystemTest, ParallelForVisitsEveryIndexOnce) {
+    const size_t count = 10007;
+    std::vector<std::atomic<int>> hits(count);
+    jobs->ParallelFor(count, [&](size_t i) { hits[i].fetch_add(1); });
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_EQ(hits[i].load(), 1) << "index " << i;
+    }
+
+    // Nested, from inside jobs
+    std::vector<std::atomic<int>> nested(64 * 100);
+    jobs->ParallelFor(64, [&](size_t outer) {
+        jobs->ParallelFor(100, [&](size_t inner) { nested[outer * 100 + inner].fetch_add(1); });
+    });
+    for (auto& hit : nested) {
+        ASSERT_EQ(hit.load(), 1);
+    }
+
+    // The engine-wide helper goes through the registered job system
+    const uint64_t before = jobs->GetStats().executed;
+    std::atomic<size_t> visited{ 0 };
+    ParallelFor(256, [&](size_t) { visited++; });
+    EXPECT_EQ(visited.load(), 256u);
+    EXPECT_GT(jobs->GetStats().executed, before);
+}
+
+TEST_F(JobSystemTest, MainThreadJobsOnlyRunOnTheMainThread) {
+    const std::thread::id mainThread = std::this_thread::get_id();
+    std::thread::id workerThread, glThread;
+    JobCounter counter;
+
+    // A worker job hands its GL part back to the main thread
+    jobs->Schedule([&] {
+        workerThread = std::this_thread::get_id();
+        jobs->Schedule([&] { glThread = std::this_thread::get_id(); }, &counter, JobAffinity::MainThread);
+    }, &counter);
+    jobs->Wait(counter);
+    EXPECT_EQ(glThread, mainThread);
+
+    // Queued for the frame, run by RunMainThreadJobs
+    int uploads = 0;
+    JobCounter frame;
+    jobs->Schedule([&] { uploads++; }, &frame, JobAffinity::MainThread);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(uploads, 0);
+    jobs->RunMainThreadJobs();
+    EXPECT_EQ(uploads, 1);
+    EXPECT_TRUE(frame.IsDone());
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "GameObjectManagerFixture.hpp"
+#include <Engine/Utils/ObjectPool.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <cstdint>
+
+namespace {
+    struct Particle {
+        float position[3];
+        float velocity[3];
+    };
+
+    struct alignas(64) Wide {
+        float lanes[16];
+    };
+
+    struct Payload : Component {
+        int value = 0;
+        explicit Payload(int value) : value(value) {}
+    };
+
+    class Projectile : public GameObject {};
+
+    struct Fragile {
+        explicit Fragile(bool fail) {
+            if (fail) throw std::runtime_error("Fragile");
+        }
+    };
+
+    class ObjectPoolTest : public GameObjectManagerFixture {};
+}
+
+TEST_F(ObjectPoolTest, FillsChunksInOrderAndReusesTheLatestFreedSlot) {
+    ObjectPool pool("Particle", sizeof(Particle), alignof(Particle));
+
+    std::vector<void*> slots;
+    for (int i = 0; i < 100; i++) slots.push_back(pool.Allocate());
+    for (size_t i = 1; i < slots.size(); i++) {
+        EXPECT_EQ(static_cast<char*>(slots[i]) - static_cast<char*>(slots[i - 1]), ptrdiff_t(pool.GetStats().slotSize));
+    }
+
+    ObjectPool::Free(slots[10]);
+    ObjectPool::Free(slots[20]);
+    EXPECT_EQ(pool.Allocate(), slots[20]);
+    EXPECT_EQ(pool.Allocate(), slots[10]);
+
+    const ObjectPool::Stats& stats = pool.GetStats();
+    EXPECT_EQ(stats.allocations, 102u);
+    EXPECT_EQ(stats.frees, 2u);
+    EXPECT_EQ(stats.live, 100u);
+    EXPECT_EQ(stats.peak, 100u);
+    EXPECT_EQ(stats.chunks, 1u);
+    EXPECT_GE(stats.capacity, 100u);
+}
+
+TEST_F(ObjectPoolTest, KeepsOverAlignedTypesAligned) {
+    ObjectPool pool("Wide", sizeof(Wide), alignof(Wide));
+    for (int i = 0; i < 50; i++) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(pool.Allocate()) % alignof(Wide), 0u);
+    }
+
+    Wide* wide = ObjectPool::New<Wide>();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(wide) % alignof(Wide), 0u);
+    ObjectPool::Delete(wide);
+}
+
+TEST_F(ObjectPoolTest, ThrowingConstructorGivesTheSlotBack) {
+    const ObjectPool::Stats& stats = ObjectPool::For<Fragile>().GetStats();
+    // Freed last, so it's the slot the failing New takes
+    Fragile* next = ObjectPool::New<Fragile>(false);
+    ObjectPool::Delete(next);
+    const size_t live = stats.live;
+
+    EXPECT_THROW(ObjectPool::New<Fragile>(true), std::runtime_error);
+    EXPECT_EQ(stats.live, live);
+
+    Fragile* again = ObjectPool::New<Fragile>(false);
+    EXPECT_EQ(again, next);
+    ObjectPool::Delete(again);
+}
+
+TEST_F(ObjectPoolTest, ComponentsAndSpawnedObjectsComeFromTheirTypesPool) {
+    const ObjectPool::Stats& components = ObjectPool::For<Payload>().GetStats();
+    const ObjectPool::Stats& objects = ObjectPool::For<Projectile>().GetStats();
+    const size_t componentsBefore = components.live;
+    const size_t objectsBefore = objects.live;
+
+    for (int i = 0; i < 10; i++) manager->GetCommands().Spawn<Projectile>();
+    manager->FlushCommands();
+    EXPECT_EQ(objects.live, objectsBefore + 10);
+
+    {
+        GameObject holder;
+        EXPECT_EQ(holder.AddComponent<Payload>(7)->value, 7);
+        EXPECT_EQ(components.live, componentsBefore + 1);
+        holder.RemoveComponent<Payload>();
+        EXPECT_EQ(components.live, componentsBefore);
+        holder.AddComponent<Payload>(8);
+    }
+    // Freed with its owner
+    EXPECT_EQ(components.live, componentsBefore);
+
+    // A plain new goes to the pool of its size and deletes back into it
+    std::unique_ptr<Projectile> loose(new Projectile());
+    const ObjectPool::Stats& bySize = ObjectPool::ForSize(sizeof(Projectile)).GetStats();
+    EXPECT_GE(bySize.live, 1u);
+    const size_t liveBySize = bySize.live;
+    loose.reset();
+    EXPECT_EQ(bySize.live, liveBySize - 1);
+
+    // Replacing the manager deletes the objects it owns
+    manager.reset();
+    ServiceLocator::Get().Create<GameObjectManager>();
+    EXPECT_EQ(objects.live, objectsBefore);
+}
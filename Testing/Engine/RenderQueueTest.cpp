@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <Engine/Utils/RenderQueue.hpp>
+#include <OPENGL/glm/gtc/matrix_transform.hpp>
+#include <vector>
+
+namespace {
+    RenderPacket MakePacket(uint32_t shader, uint32_t material, const glm::vec3& center, float radius = 1.0f) {
+        RenderPacket packet;
+        packet.world = glm::translate(glm::mat4(1.0f), center);
+        packet.bounds = glm::vec4(center, radius);
+        packet.sortKey = RenderQueue::MakeSortKey(shader, material, glm::length(center));
+        packet.material.index = material;
+        return packet;
+    }
+
+    // At the origin, looking down -z
+    Frustum MakeFrustum() {
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        return Frustum::FromMatrix(glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f) * view);
+    }
+}
+
+TEST(RenderQueue, SortKeysGroupByShaderThenMaterialThenDistance) {
+    EXPECT_LT(RenderQueue::MakeSortKey(0, 5, 90.0f), RenderQueue::MakeSortKey(1, 0, 1.0f));
+    EXPECT_LT(RenderQueue::MakeSortKey(1, 2, 90.0f), RenderQueue::MakeSortKey(1, 3, 1.0f));
+    EXPECT_LT(RenderQueue::MakeSortKey(1, 3, 1.0f), RenderQueue::MakeSortKey(1, 3, 1.5f));
+    EXPECT_LT(RenderQueue::MakeSortKey(1, 3, 0.25f), RenderQueue::MakeSortKey(1, 3, 1000.0f));
+    // Negative distances clamp to the front
+    EXPECT_EQ(RenderQueue::MakeSortKey(1, 3, -4.0f), RenderQueue::MakeSortKey(1, 3, 0.0f));
+}
+
+TEST(RenderQueue, CullsPacketsOutsideTheFrustum) {
+    RenderQueue queue;
+    const std::vector<RenderPacket> input = {
+        MakePacket(0, 0, glm::vec3(0.0f, 0.0f, -10.0f)),
+        MakePacket(0, 1, glm::vec3(0.0f, 0.0f, 10.0f)),           // behind
+        MakePacket(0, 2, glm::vec3(0.0f, 0.0f, -200.0f)),         // past the far plane
+        MakePacket(0, 3, glm::vec3(0.0f, 0.0f, -200.0f), 150.0f), // but big enough to reach into view
+        MakePacket(0, 4, glm::vec3(50.0f, 0.0f, -10.0f)),         // off to the side
+    };
+    queue.Resize(input.size());
+    std::copy(input.begin(), input.end(), queue.Data());
+
+    EXPECT_EQ(queue.Cull(MakeFrustum()), 3u);
+    ASSERT_EQ(queue.Size(), 2u);
+    EXPECT_EQ(queue.GetPackets()[0].material.index, 0u);
+    EXPECT_EQ(queue.GetPackets()[1].material.index, 3u);
+}
+
+TEST(RenderQueue, SortsIndicesAndLeavesThePacketsInPlace) {
+    RenderQueue queue;
+    const std::vector<RenderPacket> input = {
+        MakePacket(1, 0, glm::vec3(0.0f, 0.0f, -5.0f)),
+        MakePacket(0, 7, glm::vec3(0.0f, 0.0f, -50.0f)),
+        MakePacket(0, 7, glm::vec3(0.0f, 0.0f, -2.0f)),
+        MakePacket(0, 2, glm::vec3(0.0f, 0.0f, -30.0f)),
+    };
+    queue.Resize(input.size());
+    std::copy(input.begin(), input.end(), queue.Data());
+    queue.Sort();
+
+    EXPECT_EQ(queue.GetOrder(), (std::vector<uint32_t>{ 3, 2, 1, 0 }));
+    EXPECT_EQ(queue.GetPackets()[0].sortKey, input[0].sortKey);
+
+    // Resizing for the next frame drops the old order
+    queue.Resize(1);
+    EXPECT_TRUE(queue.GetOrder().empty());
+}
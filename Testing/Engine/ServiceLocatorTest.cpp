@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+    class Counter : public IService {
+        friend class ::ServiceLocator;
+    public:
+        int value = 0;
+    private:
+        explicit Counter(int start) : value(start) {}
+    };
+
+    // Never created
+    class Missing : public IService {};
+}
+
+TEST(ServiceLocator, EveryAccessorSeesTheCreatedService) {
+    std::shared_ptr<Counter> counter = ServiceLocator::Get().Create<Counter>(7);
+    EXPECT_EQ(ServiceLocator::Get().GetService<Counter>(), counter);
+    EXPECT_EQ(ServiceLocator::Get().TryGetService<Counter>(), counter);
+    EXPECT_EQ(&ServiceLocator::GetServiceRef<Counter>(), counter.get());
+    EXPECT_EQ(ServiceLocator::TryGetServicePtr<Counter>(), counter.get());
+    EXPECT_EQ(ServiceLocator::GetServiceRef<Counter>().value, 7);
+}
+
+TEST(ServiceLocator, CreatingAgainReplacesTheService) {
+    std::shared_ptr<Counter> first = ServiceLocator::Get().Create<Counter>(1);
+    std::shared_ptr<Counter> second = ServiceLocator::Get().Create<Counter>(2);
+    EXPECT_EQ(ServiceLocator::TryGetServicePtr<Counter>(), second.get());
+    // Still alive while someone holds it
+    EXPECT_EQ(first->value, 1);
+    EXPECT_EQ(first.use_count(), 1);
+}
+
+TEST(ServiceLocator, MissingServicesThrowOrReturnNull) {
+    EXPECT_THROW(ServiceLocator::Get().GetService<Missing>(), std::runtime_error);
+    EXPECT_THROW(ServiceLocator::GetServiceRef<Missing>(), std::runtime_error);
+    EXPECT_EQ(ServiceLocator::Get().TryGetService<Missing>(), nullptr);
+    EXPECT_EQ(ServiceLocator::TryGetServicePtr<Missing>(), nullptr);
+}
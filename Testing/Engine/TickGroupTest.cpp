@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "GameObjectManagerFixture.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::string> trace;
+
+    struct DataOnly : Component {};
+
+    struct Steering : Component {
+        void PreUpdate(double) override { trace.push_back("pre"); }
+        void Update(double) override { trace.push_back("update"); }
+    };
+
+    struct Follower : Component {
+        void PostUpdate(double) override { trace.push_back("post"); }
+        void PreRender(double) override { trace.push_back("render"); }
+    };
+
+    struct Sprite : Component {
+        void Draw(Shader&) override {}
+    };
+
+    // Inherits its hooks: still takes part in those groups
+    struct FastFollower : Follower {};
+
+    // Removes another object's component from inside a group
+    struct Remover : Component {
+        GameObject* victim = nullptr;
+        void PreUpdate(double) override {
+            if (victim) victim->RemoveComponent<Follower>();
+            victim = nullptr;
+        }
+    };
+
+    class TickGroupTest : public GameObjectManagerFixture {
+    protected:
+        void SetUp() override {
+            GameObjectManagerFixture::SetUp();
+            manager->SetParallelUpdate(false);
+            trace.clear();
+        }
+    };
+}
+
+TEST_F(TickGroupTest, DetectsOverriddenHooksAtCompileTime) {
+    static_assert(Component::PhasesOf<DataOnly>() == 0);
+    static_assert(Component::PhasesOf<Steering>() == (Component::PhaseBit(TickGroup::PreUpdate) | Component::PhaseBit(TickGroup::Update)));
+    static_assert(Component::PhasesOf<Follower>() == (Component::PhaseBit(TickGroup::PostUpdate) | Component::PhaseBit(TickGroup::PreRender)));
+    static_assert(Component::PhasesOf<FastFollower>() == Component::PhasesOf<Follower>());
+    static_assert(Component::PhasesOf<Sprite>() == Component::kDrawPhase);
+}
+
+TEST_F(TickGroupTest, RunsGroupsInOrderAndOnlyTheirComponents) {
+    GameObject a;
+    a.AddComponent<DataOnly>();
+    a.AddComponent<Follower>();
+    a.AddComponent<Sprite>();
+    GameObject b;
+    b.AddComponent<Steering>();
+    b.AddComponent<DataOnly>();
+
+    EXPECT_EQ(manager->GetTickCount(TickGroup::PreUpdate), 1u);
+    EXPECT_EQ(manager->GetTickCount(TickGroup::Update), 0u);
+    EXPECT_EQ(manager->GetTickCount(TickGroup::PostUpdate), 1u);
+    EXPECT_EQ(manager->GetTickCount(TickGroup::PreRender), 1u);
+
+    manager->UpdateAll(0.016);
+    EXPECT_EQ(trace, (std::vector<std::string>{ "pre", "update", "post", "render" }));
+}
+
+TEST_F(TickGroupTest, ComponentsRemovedDuringAGroupAreSkippedAndCompacted) {
+    GameObject victim;
+    victim.AddComponent<Follower>();
+    GameObject other;
+    other.AddComponent<FastFollower>();
+    GameObject actor;
+    actor.AddComponent<Remover>()->victim = &victim;
+
+    manager->UpdateAll(0.016);
+    // Only FastFollower is left in PostUpdate / PreRender
+    EXPECT_EQ(trace, (std::vector<std::string>{ "post", "render" }));
+    EXPECT_EQ(manager->GetTickCount(TickGroup::PostUpdate), 1u);
+
+    trace.clear();
+    manager->UpdateAll(0.016);
+    EXPECT_EQ(trace, (std::vector<std::string>{ "post", "render" }));
+}
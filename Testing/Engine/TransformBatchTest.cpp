@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <Engine/Utils/TransformBatch.hpp>
+#include <OPENGL/glm/gtc/matrix_transform.hpp>
+
+namespace {
+    // 13 objects: two 4/8-wide blocks and a scalar tail
+    TransformBatch MakeBatch() {
+        TransformBatch batch;
+        for (int i = 0; i < 13; i++) {
+            const glm::quat rotation = glm::angleAxis(0.3f * i, glm::normalize(glm::vec3(1.0f, 0.5f * i, -0.25f)));
+            batch.Add(glm::vec3(i, -2.0f * i, 0.5f), rotation, glm::vec3(1.0f + i, 0.5f, 2.0f - 0.1f * i));
+        }
+        return batch;
+    }
+}
+
+TEST(TransformBatch, MatchesGlmTranslateRotateScale) {
+    const TransformBatch batch = MakeBatch();
+    std::vector<glm::mat4> models(batch.Size());
+    std::vector<glm::mat3> normals(batch.Size());
+    ComputeTrsMatrices(batch, models.data(), normals.data());
+
+    for (size_t i = 0; i < batch.Size(); i++) {
+        const glm::quat rotation(batch.rotationW[i], batch.rotationX[i], batch.rotationY[i], batch.rotationZ[i]);
+        const glm::mat4 expected = glm::translate(glm::mat4(1.0f), glm::vec3(batch.positionX[i], batch.positionY[i], batch.positionZ[i]))
+            * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.0f), glm::vec3(batch.scaleX[i], batch.scaleY[i], batch.scaleZ[i]));
+        const glm::mat3 expectedNormal = glm::transpose(glm::inverse(glm::mat3(expected)));
+
+        for (int c = 0; c < 4; c++) {
+            for (int r = 0; r < 4; r++) EXPECT_NEAR(models[i][c][r], expected[c][r], 1e-4f) << "object " << i;
+        }
+        for (int c = 0; c < 3; c++) {
+            for (int r = 0; r < 3; r++) EXPECT_NEAR(normals[i][c][r], expectedNormal[c][r], 1e-4f) << "object " << i;
+        }
+    }
+}
+
+TEST(TransformBatch, SimdMatchesScalarAndHandlesZeroScale) {
+    TransformBatch batch = MakeBatch();
+    batch.scaleY[2] = 0.0f;
+
+    std::vector<glm::mat4> simdModels(batch.Size()), scalarModels(batch.Size());
+    std::vector<glm::mat3> simdNormals(batch.Size()), scalarNormals(batch.Size());
+    ComputeTrsMatrices(batch, simdModels.data(), simdNormals.data(), true);
+    ComputeTrsMatrices(batch, scalarModels.data(), scalarNormals.data(), false);
+
+    for (size_t i = 0; i < batch.Size(); i++) {
+        for (int c = 0; c < 4; c++) {
+            for (int r = 0; r < 4; r++) EXPECT_NEAR(simdModels[i][c][r], scalarModels[i][c][r], 1e-5f);
+        }
+        for (int c = 0; c < 3; c++) {
+            for (int r = 0; r < 3; r++) EXPECT_NEAR(simdNormals[i][c][r], scalarNormals[i][c][r], 1e-5f);
+        }
+    }
+    EXPECT_EQ(simdNormals[2][1], glm::vec3(0.0f));
+
+    // Normals are optional
+    ComputeTrsMatrices(batch, simdModels.data(), nullptr);
+}
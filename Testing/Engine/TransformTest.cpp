@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <Engine/GameObjectComponents/Transform.hpp>
+#include <OPENGL/glm/gtc/matrix_transform.hpp>
+
+namespace {
+    void ExpectNear(const glm::mat4& a, const glm::mat4& b, float tolerance = 1e-4f) {
+        for (int c = 0; c < 4; c++) {
+            for (int r = 0; r < 4; r++) EXPECT_NEAR(a[c][r], b[c][r], tolerance) << "column " << c << " row " << r;
+        }
+    }
+
+    void ExpectNear(const glm::mat3& a, const glm::mat3& b, float tolerance = 1e-4f) {
+        for (int c = 0; c < 3; c++) {
+            for (int r = 0; r < 3; r++) EXPECT_NEAR(a[c][r], b[c][r], tolerance) << "column " << c << " row " << r;
+        }
+    }
+}
+
+TEST(Transform, MatchesTheOldEulerMatrixChain) {
+    const glm::vec3 position(1.0f, -2.0f, 3.0f);
+    const glm::vec3 degrees(30.0f, 45.0f, -60.0f);
+    const glm::vec3 scale(2.0f, 0.5f, 1.5f);
+
+    glm::mat4 expected(1.0f);
+    expected = glm::translate(expected, position);
+    expected = glm::rotate(expected, glm::radians(degrees.x), glm::vec3(1, 0, 0));
+    expected = glm::rotate(expected, glm::radians(degrees.y), glm::vec3(0, 1, 0));
+    expected = glm::rotate(expected, glm::radians(degrees.z), glm::vec3(0, 0, 1));
+    expected = glm::scale(expected, scale);
+
+    Transform transform;
+    transform.SetLocalPosition(position);
+    transform.SetLocalEulerAngles(degrees);
+    transform.SetLocalScale(scale);
+    ExpectNear(transform.GetWorldMatrix(), expected);
+    ExpectNear(transform.GetNormalMatrix(), glm::transpose(glm::inverse(glm::mat3(expected))));
+}
+
+TEST(Transform, UniformScaleNormalMatrixMatchesInverseTranspose) {
+    Transform parent, child;
+    child.SetParent(&parent);
+    parent.SetLocalScale(3.0f);
+    parent.SetLocalEulerAngles(glm::vec3(10.0f, 20.0f, 30.0f));
+    child.SetLocalScale(0.5f);
+    child.SetLocalEulerAngles(glm::vec3(0.0f, 90.0f, 0.0f));
+
+    const glm::mat3 linear(child.GetWorldMatrix());
+    ExpectNear(child.GetNormalMatrix(), glm::transpose(glm::inverse(linear)));
+}
+
+TEST(Transform, ChildrenFollowTheirParentAndStayCachedOtherwise) {
+    Transform root, child, grandchild;
+    child.SetParent(&root);
+    grandchild.SetParent(&child);
+    EXPECT_EQ(grandchild.GetDepth(), 2);
+
+    child.SetLocalPosition(glm::vec3(0.0f, 1.0f, 0.0f));
+    grandchild.SetLocalPosition(glm::vec3(0.0f, 0.0f, 1.0f));
+    EXPECT_EQ(grandchild.GetWorldPosition(), glm::vec3(0.0f, 1.0f, 1.0f));
+    EXPECT_FALSE(child.IsWorldDirty());
+
+    root.SetLocalPosition(glm::vec3(5.0f, 0.0f, 0.0f));
+    EXPECT_TRUE(grandchild.IsWorldDirty());
+    EXPECT_EQ(grandchild.GetWorldPosition(), glm::vec3(5.0f, 1.0f, 1.0f));
+
+    // Reparenting keeping the world position
+    grandchild.SetParent(&root, true);
+    EXPECT_EQ(grandchild.GetDepth(), 1);
+    const glm::vec3 world = grandchild.GetWorldPosition();
+    EXPECT_NEAR(world.y, 1.0f, 1e-5f);
+    EXPECT_NEAR(world.z, 1.0f, 1e-5f);
+
+    // No cycles
+    root.SetParent(&grandchild);
+    EXPECT_EQ(root.GetParent(), nullptr);
+}
+
+TEST(Transform, HierarchyUpdatesParentsBeforeChildren) {
+    TransformHierarchy hierarchy;
+    Transform leaf, middle, root;
+    // Registered leaf first: the pass must still reach root before them
+    hierarchy.Register(&leaf);
+    hierarchy.Register(&middle);
+    hierarchy.Register(&root);
+    middle.SetParent(&root);
+    leaf.SetParent(&middle);
+
+    root.SetLocalPosition(glm::vec3(1.0f, 0.0f, 0.0f));
+    middle.SetLocalPosition(glm::vec3(1.0f, 0.0f, 0.0f));
+    leaf.SetLocalPosition(glm::vec3(1.0f, 0.0f, 0.0f));
+    hierarchy.Update();
+    EXPECT_EQ(hierarchy.GetStats().rebuilt, 3u);
+    EXPECT_FALSE(leaf.IsWorldDirty());
+    EXPECT_EQ(leaf.GetWorldPosition(), glm::vec3(3.0f, 0.0f, 0.0f));
+
+    // Nothing moved: nothing rebuilt
+    hierarchy.Update();
+    EXPECT_EQ(hierarchy.GetStats().rebuilt, 0u);
+
+    middle.SetLocalPosition(glm::vec3(2.0f, 0.0f, 0.0f));
+    hierarchy.Update();
+    EXPECT_EQ(hierarchy.GetStats().rebuilt, 2u);
+    EXPECT_EQ(leaf.GetWorldPosition(), glm::vec3(4.0f, 0.0f, 0.0f));
+
+    hierarchy.Unregister(&middle);
+    hierarchy.Update();
+    EXPECT_EQ(hierarchy.GetStats().transforms, 2u);
+}
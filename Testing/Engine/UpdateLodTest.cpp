@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "GameObjectManagerFixture.hpp"
+#include <Engine/Jobs/JobSystem.hpp>
+#include <OPENGL/glm/gtc/matrix_transform.hpp>
+#include <memory>
+#include <vector>
+
+namespace {
+    struct Clock : Component {
+        static UpdateAccess GetUpdateAccess() { return UpdateAccess(); }
+        void Update(double deltaTime) override {
+            updates++;
+            time += deltaTime;
+        }
+        int updates = 0;
+        double time = 0.0;
+    };
+
+    class UpdateLodTest : public GameObjectManagerFixture {
+    protected:
+        std::vector<std::unique_ptr<GameObject>> objects;
+
+        void SetUp() override {
+            GameObjectManagerFixture::SetUp();
+            manager->SetParallelUpdate(false);
+
+            UpdateLodSettings settings;
+            settings.enabled = true;
+            settings.fullRateDistance = 25.0f;
+            settings.maxInterval = 8;
+            settings.hiddenInterval = 8;
+            settings.rebucketFrames = 1;
+            manager->SetUpdateLod(settings);
+
+            // At the origin, looking down -z
+            const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+            const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 1000.0f);
+            manager->SetUpdateViewer(glm::vec3(0.0f), projection * view);
+        }
+
+        Clock* Spawn(const glm::vec3& position) {
+            objects.push_back(std::make_unique<GameObject>());
+            objects.back()->GetTransform().SetLocalPosition(position);
+            return objects.back()->AddComponent<Clock>();
+        }
+
+        void RunFrames(int frames) {
+            for (int i = 0; i < frames; i++) {
+                manager->UpdateTransforms();
+                manager->UpdateAll(0.01);
+            }
+        }
+    };
+}
+
+TEST_F(UpdateLodTest, FarObjectsUpdateLessOftenWithTheAccumulatedTime) {
+    Clock* near = Spawn(glm::vec3(0.0f, 0.0f, -10.0f));
+    Clock* far = Spawn(glm::vec3(0.0f, 0.0f, -100.0f));   // 4x the full rate distance: every 4th frame
+    RunFrames(16);
+
+    EXPECT_EQ(near->updates, 16);
+    EXPECT_NEAR(near->time, 0.16, 1e-9);
+
+    // Frames 0, 4, 8, 12: the later ones carry the three skipped frames before them
+    EXPECT_EQ(far->updates, 4);
+    EXPECT_NEAR(far->time, 0.13, 1e-9);
+    EXPECT_EQ(manager->GetUpdateLodStats().buckets[2], 1u);
+}
+
+TEST_F(UpdateLodTest, HiddenObjectsAreThrottledUnlessImportant) {
+    Clock* behind = Spawn(glm::vec3(0.0f, 0.0f, 10.0f));
+    Clock* important = Spawn(glm::vec3(0.0f, 0.0f, 10.0f));
+    important->GetOwner()->SetUpdateImportance(GameObject::kAlwaysUpdate);
+    Clock* doubled = Spawn(glm::vec3(0.0f, 0.0f, -40.0f));   // within 2x25 once its importance doubles it
+    doubled->GetOwner()->SetUpdateImportance(2.0f);
+    RunFrames(16);
+
+    EXPECT_EQ(behind->updates, 2);
+    EXPECT_EQ(important->updates, 16);
+    EXPECT_EQ(doubled->updates, 16);
+    EXPECT_EQ(manager->GetUpdateLodStats().hidden, 1u);
+}
+
+TEST_F(UpdateLodTest, SpreadsABucketEvenlyOverTheFrames) {
+    std::shared_ptr<JobSystem> jobs = ServiceLocator::Get().Create<JobSystem>(2u);
+    manager->SetParallelUpdate(true);
+
+    std::vector<Clock*> clocks;
+    for (int i = 0; i < 256; i++) clocks.push_back(Spawn(glm::vec3(float(i % 16), 0.0f, -90.0f)));
+
+    for (int frame = 0; frame < 8; frame++) {
+        RunFrames(1);
+        EXPECT_EQ(manager->GetUpdateLodStats().updated, 64u);
+        EXPECT_EQ(manager->GetUpdateLodStats().skipped, 192u);
+    }
+    EXPECT_EQ(manager->GetUpdateLodStats().busiestFrame, 64u);
+    EXPECT_EQ(manager->GetUpdateLodStats().quietestFrame, 64u);
+    for (Clock* clock : clocks) {
+        EXPECT_EQ(clock->updates, 2);
+    }
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <Engine/GameObject.hpp>
+#include <Engine/Jobs/JobSystem.hpp>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace {
+    struct Counter : Component {
+        uint64_t value = 1;
+        static UpdateAccess GetUpdateAccess() { return UpdateAccess(); }
+    };
+
+    // Don't commute: the result depends on the order they ran in
+    struct Doubler : Component {
+        static UpdateAccess GetUpdateAccess() { return UpdateAccess().Writes<Counter>(); }
+        void Update(double) override { owner->GetComponent<Counter>()->value = owner->GetComponent<Counter>()->value * 2 + 1; }
+    };
+    struct Tripler : Component {
+        static UpdateAccess GetUpdateAccess() { return UpdateAccess().Writes<Counter>(); }
+        void Update(double) override { owner->GetComponent<Counter>()->value *= 3; }
+    };
+
+    // Conflicts with nobody above
+    struct Mover : Component {
+        static UpdateAccess GetUpdateAccess() { return UpdateAccess().Writes<Transform>(); }
+        void Update(double deltaTime) override {
+            Transform& transform = owner->GetTransform();
+            transform.SetLocalPosition(transform.GetLocalPosition() + glm::vec3(float(deltaTime), 0.0f, 0.0f));
+        }
+    };
+
+    // Both rebuild the transform cache the Mover before them dirtied; tick records when they ran
+    std::atomic<uint64_t> readTick{ 0 };
+    struct PositionReader : Component {
+        float seen = 0.0f;
+        uint64_t tick = 0;
+        static UpdateAccess GetUpdateAccess() { return UpdateAccess().Reads<Transform>(); }
+        void Update(double) override {
+            seen = owner->GetTransform().GetWorldPosition().x;
+            tick = readTick.fetch_add(1);
+        }
+    };
+    struct NormalReader : Component {
+        float seen = 0.0f;
+        uint64_t tick = 0;
+        static UpdateAccess GetUpdateAccess() { return UpdateAccess().Reads<Transform>(); }
+        void Update(double) override {
+            owner->GetTransform().GetNormalMatrix();
+            seen = owner->GetTransform().GetWorldPosition().x;
+            tick = readTick.fetch_add(1);
+        }
+    };
+
+    // Undeclared: reads every object, so it must see exactly the serial state
+    struct Auditor : Component {
+        const std::vector<std::unique_ptr<GameObject>>* world = nullptr;
+        std::vector<uint64_t> seen;
+        void Update(double) override {
+            uint64_t sum = 0;
+            for (const auto& object : *world) {
+                if (Counter* counter = object->GetComponent<Counter>()) sum += counter->value;
+            }
+            seen.push_back(sum);
+        }
+    };
+
+    struct World {
+        std::vector<std::unique_ptr<GameObject>> objects;
+        Auditor* auditor = nullptr;
+    };
+
+    // 300 objects; every 100th one is an auditor that ends a parallel run.
+    // reverseEvery > 0: every reverseEvery-th object has Tripler before Doubler
+    World BuildWorld(size_t reverseEvery) {
+        World world;
+        for (size_t i = 0; i < 300; i++) {
+            auto object = std::make_unique<GameObject>();
+            if (i % 100 == 99) {
+                world.auditor = object->AddComponent<Auditor>();
+                world.auditor->world = &world.objects;
+            } else {
+                object->AddComponent<Counter>()->value = i;
+                if (reverseEvery && i % reverseEvery == 0) {
+                    object->AddComponent<Tripler>();
+                    object->AddComponent<Doubler>();
+                } else {
+                    object->AddComponent<Doubler>();
+                    object->AddComponent<Tripler>();
+                }
+                object->AddComponent<Mover>();
+            }
+            world.objects.push_back(std::move(object));
+        }
+        return world;
+    }
+
+    std::vector<uint64_t> Values(const World& world) {
+        std::vector<uint64_t> values;
+        for (const auto& object : world.objects) {
+            if (Counter* counter = object->GetComponent<Counter>()) values.push_back(counter->value);
+        }
+        return values;
+    }
+
+    class UpdateSchedulerTest : public ::testing::Test {
+    protected:
+        std::shared_ptr<JobSystem> jobs;
+        std::shared_ptr<GameObjectManager> manager;
+        void SetUp() override {
+            jobs = ServiceLocator::Get().Create<JobSystem>(3u);
+            manager = ServiceLocator::Get().Create<GameObjectManager>();
+            manager->SetParallelUpdate(true);
+        }
+
+        // Values after three frames, plus what the auditor saw
+        std::pair<std::vector<uint64_t>, std::vector<uint64_t>> Simulate(size_t reverseEvery, bool parallel) {
+            manager->SetParallelUpdate(parallel);
+            World world = BuildWorld(reverseEvery);
+            for (int frame = 0; frame < 3; frame++) manager->UpdateAll(0.5);
+            return { Values(world), world.auditor->seen };
+        }
+    };
+}
+
+TEST_F(UpdateSchedulerTest, MatchesTheSerialLoop) {
+    const auto serial = Simulate(0, false);
+    const auto parallel = Simulate(0, true);
+    EXPECT_EQ(parallel.first, serial.first);
+    EXPECT_EQ(parallel.second, serial.second);
+
+    // Auditors ran in place, everything else as systems
+    const UpdateScheduler::Stats& stats = manager->GetUpdateStats();
+    EXPECT_EQ(stats.serialObjects, 3u);
+    EXPECT_EQ(stats.parallelObjects, 297u);
+    EXPECT_EQ(stats.objectOrderRuns, 0u);
+    ASSERT_EQ(stats.systems.size(), 3u);   // Doubler, Tripler, Mover (Counter has no Update)
+    for (const UpdateScheduler::SystemTiming& system : stats.systems) {
+        EXPECT_EQ(system.instances, 297u);
+    }
+    EXPECT_GT(stats.parallelism, 0.0);
+}
+
+TEST_F(UpdateSchedulerTest, ObjectsOrderingSystemsDifferentlyStillMatch) {
+    const auto serial = Simulate(7, false);
+    const auto parallel = Simulate(7, true);
+    EXPECT_EQ(parallel.first, serial.first);
+    EXPECT_EQ(parallel.second, serial.second);
+    EXPECT_EQ(manager->GetUpdateStats().objectOrderRuns, manager->GetUpdateStats().runs);
+}
+
+TEST_F(UpdateSchedulerTest, HierarchyKeepsTransformWritersSerial) {
+    GameObject parent;
+    GameObject child;
+    child.GetTransform().SetParent(&parent.GetTransform());
+    parent.AddComponent<Mover>();
+    child.AddComponent<Mover>();
+
+    std::vector<std::unique_ptr<GameObject>> crowd;
+    for (int i = 0; i < 100; i++) {
+        crowd.push_back(std::make_unique<GameObject>());
+        crowd.back()->AddComponent<Mover>();
+    }
+    manager->UpdateAll(1.0);
+
+    EXPECT_EQ(manager->GetUpdateStats().serialObjects, 2u);
+    EXPECT_EQ(manager->GetUpdateStats().parallelObjects, 100u);
+    EXPECT_FLOAT_EQ(child.GetTransform().GetWorldPosition().x, 2.0f);
+    EXPECT_FLOAT_EQ(crowd.back()->GetTransform().GetWorldPosition().x, 1.0f);
+}
+
+TEST_F(UpdateSchedulerTest, TransformReadersAfterAWriterRunOneAfterAnother) {
+    std::vector<std::unique_ptr<GameObject>> crowd;
+    for (int i = 0; i < 100; i++) {
+        crowd.push_back(std::make_unique<GameObject>());
+        crowd.back()->GetTransform().SetLocalPosition(glm::vec3(float(i), 0.0f, 0.0f));   // dirty before the pass
+        crowd.back()->AddComponent<Mover>();
+        crowd.back()->AddComponent<PositionReader>();
+        crowd.back()->AddComponent<NormalReader>();
+    }
+    manager->UpdateAll(1.0);
+
+    const UpdateScheduler::Stats& stats = manager->GetUpdateStats();
+    EXPECT_EQ(stats.parallelObjects, 100u);
+    EXPECT_EQ(stats.objectOrderRuns, 0u);
+    uint64_t lastPosition = 0;
+    uint64_t firstNormal = ~uint64_t(0);
+    for (size_t i = 0; i < crowd.size(); i++) {
+        EXPECT_FLOAT_EQ(crowd[i]->GetComponent<PositionReader>()->seen, float(i) + 1.0f);
+        EXPECT_FLOAT_EQ(crowd[i]->GetComponent<NormalReader>()->seen, float(i) + 1.0f);
+        lastPosition = std::max(lastPosition, crowd[i]->GetComponent<PositionReader>()->tick);
+        firstNormal = std::min(firstNormal, crowd[i]->GetComponent<NormalReader>()->tick);
+    }
+    // Writer, then one reader system, then the other: never the two readers at once
+    EXPECT_LT(lastPosition, firstNormal);
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <Engine/Mesh/VertexWelder.hpp>
+
+namespace {
+    // Appends one packed vertex (3 pos + 3 normal + 2 uv)
+    void PushVertex(std::vector<float>& v, float x, float y, float z, float u = 0.0f, float w = 0.0f) {
+        v.insert(v.end(), { x, y, z, 0.0f, 1.0f, 0.0f, u, w });
+    }
+}
+
+// A quad exported as two separate triangles (6 vertices) welds down to 4
+TEST(VertexWelder, WeldsExactDuplicates) {
+    std::vector<float> vertices;
+    PushVertex(vertices, 0, 0, 0); PushVertex(vertices, 1, 0, 0); PushVertex(vertices, 1, 1, 0);
+    PushVertex(vertices, 0, 0, 0); PushVertex(vertices, 1, 1, 0); PushVertex(vertices, 0, 1, 0);
+    std::vector<unsigned int> indices = { 0, 1, 2, 3, 4, 5 };
+
+    WeldStats stats = WeldVertices(vertices, kWeldBaseFloats, indices);
+
+    EXPECT_EQ(stats.verticesBefore, 6u);
+    EXPECT_EQ(stats.verticesAfter, 4u);
+    EXPECT_EQ(vertices.size(), 4u * kWeldBaseFloats);
+    EXPECT_EQ(indices, (std::vector<unsigned int>{ 0, 1, 2, 0, 2, 3 }));
+}
+
+TEST(VertexWelder, RespectsEpsilon) {
+    std::vector<float> vertices;
+    PushVertex(vertices, 0.0f, 0.0f, 0.0f);
+    PushVertex(vertices, 0.000001f, 0.0f, 0.0f); // within default position epsilon
+    PushVertex(vertices, 0.1f, 0.0f, 0.0f);      // clearly different
+    std::vector<unsigned int> indices = { 0, 1, 2 };
+
+    WeldStats stats = WeldVertices(vertices, kWeldBaseFloats, indices);
+    EXPECT_EQ(stats.verticesAfter, 2u);
+    EXPECT_EQ(indices[0], indices[1]);
+    EXPECT_NE(indices[0], indices[2]);
+}
+
+// Same position but different UVs (a texture seam) must stay split
+TEST(VertexWelder, KeepsUVSeams) {
+    std::vector<float> vertices;
+    PushVertex(vertices, 0, 0, 0, 0.0f, 0.0f);
+    PushVertex(vertices, 0, 0, 0, 1.0f, 0.0f);
+    std::vector<unsigned int> indices = { 0, 1 };
+
+    WeldSettings settings;
+    settings.uvEpsilon = 0.01f;
+    WeldStats stats = WeldVertices(vertices, kWeldBaseFloats, indices, settings);
+
+    EXPECT_EQ(stats.verticesAfter, 2u);
+    EXPECT_FLOAT_EQ(stats.ReductionPercent(), 0.0f);
+}
+
+// Far from the origin a 1e-5 grid has more cells than an int32 holds; distinct vertices there
+// must not collapse onto one key
+TEST(VertexWelder, KeepsDistantVerticesApart) {
+    std::vector<float> vertices;
+    PushVertex(vertices, 30000.0f, 0.0f, 0.0f);
+    PushVertex(vertices, 30000.5f, 0.0f, 0.0f);
+    PushVertex(vertices, -50000.0f, 0.0f, 0.0f);
+    PushVertex(vertices, 30000.0f, 0.0f, 0.0f);   // duplicate of the first
+    PushVertex(vertices, 1e30f, 0.0f, 0.0f);      // past any grid: compared bit-exactly
+    PushVertex(vertices, 2e30f, 0.0f, 0.0f);
+    PushVertex(vertices, 1e30f, 0.0f, 0.0f);
+    std::vector<unsigned int> indices = { 0, 1, 2, 3, 4, 5, 6 };
+
+    WeldStats stats = WeldVertices(vertices, kWeldBaseFloats, indices);
+
+    EXPECT_EQ(stats.verticesAfter, 5u);
+    EXPECT_EQ(indices, (std::vector<unsigned int>{ 0, 1, 2, 0, 3, 4, 3 }));
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <Texture/BlockCompression.hpp>
+#include <Texture/Ktx2.hpp>
+#include <Engine/Utils/MappedFile.hpp>
+#include <filesystem>
+#include <cmath>
+#include <cstring>
+
+namespace {
+    // PSNR over the channels a format actually stores
+    double Psnr(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int channels) {
+        double mse = 0.0;
+        size_t count = 0;
+        for (size_t i = 0; i < a.size(); i += 4) {
+            for (int c = 0; c < channels; c++, count++) {
+                const double d = double(a[i + c]) - double(b[i + c]);
+                mse += d * d;
+            }
+        }
+        mse /= double(count);
+        return mse == 0.0 ? 99.0 : 10.0 * std::log10(255.0 * 255.0 / mse);
+    }
+
+    std::vector<uint8_t> Gradient(int width, int height) {
+        std::vector<uint8_t> rgba(size_t(width) * height * 4);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                uint8_t* p = &rgba[(size_t(y) * width + x) * 4];
+                p[0] = uint8_t(x * 255 / (width - 1));
+                p[1] = uint8_t(y * 255 / (height - 1));
+                p[2] = uint8_t((x + y) * 255 / (width + height - 2));
+                p[3] = uint8_t(255 - x * 255 / (width - 1));
+            }
+        }
+        return rgba;
+    }
+}
+
+TEST(BlockCompression, SizesMatchBitsPerPixel) {
+    EXPECT_EQ(CompressedSize(BlockFormat::BC1, 64, 64), 64u * 64u / 2u);
+    EXPECT_EQ(CompressedSize(BlockFormat::BC7, 64, 64), 64u * 64u);
+    EXPECT_EQ(CompressedSize(BlockFormat::BC4, 5, 5), 4u * 8u); // partial blocks round up
+}
+
+TEST(BlockCompression, SolidBlockRoundTrips) {
+    uint8_t block[64], decoded[64], encoded[16];
+    for (int i = 0; i < 16; i++) {
+        block[i * 4 + 0] = 200; block[i * 4 + 1] = 100; block[i * 4 + 2] = 50; block[i * 4 + 3] = 128;
+    }
+
+    EncodeBlock(BlockFormat::BC4, block, encoded);
+    DecodeBlock(BlockFormat::BC4, encoded, decoded);
+    EXPECT_EQ(decoded[0], 200);
+
+    EncodeBlock(BlockFormat::BC7, block, encoded);
+    DecodeBlock(BlockFormat::BC7, encoded, decoded);
+    for (int c = 0; c < 4; c++) EXPECT_NEAR(decoded[c], block[c], 1);
+}
+
+TEST(BlockCompression, GradientQuality) {
+    const int size = 32;
+    // Two-axis gradient: one endpoint line per block can't represent it exactly, so this is a floor, not a target
+    std::vector<uint8_t> source = Gradient(size, size);
+
+    struct Case { BlockFormat format; int channels; double minPsnr; };
+    for (const Case& test : { Case{ BlockFormat::BC1, 3, 30.0 }, Case{ BlockFormat::BC3, 4, 30.0 },
+                              Case{ BlockFormat::BC4, 1, 40.0 }, Case{ BlockFormat::BC5, 2, 40.0 },
+                              Case{ BlockFormat::BC7, 4, 32.0 } }) {
+        std::vector<uint8_t> blocks = CompressSurface(test.format, source.data(), size, size);
+        ASSERT_EQ(blocks.size(), CompressedSize(test.format, size, size));
+        std::vector<uint8_t> decoded = DecompressSurface(test.format, blocks.data(), size, size);
+        EXPECT_GT(Psnr(source, decoded, test.channels), test.minPsnr) << BlockFormatName(test.format);
+    }
+}
+
+TEST(BlockCompression, VkFormatRoundTrip) {
+    BlockFormat format;
+    bool srgb;
+    ASSERT_TRUE(BlockFormatFromVk(VkFormatFor(BlockFormat::BC7, true), format, srgb));
+    EXPECT_EQ(format, BlockFormat::BC7);
+    EXPECT_TRUE(srgb);
+}
+
+TEST(BlockCompression, Ktx2RoundTrip) {
+    std::vector<std::vector<uint8_t>> levels;
+    for (int size = 16; size >= 1; size /= 2) {
+        std::vector<uint8_t> source = Gradient(std::max(size, 2), std::max(size, 2));
+        levels.push_back(CompressSurface(BlockFormat::BC1, source.data(), size, size));
+    }
+
+    const std::string path = (std::filesystem::temp_directory_path() / "block_compression_test.ktx2").string();
+    ASSERT_TRUE(WriteKtx2(path, VkFormatFor(BlockFormat::BC1, false), 16, 16, levels));
+
+    {
+        MappedFile file;
+        ASSERT_TRUE(file.Open(path));
+        Ktx2Texture ktx;
+        ASSERT_TRUE(ParseKtx2(file.Data(), file.Size(), ktx));
+        EXPECT_EQ(ktx.width, 16);
+        ASSERT_EQ(ktx.levels.size(), levels.size());
+        for (size_t i = 0; i < levels.size(); i++) {
+            EXPECT_EQ(ktx.levels[i].width, 16 >> i);
+            ASSERT_EQ(ktx.levels[i].size, levels[i].size());
+            EXPECT_EQ(0, std::memcmp(ktx.levels[i].data, levels[i].data(), levels[i].size()));
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(ktx.levels[i].data) % 16, 0u);
+        }
+
+        // Truncated files are rejected instead of reading past the end
+        EXPECT_FALSE(ParseKtx2(file.Data(), file.Size() - 1, ktx));
+
+        // So are more levels than a 16x16 chain has (levelCount is at byte 40)
+        std::vector<uint8_t> bytes(file.Data(), file.Data() + file.Size());
+        for (uint32_t levelCount : { 6u, 40u }) {
+            std::memcpy(&bytes[40], &levelCount, sizeof(levelCount));
+            EXPECT_FALSE(ParseKtx2(bytes.data(), bytes.size(), ktx)) << levelCount;
+        }
+    }
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <Texture/MipGenerator.hpp>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+    Image MakeImage(int width, int height, int channels, unsigned char (*texel)(int x, int y, int c)) {
+        Image image;
+        image.width = width;
+        image.height = height;
+        image.channels = channels;
+        image.pixels.resize(static_cast<size_t>(width) * height * channels);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                for (int c = 0; c < channels; c++) {
+                    image.pixels[(static_cast<size_t>(y) * width + x) * channels + c] = texel(x, y, c);
+                }
+            }
+        }
+        return image;
+    }
+
+    float Coverage(const Image& image, float cutoff) {
+        size_t passing = 0;
+        for (size_t i = 3; i < image.pixels.size(); i += 4) {
+            if (image.pixels[i] / 255.0f >= cutoff) passing++;
+        }
+        return static_cast<float>(passing) / (image.pixels.size() / 4);
+    }
+}
+
+TEST(MipGenerator, ChainGoesDownToOneTexel) {
+    Image image = MakeImage(37, 10, 3, [](int x, int y, int c) { return static_cast<unsigned char>(x * 7 + y * 3 + c); });
+    std::vector<Image> mips = GenerateMipChain(image);
+
+    // 37x10 -> 18x5 -> 9x2 -> 4x1 -> 2x1 -> 1x1
+    ASSERT_EQ(mips.size(), 5u);
+    EXPECT_EQ(mips[0].width, 18);
+    EXPECT_EQ(mips[0].height, 5);
+    EXPECT_EQ(mips.back().width, 1);
+    EXPECT_EQ(mips.back().height, 1);
+    EXPECT_EQ(mips.back().channels, 3);
+}
+
+TEST(MipGenerator, ConstantImageStaysConstant) {
+    for (MipFilter filter : { MipFilter::Box, MipFilter::Kaiser, MipFilter::Lanczos }) {
+        MipSettings settings;
+        settings.filter = filter;
+        Image image = MakeImage(16, 16, 4, [](int, int, int c) { return static_cast<unsigned char>(40 + c * 50); });
+        for (const Image& mip : GenerateMipChain(image, settings)) {
+            for (size_t i = 0; i < mip.pixels.size(); i++) {
+                ASSERT_NEAR(mip.pixels[i], image.pixels[i % 4], 1);
+            }
+        }
+    }
+}
+
+TEST(MipGenerator, FiltersInLinearLight) {
+    // Black/white checker: the linear light average is 50% intensity, which is ~188 in sRGB, not 128
+    Image image = MakeImage(2, 2, 3, [](int x, int y, int) { return static_cast<unsigned char>(((x + y) & 1) * 255); });
+
+    MipSettings settings;
+    settings.filter = MipFilter::Box;
+    EXPECT_NEAR(GenerateMipChain(image, settings)[0].pixels[0], 188, 1);
+
+    settings.srgb = false;
+    EXPECT_NEAR(GenerateMipChain(image, settings)[0].pixels[0], 128, 1);
+}
+
+TEST(MipGenerator, SimdMatchesScalar) {
+    Image image = MakeImage(64, 48, 4, [](int x, int y, int c) {
+        return static_cast<unsigned char>((x * 31 + y * 17 + c * 59 + (x * y) % 13) & 0xFF);
+    });
+
+    MipSettings simd, scalar;
+    scalar.useSimd = false;
+    std::vector<Image> a = GenerateMipChain(image, simd);
+    std::vector<Image> b = GenerateMipChain(image, scalar);
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t level = 0; level < a.size(); level++) {
+        for (size_t i = 0; i < a[level].pixels.size(); i++) {
+            ASSERT_LE(std::abs(a[level].pixels[i] - b[level].pixels[i]), 1) << "level " << level;
+        }
+    }
+}
+
+TEST(MipGenerator, PreservesAlphaCoverage) {
+    // Noisy alpha (think leaves): filtering pulls every texel towards the mean, below the cutoff
+    Image image = MakeImage(64, 64, 4, [](int x, int y, int c) {
+        const unsigned int h = static_cast<unsigned int>(x * 73856093 ^ y * 19349663) * 2654435761u;
+        return static_cast<unsigned char>(c < 3 ? 128 : (h >> 24));
+    });
+    const float cutoff = 0.7f;
+    const float baseCoverage = Coverage(image, cutoff);
+
+    MipSettings plain;
+    EXPECT_LT(Coverage(GenerateMipChain(image, plain)[2], cutoff), baseCoverage * 0.5f);
+
+    MipSettings preserved;
+    preserved.alphaCoverageCutoff = cutoff;
+    std::vector<Image> mips = GenerateMipChain(image, preserved);
+    for (size_t level = 0; level + 2 < mips.size(); level++) {
+        EXPECT_NEAR(Coverage(mips[level], cutoff), baseCoverage, 0.1f) << "level " << level;
+    }
+}
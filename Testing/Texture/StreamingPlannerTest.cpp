@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <Texture/StreamingPlanner.hpp>
+
+namespace {
+    // 5 levels: 256, 64, 16, 4, 1 bytes; tail = last two levels
+    StreamingEntry MakeEntry(int residentTop, int wantedTop, uint64_t lastRequestFrame) {
+        StreamingEntry entry;
+        entry.levelBytes = { 256, 64, 16, 4, 1 };
+        entry.residentTop = residentTop;
+        entry.wantedTop = wantedTop;
+        entry.tailLevel = 3;
+        entry.lastRequestFrame = lastRequestFrame;
+        return entry;
+    }
+}
+
+TEST(StreamingPlanner, LoadsWantedLevelsWithinBudget) {
+    std::vector<StreamingEntry> entries = { MakeEntry(3, 0, 10) };
+    StreamingPlan plan = PlanResidency(entries, 1024, 1024);
+
+    EXPECT_EQ(plan.targetTop[0], 0);
+    EXPECT_EQ(plan.uploadBytes, 256u + 64u + 16u);
+    EXPECT_EQ(plan.residentBytes, ResidentBytes(entries[0], 0));
+    EXPECT_EQ(plan.starved, 0u);
+}
+
+TEST(StreamingPlanner, UploadBudgetSpreadsLoadsOverFrames) {
+    std::vector<StreamingEntry> entries = { MakeEntry(3, 0, 10) };
+    StreamingPlan plan = PlanResidency(entries, 1024, 80);
+
+    // 16 + 64 fit, 256 waits for the next frame
+    EXPECT_EQ(plan.targetTop[0], 1);
+    EXPECT_EQ(plan.starved, 1u);
+}
+
+TEST(StreamingPlanner, EvictsUnwantedLevelsBeforeWantedOnes) {
+    // 0: old and no longer wanted at full res, 1: wanted but requested earlier, 2: just requested
+    std::vector<StreamingEntry> entries = { MakeEntry(0, 3, 1), MakeEntry(1, 1, 5), MakeEntry(3, 1, 10) };
+    const size_t budget = ResidentBytes(entries[0], 0) + ResidentBytes(entries[1], 1) + 5;
+    StreamingPlan plan = PlanResidency(entries, budget, 1024);
+
+    EXPECT_EQ(plan.targetTop[2], 1);
+    EXPECT_GT(plan.targetTop[0], 0);  // paid for the load
+    EXPECT_EQ(plan.targetTop[1], 1);  // untouched, unwanted levels were enough
+    EXPECT_LE(plan.residentBytes, budget);
+}
+
+TEST(StreamingPlanner, NewerRequestsWinOverOlderWantedLevels) {
+    std::vector<StreamingEntry> entries = { MakeEntry(1, 1, 1), MakeEntry(3, 1, 10) };
+    const size_t budget = ResidentBytes(entries[0], 1) + 5;
+    StreamingPlan plan = PlanResidency(entries, budget, 1024);
+
+    EXPECT_EQ(plan.targetTop[1], 1);
+    EXPECT_EQ(plan.targetTop[0], 3);
+    EXPECT_EQ(plan.starved, 1u);
+    EXPECT_EQ(plan.evictedBytes, 64u + 16u);
+}
+
+TEST(StreamingPlanner, TailLevelsAreNeverEvicted) {
+    std::vector<StreamingEntry> entries = { MakeEntry(0, 0, 1), MakeEntry(3, 3, 1) };
+    StreamingPlan plan = PlanResidency(entries, 0, 1024);
+
+    EXPECT_EQ(plan.targetTop[0], 3);
+    EXPECT_EQ(plan.targetTop[1], 3);
+    EXPECT_EQ(plan.residentBytes, 2u * (4u + 1u));
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <Texture/TextureAtlas.hpp>
+#include <Texture/MipGenerator.hpp>
+#include <algorithm>
+
+namespace {
+    Image SolidImage(int width, int height, unsigned char value) {
+        Image image;
+        image.width = width;
+        image.height = height;
+        image.channels = 4;
+        image.pixels.assign(static_cast<size_t>(width) * height * 4, value);
+        return image;
+    }
+
+    struct Rect {
+        int x0, y0, x1, y1;
+    };
+
+    // Entry plus its gutter, the region nothing else may touch
+    Rect CellOf(const AtlasEntry& entry, int gutter) {
+        return { entry.x - gutter, entry.y - gutter, entry.x + entry.width + gutter, entry.y + entry.height + gutter };
+    }
+}
+
+TEST(TextureAtlas, CellsDontOverlapAndStayOnTheGrid) {
+    std::vector<glm::ivec2> sizes;
+    for (int i = 0; i < 40; i++) {
+        sizes.push_back({ 16 + (i * 37) % 200, 8 + (i * 53) % 150 });
+    }
+    AtlasSettings settings;
+    settings.pageSize = 512;
+    settings.gutter = 8;
+    const AtlasLayout layout = PackAtlas(sizes, settings);
+
+    ASSERT_GT(layout.pageCount, 1);
+    for (size_t i = 0; i < sizes.size(); i++) {
+        const AtlasEntry& a = layout.entries[i];
+        ASSERT_GE(a.page, 0);
+        EXPECT_EQ(a.width, sizes[i].x);
+        EXPECT_EQ((a.x - 8) % 8, 0);
+        EXPECT_EQ((a.y - 8) % 8, 0);
+
+        const Rect ra = CellOf(a, 8);
+        EXPECT_GE(ra.x0, 0);
+        EXPECT_GE(ra.y0, 0);
+        EXPECT_LE(ra.x1, layout.pageWidth);
+        EXPECT_LE(ra.y1, layout.pageHeight);
+        for (size_t j = i + 1; j < sizes.size(); j++) {
+            const AtlasEntry& b = layout.entries[j];
+            if (a.page != b.page) continue;
+            const Rect rb = CellOf(b, 8);
+            const bool apart = ra.x1 <= rb.x0 || rb.x1 <= ra.x0 || ra.y1 <= rb.y0 || rb.y1 <= ra.y0;
+            EXPECT_TRUE(apart) << i << " overlaps " << j;
+        }
+    }
+    EXPECT_GT(layout.occupancy, 0.35f); // gutters + the last, partly filled page
+}
+
+TEST(TextureAtlas, SinglePageShrinksToFit) {
+    AtlasSettings settings;
+    settings.gutter = 4;
+    const AtlasLayout layout = PackAtlas({ { 100, 50 }, { 60, 60 } }, settings);
+
+    EXPECT_EQ(layout.pageCount, 1);
+    EXPECT_EQ(layout.pageWidth, 256);   // both cells on one shelf: 68 + 108
+    EXPECT_EQ(layout.pageHeight, 128);  // the shelf is 68 high
+    EXPECT_EQ(layout.levelCount, 3);    // levels 0..log2(4)
+}
+
+TEST(TextureAtlas, RejectsImagesBiggerThanAPage) {
+    AtlasSettings settings;
+    settings.pageSize = 256;
+    const AtlasLayout layout = PackAtlas({ { 256, 16 }, { 32, 32 }, { 0, 8 } }, settings);
+
+    EXPECT_EQ(layout.entries[0].page, -1); // no room for the gutter
+    EXPECT_EQ(layout.entries[1].page, 0);
+    EXPECT_EQ(layout.entries[2].page, -1);
+}
+
+TEST(TextureAtlas, UvTransformMapsUnitSquareOntoTheImage) {
+    const AtlasLayout layout = PackAtlas({ { 64, 32 }, { 32, 32 } });
+    for (const AtlasEntry& entry : layout.entries) {
+        const glm::vec2 lo = glm::vec2(0.0f) * glm::vec2(entry.uvTransform) + glm::vec2(entry.uvTransform.z, entry.uvTransform.w);
+        const glm::vec2 hi = glm::vec2(1.0f) * glm::vec2(entry.uvTransform) + glm::vec2(entry.uvTransform.z, entry.uvTransform.w);
+        EXPECT_FLOAT_EQ(lo.x * layout.pageWidth, static_cast<float>(entry.x));
+        EXPECT_FLOAT_EQ(lo.y * layout.pageHeight, static_cast<float>(entry.y));
+        EXPECT_FLOAT_EQ(hi.x * layout.pageWidth, static_cast<float>(entry.x + entry.width));
+        EXPECT_FLOAT_EQ(hi.y * layout.pageHeight, static_cast<float>(entry.y + entry.height));
+    }
+}
+
+TEST(TextureAtlas, GuttersKeepNeighboursApartAtEveryLevel) {
+    // Two solid images side by side: every safe level must only hold their own colors
+    const Image red = SolidImage(40, 24, 200);
+    const Image blue = SolidImage(24, 24, 50);
+    const std::vector<Image> redMips = GenerateMipChain(red);
+
+    AtlasSettings settings;
+    settings.gutter = 8;
+    const AtlasLayout layout = PackAtlas({ { 40, 24 }, { 24, 24 } }, settings);
+    ASSERT_EQ(layout.pageCount, 1);
+    ASSERT_EQ(layout.levelCount, 4);
+
+    // blue's mips are generated by ComposeAtlas
+    const auto pages = ComposeAtlas(layout, { { &red, &redMips }, { &blue, nullptr } }, 4);
+    ASSERT_EQ(pages.size(), 1u);
+    ASSERT_EQ(static_cast<int>(pages[0].size()), layout.levelCount);
+
+    const unsigned char colors[2] = { 200, 50 };
+    for (int level = 0; level < layout.levelCount; level++) {
+        const Image& page = pages[0][level];
+        EXPECT_EQ(page.width, layout.pageWidth >> level);
+        for (size_t i = 0; i < 2; i++) {
+            const Rect cell = CellOf(layout.entries[i], 8);
+            for (int y = cell.y0 >> level; y < cell.y1 >> level; y++) {
+                for (int x = cell.x0 >> level; x < cell.x1 >> level; x++) {
+                    const unsigned char value = page.pixels[(static_cast<size_t>(y) * page.width + x) * 4];
+                    ASSERT_EQ(value, colors[i]) << "level " << level << " image " << i << " at " << x << "," << y;
+                }
+            }
+        }
+    }
+}
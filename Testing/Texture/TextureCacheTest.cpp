@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <OPENGL/glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <Texture/TextureCache.hpp>
+#include <Engine/Managers/ServiceLocator.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace {
+    // Uncompressed 24-bit TGA (stb_image reads it), every texel the same color
+    void WriteTga(const std::string& path, int size, unsigned char r, unsigned char g, unsigned char b) {
+        unsigned char header[18] = {};
+        header[2] = 2;
+        header[12] = static_cast<unsigned char>(size & 0xff);
+        header[13] = static_cast<unsigned char>(size >> 8);
+        header[14] = static_cast<unsigned char>(size & 0xff);
+        header[15] = static_cast<unsigned char>(size >> 8);
+        header[16] = 24;
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        for (int i = 0; i < size * size; i++) {
+            const unsigned char bgr[3] = { b, g, r };
+            file.write(reinterpret_cast<const char*>(bgr), sizeof(bgr));
+        }
+    }
+}
+
+// Needs a GL context for the uploads, like the shader tests
+class TextureCacheTest : public ::testing::Test {
+protected:
+    static inline GLFWwindow* window = nullptr;
+
+    static void SetUpTestSuite() {
+        if (!glfwInit()) return;
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        window = glfwCreateWindow(64, 64, "TextureCacheTest", nullptr, nullptr);
+        if (!window) return;
+        glfwMakeContextCurrent(window);
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) window = nullptr;
+    }
+
+    static void TearDownTestSuite() {
+        glfwTerminate();
+    }
+
+    void SetUp() override {
+        if (!window) GTEST_SKIP() << "no OpenGL context";
+        fs::create_directories("temp_textures");
+        WriteTga("temp_textures/a.tga", 16, 200, 100, 50);
+        WriteTga("temp_textures/b.tga", 16, 200, 100, 50);   // same pixels, other file
+        cache = ServiceLocator::Get().Create<TextureCache>();
+    }
+
+    void TearDown() override {
+        cache.reset();
+        fs::remove_all("temp_textures");
+    }
+
+    void WaitForUploads() {
+        for (int i = 0; i < 500 && cache->GetPendingCount() > 0; i++) {
+            cache->ProcessUploads();
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    std::shared_ptr<TextureCache> cache;
+};
+
+TEST_F(TextureCacheTest, SynchronousLoadsShareIdenticalPixels) {
+    TextureHandle a = cache->Load("temp_textures/a.tga");
+    TextureHandle b = cache->Load("temp_textures/b.tga");
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(cache->GetTextureCount(), 1u);
+}
+
+TEST_F(TextureCacheTest, AsyncLoadOfIdenticalPixelsIsReportedAndRedirected) {
+    TextureHandle original = cache->Load("temp_textures/a.tga");
+    TextureHandle async = cache->LoadAsync("temp_textures/b.tga");
+    ASSERT_NE(original, async);
+    WaitForUploads();
+    ASSERT_TRUE(async->IsReady());
+
+    // The handle already given out keeps its copy, and it's reported as such
+    EXPECT_EQ(cache->GetDuplicateBytes(), TextureCache::EstimateResidentBytes(16, 16, 3));
+    EXPECT_EQ(cache->GetResidentBytes(), 2 * TextureCache::EstimateResidentBytes(16, 16, 3));
+
+    // Later loads of that path get the original
+    EXPECT_EQ(cache->Load("temp_textures/b.tga"), original);
+    EXPECT_EQ(cache->LoadAsync("temp_textures/b.tga"), original);
+
+    async.reset();
+    EXPECT_EQ(cache->GetDuplicateBytes(), 0u);
+    EXPECT_EQ(cache->GetTextureCount(), 1u);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <Texture/VirtualTexturing.hpp>
+#include <Texture/VirtualTextureFile.hpp>
+#include <filesystem>
+#include <cstring>
+
+namespace {
+    void PutFeedback(std::vector<uint8_t>& buffer, size_t pixel, TileId tile) {
+        const uint32_t texel = EncodeFeedback(tile);
+        std::memcpy(&buffer[pixel * 4], &texel, 4);
+    }
+
+    TileRequest FindRequest(const std::vector<TileRequest>& requests, TileId tile) {
+        for (const TileRequest& request : requests) {
+            if (request.tile == tile) return request;
+        }
+        return {};
+    }
+}
+
+TEST(VirtualTexturing, ParsesFeedbackIntoUniqueTiles) {
+    // 1024 tiles per side at level 0 so the high coordinate bits get used
+    std::vector<uint8_t> feedback(16 * 4, 0);
+    const TileId far{ 0, 1000, 700 };
+    const TileId coarse{ 3, 5, 6 };
+    for (size_t i = 0; i < 5; i++) PutFeedback(feedback, i, far);
+    for (size_t i = 5; i < 8; i++) PutFeedback(feedback, i, coarse);
+    PutFeedback(feedback, 9, far);                          // repeat after a gap
+    PutFeedback(feedback, 10, TileId{ 12, 0, 0 });          // level out of range
+    PutFeedback(feedback, 11, TileId{ 2, 300, 0 });         // x out of range at level 2 (256 tiles)
+
+    const std::vector<TileRequest> requests = ParseFeedback(feedback.data(), 16, 1024, 11);
+    ASSERT_EQ(requests.size(), 2u);
+    EXPECT_EQ(FindRequest(requests, far).pixels, 6u);
+    EXPECT_EQ(FindRequest(requests, coarse).pixels, 3u);
+}
+
+TEST(VirtualTexturing, PageTableFallsBackToClosestMappedAncestor) {
+    // 4x4 tiles, levels 4x4 / 2x2 / 1x1, pool rows of 8 pages
+    VirtualPageTable table(4, 3, 8);
+    table.Map(TileId{ 2, 0, 0 }, 0);
+    EXPECT_EQ(table.Resolve(), 2);
+    EXPECT_EQ(table.Resolve(), -1);
+    for (uint32_t texel : table.GetLevel(0)) {
+        EXPECT_EQ(texel, 0u | 0u << 8 | 2u << 16 | 0xFFu << 24);
+    }
+
+    table.Map(TileId{ 1, 1, 0 }, 11); // pool page (3, 1)
+    EXPECT_EQ(table.Resolve(), 1);
+    const uint32_t mapped = 3u | 1u << 8 | 1u << 16 | 0xFFu << 24;
+    EXPECT_EQ(table.GetLevel(0)[0 * 4 + 2], mapped);
+    EXPECT_EQ(table.GetLevel(0)[1 * 4 + 3], mapped);
+    EXPECT_EQ(table.GetLevel(0)[0 * 4 + 1] >> 16 & 0xFF, 2u);  // still the root
+
+    table.Unmap(TileId{ 1, 1, 0 });
+    table.Resolve();
+    EXPECT_EQ(table.GetLevel(0)[0 * 4 + 2] >> 16 & 0xFF, 2u);
+}
+
+TEST(VirtualTexturing, TileCacheEvictsLeastRecentlyUsed) {
+    TileCache cache(3);
+    TileId evicted;
+    bool evictedValid;
+
+    const TileId root{ 4, 0, 0 }, a{ 0, 1, 1 }, b{ 0, 2, 2 }, c{ 0, 3, 3 };
+    EXPECT_EQ(cache.Allocate(root, 1, evicted, evictedValid), 0);
+    cache.Pin(root);
+    EXPECT_EQ(cache.Allocate(a, 1, evicted, evictedValid), 1);
+    EXPECT_EQ(cache.Allocate(b, 2, evicted, evictedValid), 2);
+    EXPECT_FALSE(evictedValid);
+
+    // Everything but the pinned root is evictable; a was used last in frame 1
+    cache.Touch(root, 3);
+    EXPECT_EQ(cache.Allocate(c, 3, evicted, evictedValid), 1);
+    ASSERT_TRUE(evictedValid);
+    EXPECT_EQ(evicted, a);
+    EXPECT_FALSE(cache.Contains(a));
+    EXPECT_TRUE(cache.Contains(root));
+
+    // b and c were both used this frame: nothing can go
+    cache.Touch(b, 3);
+    EXPECT_EQ(cache.Allocate(a, 3, evicted, evictedValid), -1);
+    EXPECT_EQ(cache.GetResidentCount(), 3u);
+}
+
+TEST(VirtualTexturing, SchedulerLoadsCoarseTilesFirst) {
+    TileScheduler scheduler(10);
+    scheduler.Submit({ { TileId{ 0, 4, 4 }, 50 } }, 4, 1);
+    scheduler.Submit({ { TileId{ 0, 0, 0 }, 10 } }, 4, 2);
+
+    // Ancestors of both: (1,2,2), (1,0,0), (2,1,1), (2,0,0), root (3,0,0)
+    EXPECT_EQ(scheduler.GetPendingCount(), 7u);
+
+    const TileId root{ 3, 0, 0 };
+    std::vector<TileId> next = scheduler.Next(3, 2, [&](TileId tile) { return tile == root; });
+    ASSERT_EQ(next.size(), 3u);
+    EXPECT_EQ(next[0].level, 2);
+    EXPECT_EQ(next[1].level, 2);
+    EXPECT_EQ(next[2], (TileId{ 1, 2, 2 }));  // requested in frame 1, before (1,0,0)
+
+    // Forgotten once nobody asks for them any more
+    scheduler.Submit({ { TileId{ 0, 0, 0 }, 10 } }, 4, 12);
+    next = scheduler.Next(10, 12, [](TileId) { return false; });
+    EXPECT_EQ(next.size(), 4u);
+    EXPECT_EQ(scheduler.GetPendingCount(), 4u);
+}
+
+TEST(VirtualTexturing, TiledFileRoundTrip) {
+    // 64x64, 16 texel tiles: levels of 4x4, 2x2 and 1x1 tiles
+    Image image;
+    image.width = image.height = 64;
+    image.channels = 3;
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 64; x++) {
+            image.pixels.push_back(static_cast<unsigned char>(x * 4));
+            image.pixels.push_back(static_cast<unsigned char>(y * 4));
+            image.pixels.push_back(7);
+        }
+    }
+
+    const std::string path = (std::filesystem::temp_directory_path() / "virtual_texturing_test.vtex").string();
+    ASSERT_TRUE(WriteVirtualTexture(path, image, 16, 2));
+
+    {
+        VirtualTextureFile file;
+        ASSERT_TRUE(file.Open(path));
+        const VirtualTextureInfo& info = file.GetInfo();
+        EXPECT_EQ(info.levelCount, 3);
+        EXPECT_EQ(info.PaddedTileSize(), 20);
+
+        // Tile (1, 2) of level 0: padded texel (px, py) is image texel (16 - 2 + px, 32 - 2 + py)
+        std::vector<uint8_t> tile;
+        ASSERT_TRUE(file.ReadTile(0, 1, 2, tile));
+        ASSERT_EQ(tile.size(), info.TileBytes());
+        auto at = [&](int px, int py) { return &tile[(static_cast<size_t>(py) * 20 + px) * 4]; };
+        EXPECT_EQ(at(0, 0)[0], (16 - 2) * 4);
+        EXPECT_EQ(at(0, 0)[1], (32 - 2) * 4);
+        EXPECT_EQ(at(19, 5)[0], (16 + 17) * 4);
+        EXPECT_EQ(at(5, 5)[2], 7);
+        EXPECT_EQ(at(5, 5)[3], 255);
+
+        // Edge tile: the border is clamped
+        ASSERT_TRUE(file.ReadTile(0, 0, 0, tile));
+        EXPECT_EQ(at(0, 0)[0], 0);
+        EXPECT_EQ(at(2, 0)[0], 0);
+        EXPECT_EQ(at(3, 0)[0], 4);
+
+        EXPECT_TRUE(file.ReadTile(2, 0, 0, tile));
+        EXPECT_FALSE(file.ReadTile(1, 2, 0, tile));
+        EXPECT_FALSE(file.ReadTile(3, 0, 0, tile));
+    }
+
+    // Not square / not tile * 2^n
+    image.width = 48;
+    EXPECT_FALSE(WriteVirtualTexture(path, image, 16, 2));
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,214 @@
+#include <Texture/BlockCompression.hpp>
+#include <Texture/Image.hpp>
+#include <Texture/Ktx2.hpp>
+#include <Texture/MipGenerator.hpp>
+#include <Texture/VirtualTextureFile.hpp>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Offline texture cooker: image file -> block compressed KTX2 with a full mip chain.
+//
+//   TextureCooker <input> <output.ktx2> [--format bc1|bc3|bc4|bc5|bc7] [--srgb] [--report]
+//                 [--filter box|kaiser|lanczos] [--linear] [--alpha-cutoff <0..1>]
+//   TextureCooker <input> <output.vtex> --virtual <tileSize> [--border <texels>] [mip options]
+//
+// --virtual writes a tiled virtual texture (VirtualTextureFile) instead of a KTX2: RGBA8 tiles
+// with `border` texels of their neighbours (default 4) for every level down to one tile.
+// --linear marks data textures (normal/roughness maps): mips are filtered without gamma.
+// --alpha-cutoff keeps alpha-tested coverage constant across mips.
+// --report encodes the input with every format and prints size, speed and quality,
+// so picking a format per texture is a measured decision.
+
+namespace {
+
+    struct Surface {
+        int width = 0;
+        int height = 0;
+        std::vector<uint8_t> rgba;
+    };
+
+    // Encoders always take RGBA8; missing channels become 0 (color) / 255 (alpha)
+    Surface ToRgba(const Image& image) {
+        Surface surface;
+        surface.width = image.width;
+        surface.height = image.height;
+        surface.rgba.assign(static_cast<size_t>(image.width) * image.height * 4, 0);
+        for (size_t i = 0; i < static_cast<size_t>(image.width) * image.height; i++) {
+            const unsigned char* src = &image.pixels[i * image.channels];
+            uint8_t* dst = &surface.rgba[i * 4];
+            if (image.channels <= 2) {
+                // Grey (+alpha): replicate so BC1/BC7 of a grey map stays grey
+                dst[0] = dst[1] = dst[2] = src[0];
+                dst[3] = image.channels == 2 ? src[1] : 255;
+            } else {
+                std::memcpy(dst, src, 3);
+                dst[3] = image.channels == 4 ? src[3] : 255;
+            }
+        }
+        return surface;
+    }
+
+    std::vector<Surface> BuildMipChain(const Image& image, const MipSettings& settings) {
+        std::vector<Surface> chain;
+        chain.push_back(ToRgba(image));
+        for (const Image& mip : GenerateMipChain(image, settings)) {
+            chain.push_back(ToRgba(mip));
+        }
+        return chain;
+    }
+
+    int StoredChannels(BlockFormat format) {
+        switch (format) {
+        case BlockFormat::BC1: return 3;
+        case BlockFormat::BC4: return 1;
+        case BlockFormat::BC5: return 2;
+        default: return 4;
+        }
+    }
+
+    double Psnr(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int channels) {
+        double mse = 0.0;
+        size_t count = 0;
+        for (size_t i = 0; i < a.size(); i += 4) {
+            for (int c = 0; c < channels; c++, count++) {
+                const double d = static_cast<double>(a[i + c]) - static_cast<double>(b[i + c]);
+                mse += d * d;
+            }
+        }
+        mse /= static_cast<double>(count);
+        return mse == 0.0 ? 99.0 : 10.0 * std::log10(255.0 * 255.0 / mse);
+    }
+
+    struct CookResult {
+        std::vector<std::vector<uint8_t>> levels;
+        double seconds = 0.0;
+        size_t texels = 0;
+        size_t bytes = 0;
+    };
+
+    CookResult Cook(BlockFormat format, const std::vector<Surface>& chain) {
+        CookResult result;
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (const Surface& level : chain) {
+            result.levels.push_back(CompressSurface(format, level.rgba.data(), level.width, level.height));
+            result.texels += static_cast<size_t>(level.width) * level.height;
+            result.bytes += result.levels.back().size();
+        }
+        result.seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        return result;
+    }
+
+    void PrintReport(const std::vector<Surface>& chain) {
+        size_t rgbaBytes = 0;
+        for (const Surface& level : chain) rgbaBytes += level.rgba.size();
+
+        std::cout << "format   bpp   MPix/s   PSNR(dB)   size(KB)   vs RGBA8" << std::endl;
+        for (BlockFormat format : { BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC4, BlockFormat::BC5, BlockFormat::BC7 }) {
+            const CookResult result = Cook(format, chain);
+            const Surface& base = chain.front();
+            const std::vector<uint8_t> decoded = DecompressSurface(format, result.levels.front().data(), base.width, base.height);
+
+            std::cout << std::left << std::setw(8) << BlockFormatName(format) << std::right << std::fixed
+                      << std::setprecision(1) << std::setw(4) << BlockBytes(format) * 8.0 / 16.0
+                      << std::setw(9) << result.texels / 1e6 / std::max(result.seconds, 1e-9)
+                      << std::setprecision(2) << std::setw(11) << Psnr(base.rgba, decoded, StoredChannels(format))
+                      << std::setw(11) << result.bytes / 1024
+                      << std::setprecision(1) << std::setw(8) << static_cast<double>(rgbaBytes) / result.bytes << "x"
+                      << std::endl;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "usage: TextureCooker <input> <output.ktx2> [--format bc1|bc3|bc4|bc5|bc7] [--srgb] [--report]"
+                     " [--filter box|kaiser|lanczos] [--linear] [--alpha-cutoff <0..1>]" << std::endl;
+        std::cerr << "       TextureCooker <input> <output.vtex> --virtual <tileSize> [--border <texels>]" << std::endl;
+        return 1;
+    }
+
+    const std::string input = argv[1];
+    const std::string output = argv[2];
+    BlockFormat format = BlockFormat::BC7;
+    bool srgb = false;
+    bool report = false;
+    MipSettings mipSettings;
+    int virtualTileSize = 0;
+    int virtualBorder = 4;
+
+    for (int i = 3; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--format" && i + 1 < argc) {
+            if (!ParseBlockFormat(argv[++i], format)) {
+                std::cerr << "Unknown format: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (arg == "--srgb") {
+            srgb = true;
+        } else if (arg == "--report") {
+            report = true;
+        } else if (arg == "--filter" && i + 1 < argc) {
+            const std::string filter = argv[++i];
+            if (filter == "box") mipSettings.filter = MipFilter::Box;
+            else if (filter == "kaiser") mipSettings.filter = MipFilter::Kaiser;
+            else if (filter == "lanczos") mipSettings.filter = MipFilter::Lanczos;
+            else {
+                std::cerr << "Unknown filter: " << filter << std::endl;
+                return 1;
+            }
+        } else if (arg == "--linear") {
+            mipSettings.srgb = false;
+        } else if (arg == "--alpha-cutoff" && i + 1 < argc) {
+            mipSettings.alphaCoverageCutoff = std::stof(argv[++i]);
+        } else if (arg == "--virtual" && i + 1 < argc) {
+            virtualTileSize = std::stoi(argv[++i]);
+        } else if (arg == "--border" && i + 1 < argc) {
+            virtualBorder = std::stoi(argv[++i]);
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    // Flipped here, like the runtime does for uncompressed loads; blocks can't be flipped later
+    Image image = LoadImageFromFile(input.c_str(), true);
+    if (!image.IsValid()) return 1;
+
+    if (virtualTileSize > 0) {
+        if (!WriteVirtualTexture(output, image, virtualTileSize, virtualBorder, mipSettings)) return 1;
+        VirtualTextureFile file;
+        if (!file.Open(output)) return 1;
+        const VirtualTextureInfo& info = file.GetInfo();
+        size_t tiles = 0;
+        for (int level = 0; level < info.levelCount; level++) {
+            tiles += static_cast<size_t>(info.TilesPerSide(level)) * info.TilesPerSide(level);
+        }
+        std::cout << output << ": virtual " << info.size << "x" << info.size << ", " << info.levelCount
+                  << " levels, " << tiles << " tiles of " << info.PaddedTileSize() << "^2, "
+                  << tiles * info.TileBytes() / 1024 << " KB" << std::endl;
+        return 0;
+    }
+
+    // BC4/BC5 only hold data channels
+    if (format == BlockFormat::BC4 || format == BlockFormat::BC5) mipSettings.srgb = false;
+    const std::vector<Surface> chain = BuildMipChain(image, mipSettings);
+
+    if (report) {
+        PrintReport(chain);
+    }
+
+    const CookResult result = Cook(format, chain);
+    if (!WriteKtx2(output, VkFormatFor(format, srgb), image.width, image.height, result.levels)) {
+        return 1;
+    }
+
+    std::cout << output << ": " << BlockFormatName(format) << (srgb ? " srgb" : "") << ", "
+              << image.width << "x" << image.height << ", " << result.levels.size() << " levels, "
+              << result.bytes / 1024 << " KB" << std::endl;
+    return 0;
+}